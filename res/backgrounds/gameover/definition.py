@@ -33,6 +33,7 @@ Palette layout
 """
 
 NAME = 'bg_gameover'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
 
 # ---------------------------------------------------------------------------
 # Palettes
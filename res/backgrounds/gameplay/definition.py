@@ -45,6 +45,7 @@ Palette layout
 """
 
 NAME = 'bg_gameplay'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
 
 # ---------------------------------------------------------------------------
 # Palettes
@@ -275,11 +276,43 @@ _FLAG   = 16            # finish flag (uses same palette as ground tiles)
 _LEDGE  = 17            # platform ledge (one-way: land on top only)
 _ANOTHER_DIRT = 18       # extra dirt tile for variety (not used in original map)
 
-# world-X where player wins; must match C CHECKPOINT_X16 = 368
-# (flag tile lies one column to the right of the original checkpoint)
-CHECKPOINT_X16 = 368
+# Tiles the game code refers to by ID; exported as BG_GAMEPLAY_TILE_<name>
+# with the ID after duplicate tiles have been merged.
+TILE_NAMES = {'FLAG': _FLAG}
+
+# Animated tiles: {TILE_NAMES key: (frames per step, extra frames)}.  The
+# flag's own tile is frame 0; these two make it wave.
+ANIMATED_TILES = {
+    'FLAG': (12, [
+        [[S,D,D,D,D,S,S,S],
+         [S,D,D,W,W,D,D,D],
+         [S,D,D,W,W,W,W,D],
+         [S,D,D,D,D,D,D,D],
+         [S,D,D,D,S,S,S,S],
+         [S,D,D,D,S,S,S,S],
+         [S,D,D,D,S,S,S,S],
+         [D,D,D,D,D,D,D,D]],
+        [[S,D,D,D,D,D,D,S],
+         [S,D,D,W,W,W,D,S],
+         [S,D,D,W,W,W,D,S],
+         [S,D,D,D,D,D,S,S],
+         [S,D,D,D,S,S,S,S],
+         [S,D,D,D,S,S,S,S],
+         [S,D,D,D,S,S,S,S],
+         [D,D,D,D,D,D,D,D]],
+    ]),
+}
+
+# world-X where player wins; exported as BG_GAMEPLAY_GOAL_X16
+GOAL_X16 = 368
 # map column corresponding to end of level (flag location)
-CHECKPOINT_COL = (CHECKPOINT_X16 // 8)
+GOAL_COL = (GOAL_X16 // 8)
+
+# Mid-level checkpoints (world-X, ascending).  Once the player passes one,
+# losing a life respawns them there instead of at the level start.  Each
+# must sit over solid ground clear of pits and platform blocks.
+#   128 = col 16, after PIT1     240 = col 30, after PIT2
+CHECKPOINTS = [128, 240]
 MAP_W, MAP_H = 48, 18
 
 # Trees: (left_col, right_col)
@@ -298,53 +331,92 @@ _PLAT_COLS = {7, 27, 28, 42}
 # Air platforms – floating blocks above the trees (row 6)
 _AIR_PLAT_COLS = {12, 25, 36}
 
-def _is_pit(col):
-    for (ps, pe) in _PITS:
-        if ps <= col <= pe:
-            return True
-    return False
+# Clouds: (row, left_col) of each 3x2 cloud
+_CLOUDS = [(2, 3), (1, 25), (1, 38)]
+
+# Endless runner: bg_gameplay_runner_level, a level with these tiles and no
+# map.  Each 8-column chunk is one of the patterns below, picked by a PRNG
+# from the session seed (level.h, generated levels).  '#' ground, '.' pit,
+# 'B' block on the grass, '-' ledge over a pit, '=' ledge over ground.
+# Every pattern starts and ends on plain ground: the game puts its
+# checkpoints and enemy respawns on chunk edges.
+RUNNER = {
+    'flat_chunks': 3,             # spawn area and the enemy's patrol
+    'ground_row':  10,
+    'ledge_row':   6,
+    'tiles': {                    # (tile, CGB attribute) as in build_attr_map
+        'SKY':   (_SKY,          0x00),
+        'GRASS': (_GRASS,        0x01),
+        'SOIL':  (_ANOTHER_DIRT, 0x01),
+        'DEEP':  (_DIRT,         0x01),
+        'BLOCK': (_PLAT,         0x01),
+        'LEDGE': (_LEDGE,        0x01),
+    },
+    'chunks': [
+        '########',               # flat (start)
+        '###...##',               # 3-wide pit
+        '##....##',               # 4-wide pit
+        '#..--..#',               # 6-wide pit with a ledge to land on
+        '##B###B#',               # blocks to hop
+        '#BB##..#',               # double block, then a pit
+        '##==#..#',               # ledge over ground, then a pit
+        '#...B..#',               # pit, block island, pit
+    ],
+}
+
+# Spawn points (world pixels): player standing on the grass at the level
+# start, enemy on the ground between PIT1 and PIT2.  An optional third
+# element names its behaviour script (default 'patrol', which walks to
+# the pit edges; see res/behaviours/enemy/definition.py)
+PLAYER_SPAWN = (20, 64)
+ENEMY_SPAWN  = (160, 72)
+
+def build_tilemap(map_w, map_h, pits, trees, plat_cols, air_plat_cols,
+                  goal_col, clouds):
+    """Lay out a level with this background's tiles.
+
+    Shared with the other levels (res/backgrounds/level*/definition.py),
+    which use the same tiles and palettes with their own layout."""
+    def is_pit(col):
+        for (ps, pe) in pits:
+            if ps <= col <= pe:
+                return True
+        return False
 
-def _build_tilemap():
     rows = []
-    for row in range(MAP_H):
+    for row in range(map_h):
         r = []
-        for col in range(MAP_W):
+        for col in range(map_w):
             tile = _SKY
 
-            pit = _is_pit(col)
+            pit = is_pit(col)
 
             # air platforms should show regardless of pits
-            if row == 6 and col in _AIR_PLAT_COLS:
+            if row == 6 and col in air_plat_cols:
                 tile = _LEDGE
             elif not pit:
                 if row >= 14:
                     tile = _DIRT
                 elif row >= 11:
                     tile = _ANOTHER_DIRT
-                elif row == 9 and col == CHECKPOINT_COL:
+                elif row == 9 and col == goal_col:
                     # place finish-flag on the tile above the grass row
                     tile = _FLAG
                 elif row == 10:
                     tile = _GRASS
-                elif row == 9 and col in _PLAT_COLS:
+                elif row == 9 and col in plat_cols:
                     tile = _PLAT
                 else:
-                    # Clouds
-                    if row == 2 and 3 <= col <= 5:
-                        tile = [_CTL,_CTC,_CTR][col-3]
-                    elif row == 3 and 3 <= col <= 5:
-                        tile = [_CBL,_CBC,_CBR][col-3]
-                    elif row == 1 and 25 <= col <= 27:
-                        tile = [_CTL,_CTC,_CTR][col-25]
-                    elif row == 2 and 25 <= col <= 27:
-                        tile = [_CBL,_CBC,_CBR][col-25]
-                    elif row == 1 and 38 <= col <= 40:
-                        tile = [_CTL,_CTC,_CTR][col-38]
-                    elif row == 2 and 38 <= col <= 40:
-                        tile = [_CBL,_CBC,_CBR][col-38]
+                    for cr, cc in clouds:
+                        if row == cr and cc <= col <= cc + 2:
+                            tile = [_CTL,_CTC,_CTR][col-cc]
+                            break
+                        if row == cr + 1 and cc <= col <= cc + 2:
+                            tile = [_CBL,_CBC,_CBR][col-cc]
+                            break
                     else:
                         # Trees
-                        for lc, rc in _TREES:
+                        for lc, rc in trees:
                             if row == 7 and col == lc:   tile = _FTL; break
                             if row == 7 and col == rc:   tile = _FTR; break
                             if row == 8 and col == lc:   tile = _FBL; break
@@ -354,7 +426,8 @@ def _build_tilemap():
         rows.append(r)
     return [t for row in rows for t in row]
 
-TILEMAP_FLAT = _build_tilemap()
+TILEMAP_FLAT = build_tilemap(MAP_W, MAP_H, _PITS, _TREES, _PLAT_COLS,
+                             _AIR_PLAT_COLS, GOAL_COL, _CLOUDS)
 assert len(TILEMAP_FLAT) == MAP_W * MAP_H
 
 # ---------------------------------------------------------------------------
@@ -385,16 +458,20 @@ COLLISION_TILE_IDS = [12, 13, 14, 15, 18]
 # ---------------------------------------------------------------------------
 # Per-tile palette attribute map
 # ---------------------------------------------------------------------------
-ATTR_MAP = []
-for i in range(MAP_W * MAP_H):
-    row = i // MAP_W
-    col = i % MAP_W
-    # Platform tiles use palette 1; ground rows use palette 1; sky rows palette 0
-    if TILEMAP_FLAT[i] == _LEDGE:
-        ATTR_MAP.append(0x01)  # platform ledge uses palette 1 (same as ground)
-    elif TILEMAP_FLAT[i] == _PLAT:
-        ATTR_MAP.append(0x01)  # platform block uses palette 1 (same as ground)
-    elif row < 10:
-        ATTR_MAP.append(0x00)
-    else:
-        ATTR_MAP.append(0x01)
+def build_attr_map(tilemap, map_w):
+    """Palette 1 for ground rows and platforms, palette 0 for the sky."""
+    attr = []
+    for i, tile in enumerate(tilemap):
+        row = i // map_w
+        # Platform tiles use palette 1; ground rows use palette 1; sky rows palette 0
+        if tile == _LEDGE:
+            attr.append(0x01)  # platform ledge uses palette 1 (same as ground)
+        elif tile == _PLAT:
+            attr.append(0x01)  # platform block uses palette 1 (same as ground)
+        elif row < 10:
+            attr.append(0x00)
+        else:
+            attr.append(0x01)
+    return attr
+
+ATTR_MAP = build_attr_map(TILEMAP_FLAT, MAP_W)
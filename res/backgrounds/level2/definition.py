@@ -0,0 +1,58 @@
+"""
+Level 2 background definition.
+
+Generates: res/bg_level2.c / res/bg_level2.h
+64x18 tilemap (512x144 px) built from the gameplay background's tiles and
+palettes (res/backgrounds/gameplay/definition.py) with a longer layout:
+four pits, the last two five tiles wide, and three checkpoints.
+
+Only the layout lives here; the incremental generator records the
+gameplay definition as a dependency, so changing the shared tiles
+regenerates this background too.
+"""
+
+import importlib.util
+import os
+
+_spec = importlib.util.spec_from_file_location(
+    'gameplay_definition',
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'gameplay', 'definition.py'))
+_base = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(_base)
+
+NAME = 'bg_level2'
+TILE_CODEC = _base.TILE_CODEC
+
+PALETTE_COLORS = _base.PALETTE_COLORS
+TILES          = _base.TILES
+TILE_NAMES     = _base.TILE_NAMES
+ANIMATED_TILES = _base.ANIMATED_TILES
+
+MAP_W, MAP_H = 64, 18
+
+GOAL_X16 = 480
+GOAL_COL = (GOAL_X16 // 8)
+
+# Checkpoints (world-X, ascending), over solid ground clear of pits and
+# platform blocks:
+#   104 = col 13, after PIT1   224 = col 28, after PIT2   312 = col 39, after PIT3
+CHECKPOINTS = [104, 224, 312]
+
+# Player at the level start; a hopping enemy between PIT1 and PIT2
+PLAYER_SPAWN = (20, 64)
+ENEMY_SPAWN  = (120, 72, 'hopper')
+
+_TREES         = [(4,5), (15,16), (26,27), (38,39), (54,55)]
+_PITS          = [(9,11), (19,22), (30,34), (44,48)]
+_PLAT_COLS     = {7, 24, 42, 52}
+_AIR_PLAT_COLS = {10, 21, 32, 46}
+_CLOUDS        = [(2, 3), (1, 14), (2, 35), (1, 50)]
+
+TILEMAP_FLAT = _base.build_tilemap(MAP_W, MAP_H, _PITS, _TREES, _PLAT_COLS,
+                                   _AIR_PLAT_COLS, GOAL_COL, _CLOUDS)
+assert len(TILEMAP_FLAT) == MAP_W * MAP_H
+
+COLLISION_TILE_DOWN_IDS = _base.COLLISION_TILE_DOWN_IDS
+COLLISION_TILE_IDS      = _base.COLLISION_TILE_IDS
+
+ATTR_MAP = _base.build_attr_map(TILEMAP_FLAT, MAP_W)
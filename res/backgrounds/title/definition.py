@@ -35,6 +35,7 @@ Palette layout
 """
 
 NAME = 'bg_title'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
 
 # ---------------------------------------------------------------------------
 # Palettes
@@ -0,0 +1,48 @@
+/* Auto-generated by tools/gen_behaviour.py - edit that script to change. */
+#pragma bank 255
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+#include "behaviour.h"
+#include "enemy.h"
+#include "behaviours.h"
+
+/* patrol (25 bytes) */
+static const uint8_t behaviours_patrol[25] = {
+    BHV_OP_ANIM, ENEMY_ANIM_WALK_START, ENEMY_ANIM_WALK_FRAMES, ENEMY_ANIM_WALK_SPEED,  /*   0: anim    ENEMY_ANIM_WALK */
+    BHV_OP_NEAR, 72U, 12U,                                                              /*   4: near    72, shoot */
+    BHV_OP_WALK, 8U,                                                                    /*   7: walk    8 */
+    BHV_OP_TURN_AT_EDGE,                                                                /*   9: turn_at_edge */
+    BHV_OP_GOTO, 4U,                                                                    /*  10: goto    patrol */
+    BHV_OP_FACE,                                                                        /*  12: face */
+    BHV_OP_ANIM, ENEMY_ANIM_IDLE_START, ENEMY_ANIM_IDLE_FRAMES, ENEMY_ANIM_IDLE_SPEED,  /*  13: anim    ENEMY_ANIM_IDLE */
+    BHV_OP_FIRE,                                                                        /*  17: fire */
+    BHV_OP_WAIT, 90U,                                                                   /*  18: wait    90 */
+    BHV_OP_NEAR, 72U, 12U,                                                              /*  20: near    72, shoot */
+    BHV_OP_GOTO, 0U,                                                                    /*  23: goto    start */
+};
+
+/* hopper (33 bytes) */
+static const uint8_t behaviours_hopper[33] = {
+    BHV_OP_ANIM, ENEMY_ANIM_WALK_START, ENEMY_ANIM_WALK_FRAMES, ENEMY_ANIM_WALK_SPEED,  /*   0: anim    ENEMY_ANIM_WALK */
+    BHV_OP_NEAR, 56U, 14U,                                                              /*   4: near    56, hop */
+    BHV_OP_WALK, 24U,                                                                   /*   7: walk    24 */
+    BHV_OP_TURN_AT_EDGE,                                                                /*   9: turn_at_edge */
+    BHV_OP_WAIT, 10U,                                                                   /*  10: wait    10 */
+    BHV_OP_GOTO, 4U,                                                                    /*  12: goto    pace */
+    BHV_OP_FACE,                                                                        /*  14: face */
+    BHV_OP_ANIM, ENEMY_ANIM_IDLE_START, ENEMY_ANIM_IDLE_FRAMES, ENEMY_ANIM_IDLE_SPEED,  /*  15: anim    ENEMY_ANIM_IDLE */
+    BHV_OP_WAIT, 16U,                                                                   /*  19: wait    16 */
+    BHV_OP_JUMP, 4U,                                                                    /*  21: jump    4 */
+    BHV_OP_WAIT, 4U,                                                                    /*  23: wait    4 */
+    BHV_OP_FIRE,                                                                        /*  25: fire */
+    BHV_OP_WAIT, 40U,                                                                   /*  26: wait    40 */
+    BHV_OP_FAR, 96U, 0U,                                                                /*  28: far     96, start */
+    BHV_OP_GOTO, 14U,                                                                   /*  31: goto    hop */
+};
+
+BANKREF(behaviours)
+const uint8_t * const behaviours[2] = {
+    behaviours_patrol,
+    behaviours_hopper
+};
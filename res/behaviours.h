@@ -0,0 +1,17 @@
+/* Auto-generated by tools/gen_behaviour.py - edit that script to change. */
+#ifndef BEHAVIOURS_H
+#define BEHAVIOURS_H
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+
+/* Script ids for behaviour_start() */
+#define BHV_PATROL  0U
+#define BHV_HOPPER  1U
+
+#define BHV_COUNT   2U
+
+BANKREF_EXTERN(behaviours)
+extern const uint8_t * const behaviours[2];
+
+#endif
@@ -0,0 +1,77 @@
+"""
+Enemy behaviour scripts for gen_behaviour.py directory discovery.
+
+Generates: res/behaviours.c / res/behaviours.h
+
+Each script is assembled into bytecode for the behaviour interpreter
+(src/lib/include/behaviour.h); a level picks one with the third element
+of ENEMY_SPAWN (default: the first).  One instruction per line, 'label:'
+lines and ';' comments.  Operands are numbers or C constants from
+INCLUDES; 'anim NAME' plays the animation NAME_START / _FRAMES / _SPEED.
+
+    end                     stop
+    walk   frames           walk 1 px/frame; ends early at a wall or edge
+    wait   frames           stand still
+    turn                    reverse
+    turn_at_edge            reverse if a wall or edge is one step ahead
+    face                    face the player
+    jump   speed            leave the ground at speed px/frame
+    fire                    shoot at the player (the game spawns the bullet)
+    near   dist, label      branch if the player is within dist px
+    far    dist, label      branch if the player is dist px or more away
+    anim   start, frames, speed
+    goto   label
+
+WALK and WAIT end the enemy's frame; at most BHV_BUDGET instructions run
+per frame, so a loop that never waits only resumes next frame.
+
+Scripts
+-------
+    patrol  - walk between walls and pit edges; stop and shoot while the
+              player is close
+    hopper  - pace about, then hop in place and shoot when the player
+              comes near
+"""
+
+NAME = 'behaviours'
+
+INCLUDES = ['enemy.h']
+
+SCRIPTS = {
+    'patrol': '''
+        start:
+            anim    ENEMY_ANIM_WALK
+        patrol:
+            near    72, shoot
+            walk    8
+            turn_at_edge
+            goto    patrol
+        shoot:                      ; one bullet every 1.5 s
+            face
+            anim    ENEMY_ANIM_IDLE
+            fire
+            wait    90
+            near    72, shoot
+            goto    start
+    ''',
+    'hopper': '''
+        start:
+            anim    ENEMY_ANIM_WALK
+        pace:
+            near    56, hop
+            walk    24
+            turn_at_edge
+            wait    10
+            goto    pace
+        hop:
+            face
+            anim    ENEMY_ANIM_IDLE
+            wait    16
+            jump    4
+            wait    4               ; near the top of the hop
+            fire
+            wait    40
+            far     96, start
+            goto    hop
+    ''',
+}
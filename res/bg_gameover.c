@@ -11,17 +11,13 @@ const palette_color_t bg_gameover_palettes[8] = {
     RGB8( 35, 18,  8), RGB8( 80, 45, 20), RGB8( 55, 28, 12), RGB8( 12,  6,  2)
 };
 
-/* Background tile data (8 tiles, 16 bytes each) */
+/* Background tile data (7 tiles, pb16-compressed) */
 BANKREF(bg_gameover_tiles)
-const uint8_t bg_gameover_tiles[128] = {
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x20U, 0x00U, 0x70U, 0x00U, 0x22U, 0x00U, 0x0EU, 0x00U, 0x04U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U,
-    0x7EU, 0x00U, 0xCFU, 0x30U, 0x87U, 0x78U, 0x83U, 0x7CU, 0xC7U, 0x38U, 0x7EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x18U, 0x00U, 0x7CU, 0x00U, 0xDEU, 0x20U, 0x7CU, 0x00U, 0x18U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0xFFU, 0xFFU, 0x10U, 0x00U, 0x24U, 0x00U, 0x42U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0x00U, 0xFFU,
-    0x00U, 0xFFU, 0x20U, 0xDFU, 0x52U, 0x8DU, 0x25U, 0xD8U, 0x0AU, 0xF1U, 0x04U, 0xFBU, 0x00U, 0xFFU, 0x00U, 0xFFU,
-    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
-    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+const uint8_t bg_gameover_tiles[63] = {
+    0xFFU, 0xFFU, 0x55U, 0x20U, 0x70U, 0x22U, 0x0EU, 0x55U, 0x04U, 0x20U, 0x00U, 0x10U, 0x40U, 0x7EU, 0xCFU, 0x30U,
+    0x87U, 0x78U, 0x83U, 0x7CU, 0x07U, 0xC7U, 0x38U, 0x7EU, 0x00U, 0x00U, 0x50U, 0x18U, 0x7CU, 0xDEU, 0x20U, 0x7CU,
+    0x00U, 0x5FU, 0x18U, 0x00U, 0xC1U, 0xFFU, 0xFFU, 0x10U, 0x00U, 0x24U, 0x5BU, 0x42U, 0x00U, 0xFFU, 0xC0U, 0x20U,
+    0xDFU, 0x52U, 0x8DU, 0x25U, 0xD8U, 0x03U, 0x0AU, 0xF1U, 0x04U, 0xFBU, 0x00U, 0xFFU, 0x7FU, 0xFFU, 0xFFU
 };
 
 /* Background tilemap (20x18 = 360 bytes) */
@@ -45,15 +41,17 @@ const uint8_t bg_gameover_map[360] = {
     0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U,
     0x05U, 0x05U, 0x05U, 0x05U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
     0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
-    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x07U, 0x07U, 0x07U, 0x07U,
-    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
-    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
-    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
-    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U
 };
 
-/* Per-tile palette attribute map (20x18 = 360 bytes).
-   Each byte is the GBC VRAM bank-1 attribute: 0x00=sky palette, 0x01=ground palette. */
+/* Per-tile attribute map (20x18 = 360 bytes).
+   Each byte is the GBC VRAM bank-1 attribute: bits 0-2 = palette,
+   0x20 = X flip, 0x40 = Y flip (set by tile deduplication).
+   Bit 3 (VRAM bank) is left to vram_set_bkg_submap(). */
 BANKREF(bg_gameover_attr_map)
 const uint8_t bg_gameover_attr_map[360] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
@@ -5,11 +5,17 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
 
-#define BG_GAMEOVER_TILE_COUNT    8U
+#define BG_GAMEOVER_TILE_COUNT    7U
 #define BG_GAMEOVER_PALETTE_COUNT 2U
 #define BG_GAMEOVER_MAP_WIDTH     20U
 #define BG_GAMEOVER_MAP_HEIGHT    18U
+#define BG_GAMEOVER_TILE_CODEC    TILE_CODEC_PB16
+#define BG_GAMEOVER_TILES_SIZE    63U
+#define BG_GAMEOVER_SET_TILES(first)  pb16_set_bkg_data((first), BG_GAMEOVER_TILE_COUNT, bg_gameover_tiles)
+#define BG_GAMEOVER_VRAM_LOAD()  vram_load(VRAM_BG, bg_gameover_tiles, BANK(bg_gameover_tiles), BG_GAMEOVER_TILE_COUNT, BG_GAMEOVER_TILE_CODEC)
 
 BANKREF_EXTERN(bg_gameover_palettes)
 BANKREF_EXTERN(bg_gameover_tiles)
@@ -17,7 +23,7 @@ BANKREF_EXTERN(bg_gameover_map)
 BANKREF_EXTERN(bg_gameover_attr_map)
 
 extern const palette_color_t bg_gameover_palettes[8];
-extern const uint8_t bg_gameover_tiles[128];
+extern const uint8_t bg_gameover_tiles[63];
 extern const uint8_t bg_gameover_map[360];
 extern const uint8_t bg_gameover_attr_map[360];
 
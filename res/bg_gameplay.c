@@ -11,28 +11,15 @@ const palette_color_t bg_gameplay_palettes[8] = {
     RGB8(120,200, 80), RGB8( 80,160, 80), RGB8(120, 80, 40), RGB8( 80, 50, 20)
 };
 
-/* Background tile data (19 tiles, 16 bytes each) */
+/* Background tile data (13 tiles, pb16-compressed) */
 BANKREF(bg_gameplay_tiles)
-const uint8_t bg_gameplay_tiles[304] = {
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFCU, 0x00U, 0xFCU, 0x00U, 0xFCU, 0x00U, 0xFCU, 0x00U,
-    0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0xFCU, 0x00U, 0xFCU, 0x00U, 0xFCU, 0x00U, 0xFCU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x1FU, 0x1FU, 0x20U, 0x3FU, 0x40U, 0x7FU, 0x80U, 0xFFU, 0x80U, 0xFFU, 0xC0U, 0xFFU, 0x80U, 0xFFU, 0x80U, 0xFFU,
-    0xF8U, 0xF8U, 0x04U, 0xFCU, 0x02U, 0xFEU, 0x01U, 0xFFU, 0x01U, 0xFFU, 0x03U, 0xFFU, 0x01U, 0xFFU, 0x01U, 0xFFU,
-    0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x80U, 0xFFU, 0x80U, 0xFFU, 0x40U, 0x7FU, 0x30U, 0x3FU, 0x1CU, 0x1FU,
-    0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x01U, 0xFFU, 0x01U, 0xFFU, 0x02U, 0xFEU, 0x0CU, 0xFCU, 0x38U, 0xF8U,
-    0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U, 0x18U,
-    0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU,
-    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xDDU, 0xDDU, 0xFFU, 0xFFU, 0xEFU, 0xEFU, 0xFFU, 0xFFU, 0x7DU, 0x7DU, 0xFFU, 0xFFU,
-    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
-    0xFFU, 0xFFU, 0x91U, 0xFFU, 0x91U, 0xFFU, 0xFFU, 0xFFU, 0x89U, 0xFFU, 0x89U, 0xFFU, 0x89U, 0xFFU, 0xFFU, 0xFFU,
-    0x7CU, 0x7CU, 0x7FU, 0x61U, 0x7FU, 0x61U, 0x7CU, 0x7CU, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0xFFU, 0xFFU,
-    0x00U, 0xFFU, 0x00U, 0xFFU, 0x55U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
-    0xFFU, 0xFFU, 0xEDU, 0xEDU, 0xD7U, 0xFFU, 0xF7U, 0xF7U, 0xD5U, 0xDFU, 0xFFU, 0xFFU, 0xA5U, 0xADU, 0xFFU, 0xFFU
+const uint8_t bg_gameplay_tiles[95] = {
+    0xFFU, 0xFFU, 0xFFU, 0x7FU, 0x3FU, 0x77U, 0x00U, 0xFFU, 0xFFU, 0x00U, 0x1FU, 0x1FU, 0x20U, 0x3FU, 0x40U, 0x7FU,
+    0x80U, 0xFFU, 0xD7U, 0xC0U, 0x80U, 0x7DU, 0x00U, 0x80U, 0xC0U, 0x40U, 0x7FU, 0x30U, 0x3FU, 0x1CU, 0x1FU, 0x3FU,
+    0x18U, 0x18U, 0xFFU, 0x3FU, 0x00U, 0xFFU, 0xFFU, 0x70U, 0xFFU, 0xDDU, 0xDDU, 0xFFU, 0xFFU, 0x00U, 0xEFU, 0xEFU,
+    0xFFU, 0xFFU, 0x7DU, 0x7DU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xDDU, 0x91U, 0xFFU, 0x7DU, 0x89U, 0xFFU, 0x0CU, 0x7CU,
+    0x7CU, 0x7FU, 0x61U, 0x7CU, 0x7CU, 0x3CU, 0x70U, 0x70U, 0xFFU, 0xFFU, 0x75U, 0x00U, 0x55U, 0xFFU, 0xFFU, 0xC0U,
+    0xEDU, 0xEDU, 0xD7U, 0xFFU, 0xF7U, 0xF7U, 0x00U, 0xD5U, 0xDFU, 0xFFU, 0xFFU, 0xA5U, 0xADU, 0xFFU, 0xFFU
 };
 
 /* Background tilemap (48x18 = 864 bytes) */
@@ -42,12 +29,12 @@ const uint8_t bg_gameplay_map[864] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x05U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x04U, 0x05U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
@@ -56,58 +43,60 @@ const uint8_t bg_gameplay_map[864] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x07U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U,
-    0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x09U, 0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U,
-    0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x0AU, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x0BU, 0x00U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x0BU, 0x0BU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x0FU, 0x00U, 0x00U, 0x0BU,
-    0x0BU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U, 0x0BU, 0x0BU, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x03U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U,
+    0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x03U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U,
+    0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x05U, 0x00U, 0x09U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x05U, 0x05U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x09U, 0x00U, 0x00U, 0x05U,
+    0x05U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x00U, 0x05U, 0x05U, 0x0AU, 0x00U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x00U, 0x00U, 0x00U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
     0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU,
     0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU,
     0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU,
-    0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U,
-    0x12U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U, 0x12U,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU,
-    0x0DU, 0x0DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU, 0x0DU
+    0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU,
+    0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU,
+    0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU,
+    0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU,
+    0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU,
+    0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU, 0x0CU,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U
 };
 
-/* Per-tile palette attribute map (48x18 = 864 bytes).
-   Each byte is the GBC VRAM bank-1 attribute: 0x00=sky palette, 0x01=ground palette. */
+/* Per-tile attribute map (48x18 = 864 bytes).
+   Each byte is the GBC VRAM bank-1 attribute: bits 0-2 = palette,
+   0x20 = X flip, 0x40 = Y flip (set by tile deduplication).
+   Bit 3 (VRAM bank) is left to vram_set_bkg_submap(). */
 BANKREF(bg_gameplay_attr_map)
 const uint8_t bg_gameplay_attr_map[864] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x40U, 0x40U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
@@ -119,12 +108,12 @@ const uint8_t bg_gameplay_attr_map[864] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U,
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
@@ -158,12 +147,88 @@ const uint8_t bg_gameplay_attr_map[864] = {
    Sprites landing on (falling onto) these tile IDs are stopped; sides and below are passable. */
 BANKREF(bg_gameplay_collision_down_tiles)
 const uint8_t bg_gameplay_collision_down_tiles[6] = {
-    0x0CU, 0x0DU, 0x0EU, 0x0FU, 0x11U, 0x12U
+    0x06U, 0x07U, 0x08U, 0x09U, 0x0BU, 0x0CU
 };
 
 /* Collision tile IDs (5 entries).
    These tiles block sprites from all directions (left, right, above, below). */
 BANKREF(bg_gameplay_collision_tiles)
 const uint8_t bg_gameplay_collision_tiles[5] = {
-    0x0CU, 0x0DU, 0x0EU, 0x0FU, 0x12U
+    0x06U, 0x07U, 0x08U, 0x09U, 0x0CU
+};
+
+/* Checkpoint world-X positions (2 entries, ascending).
+   Passing one moves the respawn point there. */
+BANKREF(bg_gameplay_checkpoints)
+const uint16_t bg_gameplay_checkpoints[2] = {
+    128U, 240U
+};
+
+/* Animated tile frames (3 frames, raw 2bpp; frame 0 of each
+   sequence repeats the tile's own art).  tile_anim_commit() copies
+   them over the tile in VRAM; the map is never touched. */
+BANKREF(bg_gameplay_anim_frames)
+const uint8_t bg_gameplay_anim_frames[48] = {
+    0x7CU, 0x7CU, 0x7FU, 0x61U, 0x7FU, 0x61U, 0x7CU, 0x7CU, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0xFFU, 0xFFU,
+    0x78U, 0x78U, 0x7FU, 0x67U, 0x7FU, 0x61U, 0x7FU, 0x7FU, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0xFFU, 0xFFU,
+    0x7EU, 0x7EU, 0x7EU, 0x62U, 0x7EU, 0x62U, 0x7CU, 0x7CU, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0x70U, 0xFFU, 0xFFU
+};
+
+/* {tile, first frame, frame count, speed} per animated tile */
+BANKREF(bg_gameplay_anims)
+const TileAnim bg_gameplay_anims[1] = {
+    { 10U, 0U, 3U, 12U },
+};
+
+BANKREF(bg_gameplay_tile_anims)
+const TileAnimSet bg_gameplay_tile_anims = {
+    bg_gameplay_anim_frames, bg_gameplay_anims, 1U
+};
+
+/* Level descriptor, in the same bank as the data it points to.
+   Read it through level_select() (src/lib/include/level.h). */
+BANKREF(bg_gameplay_level)
+const Level bg_gameplay_level = {
+    bg_gameplay_tiles, bg_gameplay_palettes, bg_gameplay_map, bg_gameplay_attr_map,
+    bg_gameplay_collision_tiles, bg_gameplay_collision_down_tiles, bg_gameplay_checkpoints,
+    &bg_gameplay_tile_anims, NULL,
+    BG_GAMEPLAY_GOAL_X16,
+    BG_GAMEPLAY_MAP_WIDTH, BG_GAMEPLAY_MAP_HEIGHT,
+    BG_GAMEPLAY_TILE_COUNT, BG_GAMEPLAY_TILE_CODEC, BG_GAMEPLAY_PALETTE_COUNT,
+    5U, 6U, 2U,
+    20U, 64U, 160U, 72U, 0U
+};
+
+/* Runner chunk patterns (8 x 8 column codes,
+   LEVEL_GEN_* in src/lib/include/level.h) */
+BANKREF(bg_gameplay_runner_chunks)
+const uint8_t bg_gameplay_runner_chunks[64] = {
+    0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U,
+    0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x01U,
+    0x01U, 0x01U, 0x03U, 0x01U, 0x01U, 0x01U, 0x03U, 0x01U, 0x01U, 0x03U, 0x03U, 0x01U, 0x01U, 0x00U, 0x00U, 0x01U,
+    0x01U, 0x01U, 0x05U, 0x05U, 0x01U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x01U
+};
+
+/* {patterns, count, flat chunks, ground row, ledge row,
+    tiles and attributes per LEVEL_KIND_*} */
+BANKREF(bg_gameplay_runner_gen)
+const LevelGen bg_gameplay_runner_gen = {
+    bg_gameplay_runner_chunks, 8U, 3U,
+    10U, 6U,
+    { 0U, 6U, 12U, 7U, 9U, 11U },
+    { 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U }
+};
+
+/* Generated level on the same tiles: no map and no end (width 0),
+   columns come from level_set_seed() and the patterns above. */
+BANKREF(bg_gameplay_runner_level)
+const Level bg_gameplay_runner_level = {
+    bg_gameplay_tiles, bg_gameplay_palettes, NULL, NULL,
+    bg_gameplay_collision_tiles, bg_gameplay_collision_down_tiles, NULL,
+    &bg_gameplay_tile_anims, &bg_gameplay_runner_gen,
+    0U,
+    0U, 18U,
+    BG_GAMEPLAY_TILE_COUNT, BG_GAMEPLAY_TILE_CODEC, BG_GAMEPLAY_PALETTE_COUNT,
+    5U, 6U, 0U,
+    20U, 64U, 160U, 72U, 0U
 };
@@ -5,11 +5,21 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
+#include "tile_anim.h"
+#include "level.h"
 
-#define BG_GAMEPLAY_TILE_COUNT    19U
+#define BG_GAMEPLAY_TILE_COUNT    13U
 #define BG_GAMEPLAY_PALETTE_COUNT 2U
 #define BG_GAMEPLAY_MAP_WIDTH     48U
 #define BG_GAMEPLAY_MAP_HEIGHT    18U
+#define BG_GAMEPLAY_TILE_CODEC    TILE_CODEC_PB16
+#define BG_GAMEPLAY_TILES_SIZE    95U
+#define BG_GAMEPLAY_SET_TILES(first)  pb16_set_bkg_data((first), BG_GAMEPLAY_TILE_COUNT, bg_gameplay_tiles)
+#define BG_GAMEPLAY_VRAM_LOAD()  vram_load(VRAM_BG, bg_gameplay_tiles, BANK(bg_gameplay_tiles), BG_GAMEPLAY_TILE_COUNT, BG_GAMEPLAY_TILE_CODEC)
+#define BG_GAMEPLAY_GOAL_X16      368U
+#define BG_GAMEPLAY_TILE_FLAG  10U
 
 BANKREF_EXTERN(bg_gameplay_palettes)
 BANKREF_EXTERN(bg_gameplay_tiles)
@@ -17,14 +27,28 @@ BANKREF_EXTERN(bg_gameplay_map)
 BANKREF_EXTERN(bg_gameplay_attr_map)
 BANKREF_EXTERN(bg_gameplay_collision_down_tiles)
 BANKREF_EXTERN(bg_gameplay_collision_tiles)
+BANKREF_EXTERN(bg_gameplay_checkpoints)
+BANKREF_EXTERN(bg_gameplay_anim_frames)
+BANKREF_EXTERN(bg_gameplay_anims)
+BANKREF_EXTERN(bg_gameplay_tile_anims)
+BANKREF_EXTERN(bg_gameplay_level)
+BANKREF_EXTERN(bg_gameplay_runner_level)
 
 extern const palette_color_t bg_gameplay_palettes[8];
-extern const uint8_t bg_gameplay_tiles[304];
+extern const uint8_t bg_gameplay_tiles[95];
 extern const uint8_t bg_gameplay_map[864];
 extern const uint8_t bg_gameplay_attr_map[864];
 #define BG_GAMEPLAY_COLLISION_DOWN_TILE_COUNT 6U
 extern const uint8_t bg_gameplay_collision_down_tiles[6];
 #define BG_GAMEPLAY_COLLISION_TILE_COUNT 5U
 extern const uint8_t bg_gameplay_collision_tiles[5];
+#define BG_GAMEPLAY_CHECKPOINT_COUNT 2U
+extern const uint16_t bg_gameplay_checkpoints[2];
+#define BG_GAMEPLAY_ANIM_TILE_COUNT 1U
+extern const uint8_t bg_gameplay_anim_frames[48];
+extern const TileAnim bg_gameplay_anims[1];
+extern const TileAnimSet bg_gameplay_tile_anims;
+extern const Level bg_gameplay_level;
+extern const Level bg_gameplay_runner_level;
 
 #endif
@@ -0,0 +1,52 @@
+/* Auto-generated by tools/gen_background.py - edit that script to change. */
+#ifndef BG_LEVEL2_H
+#define BG_LEVEL2_H
+
+#include <gbdk/platform.h>
+#include <gb/cgb.h>
+#include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
+#include "tile_anim.h"
+#include "level.h"
+
+#define BG_LEVEL2_TILE_COUNT    13U
+#define BG_LEVEL2_PALETTE_COUNT 2U
+#define BG_LEVEL2_MAP_WIDTH     64U
+#define BG_LEVEL2_MAP_HEIGHT    18U
+#define BG_LEVEL2_TILE_CODEC    TILE_CODEC_PB16
+#define BG_LEVEL2_TILES_SIZE    95U
+#define BG_LEVEL2_SET_TILES(first)  pb16_set_bkg_data((first), BG_LEVEL2_TILE_COUNT, bg_level2_tiles)
+#define BG_LEVEL2_VRAM_LOAD()  vram_load(VRAM_BG, bg_level2_tiles, BANK(bg_level2_tiles), BG_LEVEL2_TILE_COUNT, BG_LEVEL2_TILE_CODEC)
+#define BG_LEVEL2_GOAL_X16      480U
+#define BG_LEVEL2_TILE_FLAG  10U
+
+BANKREF_EXTERN(bg_level2_palettes)
+BANKREF_EXTERN(bg_level2_tiles)
+BANKREF_EXTERN(bg_level2_map)
+BANKREF_EXTERN(bg_level2_attr_map)
+BANKREF_EXTERN(bg_level2_collision_down_tiles)
+BANKREF_EXTERN(bg_level2_collision_tiles)
+BANKREF_EXTERN(bg_level2_checkpoints)
+BANKREF_EXTERN(bg_level2_anim_frames)
+BANKREF_EXTERN(bg_level2_anims)
+BANKREF_EXTERN(bg_level2_tile_anims)
+BANKREF_EXTERN(bg_level2_level)
+
+extern const palette_color_t bg_level2_palettes[8];
+extern const uint8_t bg_level2_tiles[95];
+extern const uint8_t bg_level2_map[1152];
+extern const uint8_t bg_level2_attr_map[1152];
+#define BG_LEVEL2_COLLISION_DOWN_TILE_COUNT 6U
+extern const uint8_t bg_level2_collision_down_tiles[6];
+#define BG_LEVEL2_COLLISION_TILE_COUNT 5U
+extern const uint8_t bg_level2_collision_tiles[5];
+#define BG_LEVEL2_CHECKPOINT_COUNT 3U
+extern const uint16_t bg_level2_checkpoints[3];
+#define BG_LEVEL2_ANIM_TILE_COUNT 1U
+extern const uint8_t bg_level2_anim_frames[48];
+extern const TileAnim bg_level2_anims[1];
+extern const TileAnimSet bg_level2_tile_anims;
+extern const Level bg_level2_level;
+
+#endif
@@ -11,19 +11,12 @@ const palette_color_t bg_title_palettes[8] = {
     RGB8( 40, 80, 20), RGB8( 30, 60, 15), RGB8( 50, 30, 10), RGB8( 20, 10,  5)
 };
 
-/* Background tile data (10 tiles, 16 bytes each) */
+/* Background tile data (9 tiles, pb16-compressed) */
 BANKREF(bg_title_tiles)
-const uint8_t bg_title_tiles[160] = {
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x20U, 0x00U, 0x02U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x80U, 0x00U, 0x01U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U, 0x1FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xF0U, 0x00U, 0xF8U, 0x00U, 0xF8U, 0x00U, 0xF8U, 0x00U, 0xF8U, 0x00U,
-    0x3FU, 0x00U, 0x3FU, 0x00U, 0x3FU, 0x00U, 0x1FU, 0x00U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0xF8U, 0x00U, 0xF8U, 0x00U, 0xF8U, 0x00U, 0xF0U, 0x00U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x08U, 0x00U, 0x1CU, 0x00U, 0x3EU, 0x00U, 0x7FU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU,
-    0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU, 0x00U, 0xFFU,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+const uint8_t bg_title_tiles[47] = {
+    0xFFU, 0xFFU, 0x55U, 0x20U, 0x02U, 0x00U, 0x08U, 0x55U, 0x80U, 0x01U, 0x10U, 0x00U, 0xF5U, 0x0FU, 0x1FU, 0x7FU,
+    0x3FU, 0x75U, 0x00U, 0xE0U, 0xF0U, 0x7FU, 0xF8U, 0x7DU, 0x3FU, 0x1FU, 0x5FU, 0x0FU, 0x00U, 0x7DU, 0xF8U, 0xF0U,
+    0x5FU, 0xE0U, 0x00U, 0xAAU, 0x08U, 0x1CU, 0x3EU, 0x7FU, 0xBFU, 0xFFU, 0xFFU, 0xFFU, 0x7FU, 0xFFU, 0xFFU
 };
 
 /* Background tilemap (20x18 = 360 bytes) */
@@ -46,16 +39,18 @@ const uint8_t bg_title_map[360] = {
     0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
     0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
     0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
-    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U,
-    0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x09U, 0x09U, 0x09U, 0x09U,
-    0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U,
-    0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U,
-    0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U,
-    0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U, 0x09U
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x08U, 0x08U,
+    0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U,
+    0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U,
+    0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U,
+    0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U
 };
 
-/* Per-tile palette attribute map (20x18 = 360 bytes).
-   Each byte is the GBC VRAM bank-1 attribute: 0x00=sky palette, 0x01=ground palette. */
+/* Per-tile attribute map (20x18 = 360 bytes).
+   Each byte is the GBC VRAM bank-1 attribute: bits 0-2 = palette,
+   0x20 = X flip, 0x40 = Y flip (set by tile deduplication).
+   Bit 3 (VRAM bank) is left to vram_set_bkg_submap(). */
 BANKREF(bg_title_attr_map)
 const uint8_t bg_title_attr_map[360] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
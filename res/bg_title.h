@@ -5,11 +5,17 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
 
-#define BG_TITLE_TILE_COUNT    10U
+#define BG_TITLE_TILE_COUNT    9U
 #define BG_TITLE_PALETTE_COUNT 2U
 #define BG_TITLE_MAP_WIDTH     20U
 #define BG_TITLE_MAP_HEIGHT    18U
+#define BG_TITLE_TILE_CODEC    TILE_CODEC_PB16
+#define BG_TITLE_TILES_SIZE    47U
+#define BG_TITLE_SET_TILES(first)  pb16_set_bkg_data((first), BG_TITLE_TILE_COUNT, bg_title_tiles)
+#define BG_TITLE_VRAM_LOAD()  vram_load(VRAM_BG, bg_title_tiles, BANK(bg_title_tiles), BG_TITLE_TILE_COUNT, BG_TITLE_TILE_CODEC)
 
 BANKREF_EXTERN(bg_title_palettes)
 BANKREF_EXTERN(bg_title_tiles)
@@ -17,7 +23,7 @@ BANKREF_EXTERN(bg_title_map)
 BANKREF_EXTERN(bg_title_attr_map)
 
 extern const palette_color_t bg_title_palettes[8];
-extern const uint8_t bg_title_tiles[160];
+extern const uint8_t bg_title_tiles[47];
 extern const uint8_t bg_title_map[360];
 extern const uint8_t bg_title_attr_map[360];
 
@@ -5,11 +5,17 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
 
-#define BG_WIN_TILE_COUNT    10U
+#define BG_WIN_TILE_COUNT    9U
 #define BG_WIN_PALETTE_COUNT 2U
 #define BG_WIN_MAP_WIDTH     20U
 #define BG_WIN_MAP_HEIGHT    18U
+#define BG_WIN_TILE_CODEC    TILE_CODEC_PB16
+#define BG_WIN_TILES_SIZE    56U
+#define BG_WIN_SET_TILES(first)  pb16_set_bkg_data((first), BG_WIN_TILE_COUNT, bg_win_tiles)
+#define BG_WIN_VRAM_LOAD()  vram_load(VRAM_BG, bg_win_tiles, BANK(bg_win_tiles), BG_WIN_TILE_COUNT, BG_WIN_TILE_CODEC)
 
 BANKREF_EXTERN(bg_win_palettes)
 BANKREF_EXTERN(bg_win_tiles)
@@ -17,7 +23,7 @@ BANKREF_EXTERN(bg_win_map)
 BANKREF_EXTERN(bg_win_attr_map)
 
 extern const palette_color_t bg_win_palettes[8];
-extern const uint8_t bg_win_tiles[160];
+extern const uint8_t bg_win_tiles[56];
 extern const uint8_t bg_win_map[360];
 extern const uint8_t bg_win_attr_map[360];
 
@@ -8,14 +8,11 @@ const palette_color_t enemy_palettes[4] = {
     RGB8(255,  0,255), RGB8( 20, 20, 20), RGB8(100,180, 50), RGB8(160,230, 80)
 };
 
-/* Sprite tiles: 8 tiles total (4 frames, 2 tiles/frame) */
-const uint8_t enemy_tiles[128] = {
-    0x3CU, 0x00U, 0x42U, 0x3CU, 0x92U, 0x7CU, 0x82U, 0x6CU, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0x66U, 0x42U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x3CU, 0x00U, 0x42U, 0x3CU, 0xB2U, 0x4CU, 0x82U, 0x6CU, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0x66U, 0x42U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x3CU, 0x00U, 0x42U, 0x3CU, 0x92U, 0x7CU, 0x82U, 0x6CU, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0x66U, 0x42U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x3CU, 0x00U, 0x42U, 0x3CU, 0x92U, 0x6CU, 0x82U, 0x6CU, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0xC3U, 0x81U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U
+/* Sprite tiles: 8 tiles total (4 frames, 2 tiles/frame), pb16-compressed */
+const uint8_t enemy_tiles[79] = {
+    0x40U, 0x3CU, 0x42U, 0x3CU, 0x92U, 0x7CU, 0x82U, 0x6CU, 0x00U, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0x66U, 0x42U,
+    0x00U, 0x7FU, 0x00U, 0xFFU, 0x40U, 0x3CU, 0x42U, 0x3CU, 0xB2U, 0x4CU, 0x82U, 0x6CU, 0x00U, 0x81U, 0x7EU, 0x7EU,
+    0x00U, 0x00U, 0x66U, 0x42U, 0x00U, 0x7FU, 0x00U, 0xFFU, 0x40U, 0x3CU, 0x42U, 0x3CU, 0x92U, 0x7CU, 0x82U, 0x6CU,
+    0x00U, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0x66U, 0x42U, 0x00U, 0x7FU, 0x00U, 0xFFU, 0x41U, 0x3CU, 0x42U, 0x3CU,
+    0x92U, 0x6CU, 0x82U, 0x00U, 0x81U, 0x7EU, 0x7EU, 0x00U, 0x00U, 0xC3U, 0x81U, 0x00U, 0x7FU, 0x00U, 0xFFU
 };
@@ -5,10 +5,16 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
 
 #define ENEMY_TILE_COUNT      8U
 #define ENEMY_PALETTE_COUNT    1U
 #define ENEMY_TILES_PER_FRAME  2U
+#define ENEMY_TILE_CODEC    TILE_CODEC_PB16
+#define ENEMY_TILES_SIZE    79U
+#define ENEMY_SET_TILES(first)  pb16_set_sprite_data((first), ENEMY_TILE_COUNT, enemy_tiles)
+#define ENEMY_VRAM_LOAD()  vram_load(VRAM_OBJ, enemy_tiles, 0U, ENEMY_TILE_COUNT, ENEMY_TILE_CODEC)
 
 /* Animation: idle */
 #define ENEMY_ANIM_IDLE_START   0U
@@ -21,6 +27,6 @@
 #define ENEMY_ANIM_WALK_SPEED   10U
 
 extern const palette_color_t enemy_palettes[4];
-extern const uint8_t enemy_tiles[128];
+extern const uint8_t enemy_tiles[79];
 
 #endif
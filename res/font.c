@@ -12,108 +12,50 @@ const palette_color_t font_palettes[4] = {
     RGB8(155,200,234), RGB8(  0,  0,  0), RGB8(170,170,170), RGB8( 85, 85, 85)
 };
 
-/* Font tile data (101 tiles, 16 bytes each) */
+/* Font tile data (101 tiles, pb16-compressed) */
 BANKREF(font_tiles)
-const uint8_t font_tiles[1616] = {
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U,
-    0x28U, 0x00U, 0x28U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x28U, 0x00U, 0x7CU, 0x00U, 0x28U, 0x00U, 0x7CU, 0x00U, 0x28U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x3CU, 0x00U, 0x30U, 0x00U, 0x1CU, 0x00U, 0x78U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x64U, 0x00U, 0x68U, 0x00U, 0x10U, 0x00U, 0x2CU, 0x00U, 0x4CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x30U, 0x00U, 0x48U, 0x00U, 0x30U, 0x00U, 0x48U, 0x00U, 0x34U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x08U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x20U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x28U, 0x00U, 0x10U, 0x00U, 0x28U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x10U, 0x00U, 0x38U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x04U, 0x00U, 0x08U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x4CU, 0x00U, 0x54U, 0x00U, 0x64U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x30U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x18U, 0x00U, 0x20U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x78U, 0x00U, 0x04U, 0x00U, 0x38U, 0x00U, 0x04U, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x08U, 0x00U, 0x18U, 0x00U, 0x28U, 0x00U, 0x7CU, 0x00U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x40U, 0x00U, 0x78U, 0x00U, 0x04U, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x40U, 0x00U, 0x78U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x04U, 0x00U, 0x08U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x3CU, 0x00U, 0x04U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x08U, 0x00U, 0x10U, 0x00U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x20U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x04U, 0x00U, 0x18U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x4CU, 0x00U, 0x54U, 0x00U, 0x5CU, 0x00U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x7CU, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x78U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x40U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x78U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x40U, 0x00U, 0x78U, 0x00U, 0x40U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x40U, 0x00U, 0x78U, 0x00U, 0x40U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x40U, 0x00U, 0x5CU, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x44U, 0x00U, 0x7CU, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x0CU, 0x00U, 0x04U, 0x00U, 0x04U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x48U, 0x00U, 0x50U, 0x00U, 0x60U, 0x00U, 0x50U, 0x00U, 0x48U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x40U, 0x00U, 0x40U, 0x00U, 0x40U, 0x00U, 0x40U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x6CU, 0x00U, 0x54U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x64U, 0x00U, 0x54U, 0x00U, 0x4CU, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x78U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x40U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x44U, 0x00U, 0x54U, 0x00U, 0x48U, 0x00U, 0x34U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x78U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x50U, 0x00U, 0x48U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x3CU, 0x00U, 0x40U, 0x00U, 0x38U, 0x00U, 0x04U, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x44U, 0x00U, 0x28U, 0x00U, 0x28U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x44U, 0x00U, 0x54U, 0x00U, 0x6CU, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x28U, 0x00U, 0x10U, 0x00U, 0x28U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x44U, 0x00U, 0x28U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x08U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x30U, 0x00U, 0x20U, 0x00U, 0x20U, 0x00U, 0x20U, 0x00U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x40U, 0x00U, 0x20U, 0x00U, 0x10U, 0x00U, 0x08U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x18U, 0x00U, 0x08U, 0x00U, 0x08U, 0x00U, 0x08U, 0x00U, 0x18U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x28U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U,
-    0x20U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x38U, 0x00U, 0x04U, 0x00U, 0x3CU, 0x00U, 0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x40U, 0x00U, 0x78U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x38U, 0x00U, 0x40U, 0x00U, 0x40U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x04U, 0x00U, 0x3CU, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x38U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x18U, 0x00U, 0x20U, 0x00U, 0x70U, 0x00U, 0x20U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x3CU, 0x00U, 0x44U, 0x00U, 0x3CU, 0x00U, 0x04U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x40U, 0x00U, 0x78U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x08U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x08U, 0x00U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x40U, 0x00U, 0x48U, 0x00U, 0x50U, 0x00U, 0x60U, 0x00U, 0x58U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x30U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x68U, 0x00U, 0x54U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x78U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x38U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x78U, 0x00U, 0x44U, 0x00U, 0x78U, 0x00U, 0x40U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x3CU, 0x00U, 0x44U, 0x00U, 0x3CU, 0x00U, 0x04U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x2CU, 0x00U, 0x30U, 0x00U, 0x20U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x3CU, 0x00U, 0x60U, 0x00U, 0x1CU, 0x00U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x20U, 0x00U, 0x70U, 0x00U, 0x20U, 0x00U, 0x24U, 0x00U, 0x18U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x44U, 0x00U, 0x44U, 0x00U, 0x28U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x44U, 0x00U, 0x54U, 0x00U, 0x6CU, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x44U, 0x00U, 0x28U, 0x00U, 0x10U, 0x00U, 0x28U, 0x00U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x44U, 0x00U, 0x28U, 0x00U, 0x18U, 0x00U, 0x08U, 0x00U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x7CU, 0x00U, 0x18U, 0x00U, 0x30U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x08U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x10U, 0x00U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U,
-    0x20U, 0x00U, 0x10U, 0x00U, 0x08U, 0x00U, 0x10U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x00U, 0x00U, 0x24U, 0x00U, 0x54U, 0x00U, 0x48U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x7CU, 0x00U, 0x7CU, 0x00U, 0x7CU, 0x00U, 0x7CU, 0x00U, 0x7CU, 0x00U, 0x7CU, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x38U, 0x00U, 0x7CU, 0x00U, 0xFEU, 0x00U, 0x7CU, 0x00U, 0x28U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U,
-    0x38U, 0x00U, 0x38U, 0x00U, 0xFEU, 0x00U, 0x7CU, 0x00U, 0x38U, 0x00U, 0x28U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U,
-    0x6CU, 0x00U, 0xFEU, 0x00U, 0xFEU, 0x00U, 0x7CU, 0x00U, 0x38U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
-    0x10U, 0x00U, 0x38U, 0x00U, 0x7CU, 0x00U, 0xFEU, 0x00U, 0x7CU, 0x00U, 0x38U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U,
-    0x40U, 0x00U, 0x60U, 0x00U, 0x70U, 0x00U, 0x78U, 0x00U, 0x70U, 0x00U, 0x60U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U
+const uint8_t font_tiles[684] = {
+    0xFFU, 0xFFU, 0x7FU, 0x10U, 0xD5U, 0x00U, 0x10U, 0x00U, 0x77U, 0x28U, 0x00U, 0xFFU, 0x55U, 0x28U, 0x7CU, 0x28U,
+    0x7CU, 0x5FU, 0x28U, 0x00U, 0x55U, 0x10U, 0x3CU, 0x30U, 0x1CU, 0x57U, 0x78U, 0x10U, 0x00U, 0x55U, 0x64U, 0x68U,
+    0x10U, 0x2CU, 0x5FU, 0x4CU, 0x00U, 0x55U, 0x30U, 0x48U, 0x30U, 0x48U, 0x5FU, 0x34U, 0x00U, 0x77U, 0x10U, 0x00U,
+    0xFFU, 0x5FU, 0x08U, 0x10U, 0x5FU, 0x08U, 0x00U, 0x5FU, 0x20U, 0x10U, 0x5FU, 0x20U, 0x00U, 0xD5U, 0x28U, 0x10U,
+    0x28U, 0x7FU, 0x00U, 0xD5U, 0x10U, 0x38U, 0x10U, 0x7FU, 0x00U, 0xFFU, 0x77U, 0x10U, 0x00U, 0xF5U, 0x38U, 0x00U,
+    0xFFU, 0xFFU, 0xD7U, 0x10U, 0x00U, 0x55U, 0x04U, 0x08U, 0x10U, 0x20U, 0x5FU, 0x40U, 0x00U, 0x55U, 0x38U, 0x4CU,
+    0x54U, 0x64U, 0x5FU, 0x38U, 0x00U, 0x57U, 0x10U, 0x30U, 0x10U, 0x5FU, 0x38U, 0x00U, 0x55U, 0x38U, 0x44U, 0x18U,
+    0x20U, 0x5FU, 0x7CU, 0x00U, 0x55U, 0x78U, 0x04U, 0x38U, 0x04U, 0x5FU, 0x78U, 0x00U, 0x55U, 0x08U, 0x18U, 0x28U,
+    0x7CU, 0x5FU, 0x08U, 0x00U, 0x55U, 0x7CU, 0x40U, 0x78U, 0x04U, 0x5FU, 0x78U, 0x00U, 0x55U, 0x38U, 0x40U, 0x78U,
+    0x44U, 0x5FU, 0x38U, 0x00U, 0x55U, 0x7CU, 0x04U, 0x08U, 0x10U, 0x5FU, 0x20U, 0x00U, 0x55U, 0x38U, 0x44U, 0x38U,
+    0x44U, 0x5FU, 0x38U, 0x00U, 0x55U, 0x38U, 0x44U, 0x3CU, 0x04U, 0x5FU, 0x38U, 0x00U, 0xD5U, 0x10U, 0x00U, 0x10U,
+    0x7FU, 0x00U, 0xD5U, 0x10U, 0x00U, 0x10U, 0xDFU, 0x00U, 0xD5U, 0x08U, 0x10U, 0x08U, 0x7FU, 0x00U, 0xD5U, 0x38U,
+    0x00U, 0x38U, 0x7FU, 0x00U, 0xD5U, 0x20U, 0x10U, 0x20U, 0x7FU, 0x00U, 0x55U, 0x38U, 0x04U, 0x18U, 0x00U, 0x5FU,
+    0x10U, 0x00U, 0x55U, 0x38U, 0x4CU, 0x54U, 0x5CU, 0x5FU, 0x30U, 0x00U, 0x55U, 0x38U, 0x44U, 0x7CU, 0x44U, 0xDFU,
+    0x00U, 0x55U, 0x78U, 0x44U, 0x78U, 0x44U, 0x5FU, 0x78U, 0x00U, 0x55U, 0x38U, 0x44U, 0x40U, 0x44U, 0x5FU, 0x38U,
+    0x00U, 0x5FU, 0x78U, 0x44U, 0x5FU, 0x78U, 0x00U, 0x55U, 0x7CU, 0x40U, 0x78U, 0x40U, 0x5FU, 0x7CU, 0x00U, 0x55U,
+    0x7CU, 0x40U, 0x78U, 0x40U, 0xDFU, 0x00U, 0x55U, 0x38U, 0x40U, 0x5CU, 0x44U, 0x5FU, 0x38U, 0x00U, 0x75U, 0x44U,
+    0x7CU, 0x44U, 0xDFU, 0x00U, 0x5FU, 0x7CU, 0x10U, 0x5FU, 0x7CU, 0x00U, 0x5DU, 0x0CU, 0x04U, 0x44U, 0x5FU, 0x38U,
+    0x00U, 0x55U, 0x48U, 0x50U, 0x60U, 0x50U, 0x5FU, 0x48U, 0x00U, 0x7FU, 0x40U, 0x5FU, 0x7CU, 0x00U, 0x55U, 0x44U,
+    0x6CU, 0x54U, 0x44U, 0xDFU, 0x00U, 0x55U, 0x44U, 0x64U, 0x54U, 0x4CU, 0x5FU, 0x44U, 0x00U, 0x5FU, 0x38U, 0x44U,
+    0x5FU, 0x38U, 0x00U, 0x55U, 0x78U, 0x44U, 0x78U, 0x40U, 0xDFU, 0x00U, 0x55U, 0x38U, 0x44U, 0x54U, 0x48U, 0x5FU,
+    0x34U, 0x00U, 0x55U, 0x78U, 0x44U, 0x78U, 0x50U, 0x5FU, 0x48U, 0x00U, 0x55U, 0x3CU, 0x40U, 0x38U, 0x04U, 0x5FU,
+    0x78U, 0x00U, 0x5FU, 0x7CU, 0x10U, 0xDFU, 0x00U, 0x7FU, 0x44U, 0x5FU, 0x38U, 0x00U, 0x77U, 0x44U, 0x28U, 0x5FU,
+    0x10U, 0x00U, 0x75U, 0x44U, 0x54U, 0x6CU, 0x5FU, 0x44U, 0x00U, 0x55U, 0x44U, 0x28U, 0x10U, 0x28U, 0x5FU, 0x44U,
+    0x00U, 0x57U, 0x44U, 0x28U, 0x10U, 0xDFU, 0x00U, 0x55U, 0x7CU, 0x08U, 0x10U, 0x20U, 0x5FU, 0x7CU, 0x00U, 0x5FU,
+    0x30U, 0x20U, 0x5FU, 0x30U, 0x00U, 0x55U, 0x40U, 0x20U, 0x10U, 0x08U, 0x5FU, 0x04U, 0x00U, 0x5FU, 0x18U, 0x08U,
+    0x5FU, 0x18U, 0x00U, 0x57U, 0x10U, 0x28U, 0x00U, 0xFFU, 0xFFU, 0xF5U, 0x7CU, 0x00U, 0x57U, 0x20U, 0x10U, 0x00U,
+    0xFFU, 0xD5U, 0x38U, 0x04U, 0x3CU, 0xDFU, 0x00U, 0x57U, 0x40U, 0x78U, 0x44U, 0x5FU, 0x78U, 0x00U, 0xD7U, 0x38U,
+    0x40U, 0x5FU, 0x38U, 0x00U, 0x57U, 0x04U, 0x3CU, 0x44U, 0x5FU, 0x3CU, 0x00U, 0xD5U, 0x38U, 0x44U, 0x78U, 0x5FU,
+    0x38U, 0x00U, 0x55U, 0x18U, 0x20U, 0x70U, 0x20U, 0xDFU, 0x00U, 0xD5U, 0x3CU, 0x44U, 0x3CU, 0x57U, 0x04U, 0x38U,
+    0x00U, 0x57U, 0x40U, 0x78U, 0x44U, 0xDFU, 0x00U, 0xD5U, 0x10U, 0x00U, 0x10U, 0xDFU, 0x00U, 0xD5U, 0x08U, 0x00U,
+    0x08U, 0xD7U, 0x30U, 0x00U, 0x55U, 0x40U, 0x48U, 0x50U, 0x60U, 0x5FU, 0x58U, 0x00U, 0x5FU, 0x30U, 0x10U, 0x5FU,
+    0x38U, 0x00U, 0xD5U, 0x68U, 0x54U, 0x44U, 0xDFU, 0x00U, 0xD7U, 0x78U, 0x44U, 0xDFU, 0x00U, 0xD7U, 0x38U, 0x44U,
+    0x5FU, 0x38U, 0x00U, 0xD5U, 0x78U, 0x44U, 0x78U, 0x77U, 0x40U, 0x00U, 0xD5U, 0x3CU, 0x44U, 0x3CU, 0x77U, 0x04U,
+    0x00U, 0xD5U, 0x2CU, 0x30U, 0x20U, 0xDFU, 0x00U, 0xD5U, 0x3CU, 0x60U, 0x1CU, 0x5FU, 0x78U, 0x00U, 0x55U, 0x20U,
+    0x70U, 0x20U, 0x24U, 0x5FU, 0x18U, 0x00U, 0xDFU, 0x44U, 0x5FU, 0x3CU, 0x00U, 0xDDU, 0x44U, 0x28U, 0x5FU, 0x10U,
+    0x00U, 0xD5U, 0x44U, 0x54U, 0x6CU, 0x5FU, 0x44U, 0x00U, 0xD5U, 0x44U, 0x28U, 0x10U, 0x57U, 0x28U, 0x44U, 0x00U,
+    0xD5U, 0x44U, 0x28U, 0x18U, 0x57U, 0x08U, 0x30U, 0x00U, 0xD5U, 0x7CU, 0x18U, 0x30U, 0x5FU, 0x7CU, 0x00U, 0x55U,
+    0x08U, 0x10U, 0x20U, 0x10U, 0x5FU, 0x08U, 0x00U, 0x7FU, 0x10U, 0xFDU, 0x00U, 0x55U, 0x20U, 0x10U, 0x08U, 0x10U,
+    0x5FU, 0x20U, 0x00U, 0xD5U, 0x24U, 0x54U, 0x48U, 0x7FU, 0x00U, 0x7FU, 0x7CU, 0xFDU, 0x00U, 0x55U, 0x10U, 0x38U,
+    0x7CU, 0xFEU, 0x55U, 0x7CU, 0x28U, 0x7CU, 0x00U, 0x75U, 0x38U, 0xFEU, 0x7CU, 0x55U, 0x38U, 0x28U, 0x7CU, 0x00U,
+    0x5DU, 0x6CU, 0xFEU, 0x7CU, 0x57U, 0x38U, 0x10U, 0x00U, 0x55U, 0x10U, 0x38U, 0x7CU, 0xFEU, 0x55U, 0x7CU, 0x38U,
+    0x10U, 0x00U, 0x55U, 0x40U, 0x60U, 0x70U, 0x78U, 0x55U, 0x70U, 0x60U, 0x40U, 0x00U
 };
@@ -5,9 +5,15 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
 
 #define FONT_TILE_COUNT    101U
 #define FONT_PALETTE_COUNT 1U
+#define FONT_TILE_CODEC    TILE_CODEC_PB16
+#define FONT_TILES_SIZE    684U
+#define FONT_SET_TILES(first)  pb16_set_bkg_data((first), FONT_TILE_COUNT, font_tiles)
+#define FONT_VRAM_LOAD()  vram_load(VRAM_BG, font_tiles, BANK(font_tiles), FONT_TILE_COUNT, FONT_TILE_CODEC)
 
 #define FONT_TILE_SPADE  96U  /* tile offset for spade */
 #define FONT_TILE_CLUB  97U  /* tile offset for club */
@@ -19,6 +25,6 @@ BANKREF_EXTERN(font_palettes)
 BANKREF_EXTERN(font_tiles)
 
 extern const palette_color_t font_palettes[4];
-extern const uint8_t font_tiles[1616];
+extern const uint8_t font_tiles[684];
 
 #endif
@@ -0,0 +1,732 @@
+/* Auto-generated by tools/gen_font.py - edit that script to change. */
+#pragma bank 255
+
+#include <gbdk/platform.h>
+#include "font_vwf.h"
+
+/* Advance per glyph in pixels, 1-pixel gap included */
+static const uint8_t font_vwf_widths[101] = {
+    0x03U, 0x02U, 0x04U, 0x06U, 0x06U, 0x06U, 0x06U, 0x02U, 0x03U, 0x03U, 0x04U, 0x04U, 0x02U, 0x04U, 0x02U, 0x06U,
+    0x06U, 0x04U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x02U, 0x02U, 0x03U, 0x04U, 0x03U, 0x05U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x05U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x03U, 0x06U, 0x03U, 0x04U, 0x06U,
+    0x03U, 0x05U, 0x06U, 0x05U, 0x06U, 0x06U, 0x05U, 0x06U, 0x06U, 0x02U, 0x04U, 0x05U, 0x04U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x05U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x04U, 0x02U, 0x04U, 0x06U, 0x06U,
+    0x08U, 0x08U, 0x08U, 0x08U, 0x05U
+};
+
+/* 101 glyphs x 8 pixel offsets x (7 pen-tile rows + 7 spill rows) */
+static const uint8_t font_vwf_glyphs[11312] = {
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x40U, 0x40U, 0x40U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x20U, 0x20U,
+    0x20U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x00U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x00U, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x00U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0xA0U, 0xA0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x50U, 0x50U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x28U, 0x28U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x14U, 0x14U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0AU, 0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x05U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x50U, 0xF8U, 0x50U, 0xF8U, 0x50U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x28U, 0x7CU,
+    0x28U, 0x7CU, 0x28U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x14U, 0x3EU, 0x14U, 0x3EU,
+    0x14U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0AU, 0x1FU, 0x0AU, 0x1FU, 0x0AU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x0FU, 0x05U, 0x0FU, 0x05U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x07U, 0x02U, 0x07U, 0x02U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x80U,
+    0xC0U, 0x80U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x03U, 0x01U, 0x00U, 0x00U, 0x40U, 0xE0U, 0x40U, 0xE0U, 0x40U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0xA0U, 0xF0U, 0xA0U, 0xF0U, 0xA0U, 0x00U, 0x00U,
+    0x20U, 0x78U, 0x60U, 0x38U, 0xF0U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x3CU,
+    0x30U, 0x1CU, 0x78U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x1EU, 0x18U, 0x0EU,
+    0x3CU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0FU, 0x0CU, 0x07U, 0x1EU, 0x04U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x07U, 0x06U, 0x03U, 0x0FU, 0x02U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x03U, 0x01U, 0x07U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x00U,
+    0xC0U, 0x80U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x03U, 0x00U, 0x00U, 0x80U, 0xE0U, 0x80U, 0xE0U, 0xC0U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x40U, 0xF0U, 0xC0U, 0x70U, 0xE0U, 0x40U, 0x00U,
+    0xC8U, 0xD0U, 0x20U, 0x58U, 0x98U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x64U, 0x68U,
+    0x10U, 0x2CU, 0x4CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x32U, 0x34U, 0x08U, 0x16U,
+    0x26U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x19U, 0x1AU, 0x04U, 0x0BU, 0x13U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x0DU, 0x02U, 0x05U, 0x09U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x06U, 0x06U, 0x01U, 0x02U, 0x04U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U,
+    0xC0U, 0xC0U, 0x00U, 0x00U, 0x03U, 0x03U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x60U, 0x60U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x90U, 0xA0U, 0x40U, 0xB0U, 0x30U, 0x00U, 0x00U,
+    0x60U, 0x90U, 0x60U, 0x90U, 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x30U, 0x48U,
+    0x30U, 0x48U, 0x34U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x18U, 0x24U, 0x18U, 0x24U,
+    0x1AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x12U, 0x0CU, 0x12U, 0x0DU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x09U, 0x06U, 0x09U, 0x06U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x03U, 0x04U, 0x03U, 0x04U, 0x03U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U,
+    0x80U, 0x40U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U, 0x40U, 0xA0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x20U, 0xD0U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x40U, 0x80U, 0x80U, 0x80U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x40U,
+    0x40U, 0x40U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x20U, 0x20U, 0x20U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x10U, 0x10U, 0x10U, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x08U, 0x08U, 0x08U, 0x04U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x04U, 0x04U, 0x04U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x80U, 0x40U, 0x40U, 0x40U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x20U,
+    0x20U, 0x20U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x10U, 0x10U, 0x10U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x08U, 0x08U, 0x08U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x04U, 0x04U, 0x04U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x02U, 0x02U, 0x02U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x01U, 0x01U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0xA0U, 0x40U, 0xA0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x50U,
+    0x20U, 0x50U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x28U, 0x10U, 0x28U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x14U, 0x08U, 0x14U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0AU, 0x04U, 0x0AU, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x02U, 0x05U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x80U, 0x40U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x40U, 0xE0U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U,
+    0x70U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x38U, 0x10U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x1CU, 0x08U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0EU, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x07U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x20U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x08U,
+    0x10U, 0x20U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x04U, 0x08U, 0x10U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x04U, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x04U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x10U, 0x20U, 0x40U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x70U, 0x98U, 0xA8U, 0xC8U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x4CU,
+    0x54U, 0x64U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x26U, 0x2AU, 0x32U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x13U, 0x15U, 0x19U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x09U, 0x0AU, 0x0CU, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x05U, 0x06U, 0x03U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x03U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x60U, 0xA0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x30U, 0x50U, 0x90U, 0xE0U, 0x00U, 0x00U,
+    0x40U, 0xC0U, 0x40U, 0x40U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x60U,
+    0x20U, 0x20U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x30U, 0x10U, 0x10U,
+    0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x18U, 0x08U, 0x08U, 0x1CU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0CU, 0x04U, 0x04U, 0x0EU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x06U, 0x02U, 0x02U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x01U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x80U, 0x80U, 0x80U, 0x80U, 0xC0U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0x30U, 0x40U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x18U, 0x20U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x0CU, 0x10U,
+    0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x06U, 0x08U, 0x1FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x03U, 0x04U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x03U, 0x04U, 0x01U, 0x02U, 0x07U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U,
+    0x00U, 0xC0U, 0x00U, 0x00U, 0x01U, 0x02U, 0x00U, 0x01U, 0x03U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x00U, 0xE0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x60U, 0x80U, 0xF0U, 0x00U, 0x00U,
+    0xF0U, 0x08U, 0x70U, 0x08U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U, 0x04U,
+    0x38U, 0x04U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x02U, 0x1CU, 0x02U,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x01U, 0x0EU, 0x01U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U, 0x07U, 0x00U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x03U, 0x00U, 0x07U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x03U, 0x00U, 0x01U, 0x00U, 0x03U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x10U, 0x30U, 0x50U, 0xF8U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x18U,
+    0x28U, 0x7CU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0CU, 0x14U, 0x3EU,
+    0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x06U, 0x0AU, 0x1FU, 0x02U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x05U, 0x0FU, 0x01U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x07U, 0x00U, 0x00U, 0x00U, 0x80U, 0x80U, 0x80U,
+    0xC0U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x00U, 0x00U, 0x00U, 0x40U, 0xC0U, 0x40U, 0xE0U, 0x40U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x20U, 0x60U, 0xA0U, 0xF0U, 0x20U, 0x00U, 0x00U,
+    0xF8U, 0x80U, 0xF0U, 0x08U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x40U,
+    0x78U, 0x04U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x20U, 0x3CU, 0x02U,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x10U, 0x1EU, 0x01U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x00U, 0x0FU, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x00U, 0x07U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x80U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x00U, 0x03U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xC0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0xF0U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x70U, 0x80U, 0xF0U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x40U,
+    0x78U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x20U, 0x3CU, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x10U, 0x1EU, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x0FU, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x07U, 0x04U, 0x03U, 0x00U, 0x00U, 0x80U, 0x00U, 0x80U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x03U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x00U, 0xC0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0xF8U, 0x08U, 0x10U, 0x20U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x04U,
+    0x08U, 0x10U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x02U, 0x04U, 0x08U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x01U, 0x02U, 0x04U, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U, 0x01U, 0x02U, 0x04U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0xC0U, 0x40U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x20U, 0x40U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x10U, 0x20U, 0x40U, 0x80U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0x70U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x38U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x1CU, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x0EU, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x07U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x03U, 0x04U, 0x03U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0x78U, 0x08U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x3CU, 0x04U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x1EU, 0x02U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x0FU, 0x01U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x07U, 0x00U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x03U, 0x00U, 0x03U, 0x00U, 0x00U, 0x80U, 0x40U, 0xC0U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xE0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xF0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U,
+    0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x00U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U,
+    0x00U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x20U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x10U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x00U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x40U, 0x80U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U,
+    0x40U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x20U, 0x10U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x10U, 0x08U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x08U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x04U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0xE0U, 0x00U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x70U,
+    0x00U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x00U, 0x38U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x00U, 0x1CU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x00U, 0x0EU, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x00U, 0xC0U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x40U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U,
+    0x20U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x10U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x08U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x04U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x02U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0xE0U, 0x10U, 0x60U, 0x00U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x70U, 0x08U,
+    0x30U, 0x00U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x04U, 0x18U, 0x00U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x02U, 0x0CU, 0x00U, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x01U, 0x06U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x03U, 0x00U, 0x02U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x70U, 0x98U, 0xA8U, 0xB8U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x4CU,
+    0x54U, 0x5CU, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x26U, 0x2AU, 0x2EU,
+    0x18U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x13U, 0x15U, 0x17U, 0x0CU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x09U, 0x0AU, 0x0BU, 0x06U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x05U, 0x05U, 0x03U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x40U,
+    0xC0U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x60U, 0xA0U, 0xE0U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x30U, 0x50U, 0x70U, 0xC0U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0xF8U, 0x88U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x7CU, 0x44U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x3EU, 0x22U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x1FU, 0x11U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x0FU, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x03U, 0x04U, 0x07U, 0x04U, 0x04U, 0x00U, 0x00U, 0x80U, 0x40U, 0xC0U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0x01U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xE0U, 0x20U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xF0U, 0x10U, 0x10U, 0x00U, 0x00U,
+    0xF0U, 0x88U, 0xF0U, 0x88U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U, 0x44U,
+    0x78U, 0x44U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x22U, 0x3CU, 0x22U,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x11U, 0x1EU, 0x11U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x08U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x04U, 0x07U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x02U, 0x03U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0x80U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x40U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x20U, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x10U, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x80U, 0x40U, 0x00U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x00U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x00U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0xF0U, 0x88U, 0x88U, 0x88U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U, 0x44U,
+    0x44U, 0x44U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x22U, 0x22U, 0x22U,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x11U, 0x11U, 0x11U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x08U, 0x08U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x04U, 0x04U, 0x07U, 0x00U, 0x00U, 0x80U, 0x40U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x03U, 0x02U, 0x02U, 0x02U, 0x03U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x20U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x10U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0xF8U, 0x80U, 0xF0U, 0x80U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x40U,
+    0x78U, 0x40U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x20U, 0x3CU, 0x20U,
+    0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x10U, 0x1EU, 0x10U, 0x1FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x08U, 0x0FU, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x04U, 0x07U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x80U,
+    0x00U, 0xC0U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x02U, 0x03U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xC0U, 0x00U, 0xE0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xF0U, 0x00U, 0xE0U, 0x00U, 0xF0U, 0x00U, 0x00U,
+    0xF8U, 0x80U, 0xF0U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x40U,
+    0x78U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x20U, 0x3CU, 0x20U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x10U, 0x1EU, 0x10U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x08U, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x04U, 0x04U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xC0U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xF0U, 0x00U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x70U, 0x80U, 0xB8U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x40U,
+    0x5CU, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x20U, 0x2EU, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x10U, 0x17U, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x0BU, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x05U, 0x04U, 0x03U, 0x00U, 0x00U, 0x80U, 0x00U, 0xC0U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x00U, 0xE0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x00U, 0x70U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x88U, 0x88U, 0xF8U, 0x88U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x44U,
+    0x7CU, 0x44U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x22U, 0x3EU, 0x22U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x11U, 0x1FU, 0x11U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x0FU, 0x08U, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x04U, 0x04U, 0x07U, 0x04U, 0x04U, 0x00U, 0x00U, 0x40U, 0x40U, 0xC0U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0x02U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0x20U, 0x20U, 0xE0U, 0x20U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x10U, 0x10U, 0xF0U, 0x10U, 0x10U, 0x00U, 0x00U,
+    0xF8U, 0x20U, 0x20U, 0x20U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x10U,
+    0x10U, 0x10U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x08U, 0x08U, 0x08U,
+    0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x04U, 0x04U, 0x04U, 0x1FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x02U, 0x02U, 0x02U, 0x0FU, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x07U, 0x01U, 0x01U, 0x01U, 0x07U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x00U,
+    0x00U, 0xC0U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0xE0U, 0x80U, 0x80U, 0x80U, 0xE0U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0xF0U, 0x40U, 0x40U, 0x40U, 0xF0U, 0x00U, 0x00U,
+    0x18U, 0x08U, 0x08U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x04U,
+    0x04U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x02U, 0x02U, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x01U, 0x01U, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x08U, 0x07U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x03U, 0x00U, 0x00U, 0xC0U, 0x40U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x60U, 0x20U, 0x20U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x30U, 0x10U, 0x10U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x90U, 0xA0U, 0xC0U, 0xA0U, 0x90U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x48U, 0x50U,
+    0x60U, 0x50U, 0x48U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x24U, 0x28U, 0x30U, 0x28U,
+    0x24U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x14U, 0x18U, 0x14U, 0x12U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x0AU, 0x0CU, 0x0AU, 0x09U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x05U, 0x06U, 0x05U, 0x04U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x00U, 0x02U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U, 0x80U, 0x40U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x40U, 0x20U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x40U, 0x40U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x20U, 0x20U,
+    0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0x10U, 0x10U, 0x1FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x08U, 0x08U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x04U, 0x04U, 0x04U, 0x04U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0xC0U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x00U, 0x00U,
+    0x88U, 0xD8U, 0xA8U, 0x88U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x6CU,
+    0x54U, 0x44U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x36U, 0x2AU, 0x22U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x1BU, 0x15U, 0x11U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x0DU, 0x0AU, 0x08U, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x04U, 0x06U, 0x05U, 0x04U, 0x04U, 0x00U, 0x00U, 0x40U, 0xC0U, 0x40U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0x02U, 0x03U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x20U, 0x60U, 0xA0U, 0x20U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x10U, 0xB0U, 0x50U, 0x10U, 0x10U, 0x00U, 0x00U,
+    0x88U, 0xC8U, 0xA8U, 0x98U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x64U,
+    0x54U, 0x4CU, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x32U, 0x2AU, 0x26U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x19U, 0x15U, 0x13U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x0CU, 0x0AU, 0x09U, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x04U, 0x06U, 0x05U, 0x04U, 0x04U, 0x00U, 0x00U, 0x40U, 0x40U, 0x40U,
+    0xC0U, 0x40U, 0x00U, 0x00U, 0x02U, 0x03U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x20U, 0x20U, 0xA0U, 0x60U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x10U, 0x90U, 0x50U, 0x30U, 0x10U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0x88U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x44U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x22U, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x11U, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x80U, 0x40U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x20U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x10U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0xF0U, 0x88U, 0xF0U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U, 0x44U,
+    0x78U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x22U, 0x3CU, 0x20U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x11U, 0x1EU, 0x10U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x04U, 0x04U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x70U, 0x88U, 0xA8U, 0x90U, 0x68U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x44U,
+    0x54U, 0x48U, 0x34U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x2AU, 0x24U,
+    0x1AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x15U, 0x12U, 0x0DU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x0AU, 0x09U, 0x06U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x03U, 0x04U, 0x05U, 0x04U, 0x03U, 0x00U, 0x00U, 0x80U, 0x40U, 0x40U,
+    0x80U, 0x40U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xA0U, 0x40U, 0xA0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x50U, 0x20U, 0xD0U, 0x00U, 0x00U,
+    0xF0U, 0x88U, 0xF0U, 0xA0U, 0x90U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U, 0x44U,
+    0x78U, 0x50U, 0x48U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x22U, 0x3CU, 0x28U,
+    0x24U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x11U, 0x1EU, 0x14U, 0x12U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x0AU, 0x09U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x05U, 0x04U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U,
+    0x00U, 0x80U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x80U, 0x40U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x40U, 0x20U, 0x00U, 0x00U,
+    0x78U, 0x80U, 0x70U, 0x08U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x40U,
+    0x38U, 0x04U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x20U, 0x1CU, 0x02U,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x10U, 0x0EU, 0x01U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x07U, 0x00U, 0x0FU, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x03U, 0x00U, 0x07U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x80U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x03U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xC0U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0xF0U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0xF8U, 0x20U, 0x20U, 0x20U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x10U,
+    0x10U, 0x10U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x08U, 0x08U, 0x08U,
+    0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x04U, 0x04U, 0x04U, 0x04U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x02U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x80U, 0x80U, 0x80U, 0x80U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x40U, 0x40U, 0x40U, 0x40U, 0x00U, 0x00U,
+    0x88U, 0x88U, 0x88U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x44U,
+    0x44U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x22U, 0x22U, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x11U, 0x11U, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x40U, 0x40U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x20U, 0x20U, 0x20U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0x10U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x88U, 0x88U, 0x50U, 0x50U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x44U,
+    0x28U, 0x28U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x22U, 0x14U, 0x14U,
+    0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x11U, 0x0AU, 0x0AU, 0x04U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x05U, 0x05U, 0x02U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x40U, 0x40U, 0x80U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x40U, 0x40U, 0x80U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0xA0U, 0xA0U, 0x40U, 0x00U, 0x00U,
+    0x88U, 0x88U, 0xA8U, 0xD8U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x44U,
+    0x54U, 0x6CU, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x22U, 0x2AU, 0x36U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x11U, 0x15U, 0x1BU, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x0AU, 0x0DU, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x04U, 0x04U, 0x05U, 0x06U, 0x04U, 0x00U, 0x00U, 0x40U, 0x40U, 0x40U,
+    0xC0U, 0x40U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x03U, 0x02U, 0x00U, 0x00U, 0x20U, 0x20U, 0xA0U, 0x60U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x10U, 0x10U, 0x50U, 0xB0U, 0x10U, 0x00U, 0x00U,
+    0x88U, 0x50U, 0x20U, 0x50U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x28U,
+    0x10U, 0x28U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x14U, 0x08U, 0x14U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x0AU, 0x04U, 0x0AU, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x05U, 0x02U, 0x05U, 0x08U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x04U, 0x02U, 0x01U, 0x02U, 0x04U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U,
+    0x80U, 0x40U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x40U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x10U, 0xA0U, 0x40U, 0xA0U, 0x10U, 0x00U, 0x00U,
+    0x88U, 0x50U, 0x20U, 0x20U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U, 0x28U,
+    0x10U, 0x10U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x14U, 0x08U, 0x08U,
+    0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x0AU, 0x04U, 0x04U, 0x04U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x05U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x02U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x80U, 0x80U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0xA0U, 0x40U, 0x40U, 0x40U, 0x00U, 0x00U,
+    0xF8U, 0x10U, 0x20U, 0x40U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x08U,
+    0x10U, 0x20U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x04U, 0x08U, 0x10U,
+    0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x02U, 0x04U, 0x08U, 0x1FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x01U, 0x02U, 0x04U, 0x0FU, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x07U, 0x00U, 0x01U, 0x02U, 0x07U, 0x00U, 0x00U, 0xC0U, 0x80U, 0x00U,
+    0x00U, 0xC0U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x01U, 0x03U, 0x00U, 0x00U, 0xE0U, 0x40U, 0x80U, 0x00U, 0xE0U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0xF0U, 0x20U, 0x40U, 0x80U, 0xF0U, 0x00U, 0x00U,
+    0xC0U, 0x80U, 0x80U, 0x80U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x60U, 0x40U,
+    0x40U, 0x40U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x30U, 0x20U, 0x20U, 0x20U,
+    0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x18U, 0x10U, 0x10U, 0x10U, 0x18U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x08U, 0x08U, 0x08U, 0x0CU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x04U, 0x04U, 0x04U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x02U, 0x02U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x20U,
+    0x10U, 0x08U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x10U, 0x08U, 0x04U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x04U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x04U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x40U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U, 0x20U, 0x10U, 0x00U, 0x00U,
+    0xC0U, 0x40U, 0x40U, 0x40U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x60U, 0x20U,
+    0x20U, 0x20U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x30U, 0x10U, 0x10U, 0x10U,
+    0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x18U, 0x08U, 0x08U, 0x08U, 0x18U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x04U, 0x04U, 0x04U, 0x0CU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x02U, 0x02U, 0x02U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x01U, 0x01U, 0x01U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U,
+    0x40U, 0xA0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x50U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x28U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x14U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x05U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x1FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF0U,
+    0x80U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0xE0U, 0x10U, 0xF0U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x70U,
+    0x08U, 0x78U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x04U, 0x3CU,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x02U, 0x1EU, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x01U, 0x0FU, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x00U, 0x07U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x03U, 0x03U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U, 0xC0U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xE0U, 0xE0U, 0x00U, 0x00U,
+    0x80U, 0xF0U, 0x88U, 0x88U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x78U,
+    0x44U, 0x44U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x3CU, 0x22U, 0x22U,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x1EU, 0x11U, 0x11U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x0FU, 0x08U, 0x08U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x04U, 0x07U, 0x04U, 0x04U, 0x07U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x02U, 0x03U, 0x02U, 0x02U, 0x03U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x00U, 0x70U, 0x80U, 0x80U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U,
+    0x40U, 0x40U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x20U, 0x20U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x10U, 0x10U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x00U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x00U, 0x00U, 0xE0U, 0x00U, 0x00U,
+    0x08U, 0x78U, 0x88U, 0x88U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x3CU,
+    0x44U, 0x44U, 0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x1EU, 0x22U, 0x22U,
+    0x1EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x0FU, 0x11U, 0x11U, 0x0FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x40U, 0xC0U, 0x40U,
+    0x40U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x20U, 0xE0U, 0x20U, 0x20U, 0xE0U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x10U, 0xF0U, 0x10U, 0x10U, 0xF0U, 0x00U, 0x00U,
+    0x00U, 0x70U, 0x88U, 0xF0U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U,
+    0x44U, 0x78U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x3CU,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x1EU, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x0FU, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x07U, 0x03U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x03U, 0x01U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0xE0U, 0x00U, 0x00U,
+    0x30U, 0x40U, 0xE0U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x18U, 0x20U,
+    0x70U, 0x20U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x10U, 0x38U, 0x10U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x08U, 0x1CU, 0x08U, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x0EU, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x07U, 0x02U, 0x02U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x01U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x60U, 0x80U, 0xC0U, 0x80U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x78U, 0x88U, 0x78U, 0x08U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU,
+    0x44U, 0x3CU, 0x04U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x22U, 0x1EU,
+    0x02U, 0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x11U, 0x0FU, 0x01U, 0x0EU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x07U, 0x00U, 0x07U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x03U, 0x00U, 0x03U, 0x00U, 0x00U, 0xC0U, 0x40U,
+    0xC0U, 0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x20U, 0xE0U, 0x20U,
+    0xC0U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x10U, 0xF0U, 0x10U, 0xE0U, 0x00U,
+    0x80U, 0xF0U, 0x88U, 0x88U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x78U,
+    0x44U, 0x44U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x3CU, 0x22U, 0x22U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x1EU, 0x11U, 0x11U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x0FU, 0x08U, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x04U, 0x07U, 0x04U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0x02U, 0x03U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x20U, 0x20U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x10U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U,
+    0x00U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x00U, 0x20U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x10U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x00U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x00U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x20U, 0x00U, 0x20U, 0x20U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U,
+    0x00U, 0x10U, 0x10U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x00U, 0x08U,
+    0x08U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x00U, 0x04U, 0x04U, 0x18U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x00U, 0x02U, 0x02U, 0x0CU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x01U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x00U, 0x80U, 0x00U, 0x80U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x40U, 0x00U, 0x40U, 0x40U, 0x80U, 0x00U,
+    0x80U, 0x90U, 0xA0U, 0xC0U, 0xB0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x48U,
+    0x50U, 0x60U, 0x58U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x24U, 0x28U, 0x30U,
+    0x2CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x12U, 0x14U, 0x18U, 0x16U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x09U, 0x0AU, 0x0CU, 0x0BU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x05U, 0x06U, 0x05U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x03U, 0x02U, 0x00U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U, 0xC0U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x60U, 0x00U, 0x00U,
+    0xC0U, 0x40U, 0x40U, 0x40U, 0xE0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x60U, 0x20U,
+    0x20U, 0x20U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x30U, 0x10U, 0x10U, 0x10U,
+    0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x18U, 0x08U, 0x08U, 0x08U, 0x1CU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x04U, 0x04U, 0x04U, 0x0EU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x02U, 0x02U, 0x02U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x01U, 0x01U, 0x01U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x80U, 0x80U, 0x80U, 0x80U, 0xC0U, 0x00U, 0x00U,
+    0x00U, 0xD0U, 0xA8U, 0x88U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x68U,
+    0x54U, 0x44U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x34U, 0x2AU, 0x22U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1AU, 0x15U, 0x11U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x0AU, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x06U, 0x05U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x03U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x40U, 0xA0U, 0x20U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xA0U, 0x50U, 0x10U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0xF0U, 0x88U, 0x88U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U,
+    0x44U, 0x44U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x22U, 0x22U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x11U, 0x11U, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x03U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x20U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x10U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x70U, 0x88U, 0x88U, 0x70U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U,
+    0x44U, 0x44U, 0x38U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x22U, 0x22U,
+    0x1CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x11U, 0x11U, 0x0EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x20U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x10U, 0x10U, 0xE0U, 0x00U, 0x00U,
+    0x00U, 0xF0U, 0x88U, 0xF0U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x78U,
+    0x44U, 0x78U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU, 0x22U, 0x3CU,
+    0x20U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x11U, 0x1EU, 0x10U, 0x10U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x08U, 0x0FU, 0x08U, 0x08U, 0x00U, 0x00U,
+    0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x04U, 0x07U, 0x04U, 0x04U, 0x00U, 0x00U, 0x80U, 0x40U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0xC0U, 0x20U, 0xC0U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0xE0U, 0x10U, 0xE0U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x78U, 0x88U, 0x78U, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU,
+    0x44U, 0x3CU, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x22U, 0x1EU,
+    0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x11U, 0x0FU, 0x01U, 0x01U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x03U, 0x04U, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x40U,
+    0xC0U, 0x40U, 0x40U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x20U, 0xE0U, 0x20U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x10U, 0xF0U, 0x10U, 0x10U, 0x00U,
+    0x00U, 0xB0U, 0xC0U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x58U,
+    0x60U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x2CU, 0x30U, 0x20U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x16U, 0x18U, 0x10U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x0CU, 0x08U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x06U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x03U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x60U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x78U, 0xC0U, 0x38U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3CU,
+    0x60U, 0x1CU, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1EU, 0x30U, 0x0EU,
+    0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x18U, 0x07U, 0x1EU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x0CU, 0x03U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x06U, 0x01U, 0x07U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x00U,
+    0xC0U, 0x80U, 0x00U, 0x00U, 0x00U, 0x01U, 0x03U, 0x00U, 0x03U, 0x00U, 0x00U, 0x00U, 0xE0U, 0x00U, 0xE0U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x80U, 0x70U, 0xE0U, 0x00U, 0x00U,
+    0x40U, 0xE0U, 0x40U, 0x48U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x70U,
+    0x20U, 0x24U, 0x18U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x38U, 0x10U, 0x12U,
+    0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x1CU, 0x08U, 0x09U, 0x06U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0EU, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x07U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x40U, 0x80U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x20U, 0xC0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x80U, 0x90U, 0x60U, 0x00U, 0x00U,
+    0x00U, 0x88U, 0x88U, 0x88U, 0x78U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U,
+    0x44U, 0x44U, 0x3CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x22U, 0x22U,
+    0x1EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x11U, 0x11U, 0x0FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x08U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x04U, 0x03U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x40U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x20U, 0xE0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0x10U, 0xF0U, 0x00U, 0x00U,
+    0x00U, 0x88U, 0x88U, 0x50U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U,
+    0x44U, 0x28U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x22U, 0x14U,
+    0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x11U, 0x0AU, 0x04U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x05U, 0x02U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x40U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0xA0U, 0x40U, 0x00U, 0x00U,
+    0x00U, 0x88U, 0xA8U, 0xD8U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U,
+    0x54U, 0x6CU, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x2AU, 0x36U,
+    0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x15U, 0x1BU, 0x11U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x0AU, 0x0DU, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x04U, 0x05U, 0x06U, 0x04U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0xC0U, 0x40U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x03U, 0x02U, 0x00U, 0x00U, 0x00U, 0x20U, 0xA0U, 0x60U, 0x20U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x10U, 0x50U, 0xB0U, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x88U, 0x50U, 0x20U, 0x50U, 0x88U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U,
+    0x28U, 0x10U, 0x28U, 0x44U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x14U, 0x08U,
+    0x14U, 0x22U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x0AU, 0x04U, 0x0AU, 0x11U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x05U, 0x02U, 0x05U, 0x08U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x04U, 0x02U, 0x01U, 0x02U, 0x04U, 0x00U, 0x00U, 0x40U, 0x80U,
+    0x00U, 0x80U, 0x40U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0x20U, 0x40U, 0x80U, 0x40U,
+    0x20U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x10U, 0xA0U, 0x40U, 0xA0U, 0x10U, 0x00U,
+    0x00U, 0x88U, 0x50U, 0x30U, 0x10U, 0x60U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x44U,
+    0x28U, 0x18U, 0x08U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0x14U, 0x0CU,
+    0x04U, 0x18U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0x0AU, 0x06U, 0x02U, 0x0CU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x05U, 0x03U, 0x01U, 0x06U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x02U, 0x01U, 0x00U, 0x03U, 0x00U, 0x00U, 0x40U, 0x80U,
+    0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x20U, 0x40U, 0xC0U, 0x40U,
+    0x80U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0xA0U, 0x60U, 0x20U, 0xC0U, 0x00U,
+    0x00U, 0xF8U, 0x30U, 0x60U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU,
+    0x18U, 0x30U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x0CU, 0x18U,
+    0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x06U, 0x0CU, 0x1FU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x03U, 0x06U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x07U, 0x01U, 0x03U, 0x07U, 0x00U, 0x00U, 0x00U, 0xC0U, 0x80U,
+    0x00U, 0xC0U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0x01U, 0x03U, 0x00U, 0x00U, 0x00U, 0xE0U, 0xC0U, 0x80U, 0xE0U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0xF0U, 0x60U, 0xC0U, 0xF0U, 0x00U, 0x00U,
+    0x20U, 0x40U, 0x80U, 0x40U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x20U,
+    0x40U, 0x20U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x10U, 0x20U, 0x10U,
+    0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x08U, 0x10U, 0x08U, 0x04U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x04U, 0x08U, 0x04U, 0x02U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x04U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x01U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x80U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x80U, 0x00U, 0x80U, 0x40U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x40U, 0x40U, 0x40U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x20U, 0x20U, 0x20U,
+    0x20U, 0x20U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U, 0x10U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x04U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x40U, 0x20U, 0x40U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x20U,
+    0x10U, 0x20U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x10U, 0x08U, 0x10U,
+    0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x08U, 0x04U, 0x08U, 0x10U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x04U, 0x02U, 0x04U, 0x08U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x02U, 0x01U, 0x02U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x01U, 0x00U, 0x01U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x80U, 0x40U, 0x80U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x48U, 0xA8U, 0x90U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x24U,
+    0x54U, 0x48U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0x2AU, 0x24U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x15U, 0x12U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0AU, 0x09U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x05U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x40U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0xA0U, 0x40U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x90U, 0x50U, 0x20U, 0x00U, 0x00U, 0x00U,
+    0xF8U, 0xF8U, 0xF8U, 0xF8U, 0xF8U, 0xF8U, 0xF8U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x7CU, 0x7CU,
+    0x7CU, 0x7CU, 0x7CU, 0x7CU, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x3EU, 0x3EU, 0x3EU, 0x3EU,
+    0x3EU, 0x3EU, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU, 0x1FU,
+    0x1FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x0FU, 0x0FU, 0x0FU, 0x0FU, 0x0FU, 0x0FU, 0x80U,
+    0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x80U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0xC0U, 0xC0U, 0xC0U,
+    0xC0U, 0xC0U, 0xC0U, 0xC0U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0xE0U, 0xE0U, 0xE0U, 0xE0U, 0xE0U,
+    0xE0U, 0xE0U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0xF0U, 0xF0U, 0xF0U, 0xF0U, 0xF0U, 0xF0U, 0xF0U,
+    0x10U, 0x38U, 0x7CU, 0xFEU, 0x7CU, 0x28U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x1CU,
+    0x3EU, 0x7FU, 0x3EU, 0x14U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0EU, 0x1FU, 0x3FU,
+    0x1FU, 0x0AU, 0x1FU, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x07U, 0x0FU, 0x1FU, 0x0FU, 0x05U,
+    0x0FU, 0x00U, 0x00U, 0x80U, 0xC0U, 0x80U, 0x00U, 0x80U, 0x01U, 0x03U, 0x07U, 0x0FU, 0x07U, 0x02U, 0x07U, 0x00U,
+    0x80U, 0xC0U, 0xE0U, 0xC0U, 0x80U, 0xC0U, 0x00U, 0x01U, 0x03U, 0x07U, 0x03U, 0x01U, 0x03U, 0x80U, 0xC0U, 0xE0U,
+    0xF0U, 0xE0U, 0x40U, 0xE0U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x00U, 0x01U, 0x40U, 0xE0U, 0xF0U, 0xF8U, 0xF0U,
+    0xA0U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x20U, 0x70U, 0xF8U, 0xFCU, 0xF8U, 0x50U, 0xF8U,
+    0x38U, 0x38U, 0xFEU, 0x7CU, 0x38U, 0x28U, 0x7CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0x1CU,
+    0x7FU, 0x3EU, 0x1CU, 0x14U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x0EU, 0x3FU, 0x1FU,
+    0x0EU, 0x0AU, 0x1FU, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x07U, 0x1FU, 0x0FU, 0x07U, 0x05U,
+    0x0FU, 0x00U, 0x00U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x80U, 0x03U, 0x03U, 0x0FU, 0x07U, 0x03U, 0x02U, 0x07U, 0x80U,
+    0x80U, 0xE0U, 0xC0U, 0x80U, 0x80U, 0xC0U, 0x01U, 0x01U, 0x07U, 0x03U, 0x01U, 0x01U, 0x03U, 0xC0U, 0xC0U, 0xF0U,
+    0xE0U, 0xC0U, 0x40U, 0xE0U, 0x00U, 0x00U, 0x03U, 0x01U, 0x00U, 0x00U, 0x01U, 0xE0U, 0xE0U, 0xF8U, 0xF0U, 0xE0U,
+    0xA0U, 0xF0U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x70U, 0x70U, 0xFCU, 0xF8U, 0x70U, 0x50U, 0xF8U,
+    0x6CU, 0xFEU, 0xFEU, 0x7CU, 0x38U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x36U, 0x7FU,
+    0x7FU, 0x3EU, 0x1CU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1BU, 0x3FU, 0x3FU, 0x1FU,
+    0x0EU, 0x04U, 0x00U, 0x00U, 0x80U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x1FU, 0x1FU, 0x0FU, 0x07U, 0x02U,
+    0x00U, 0x80U, 0xC0U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x00U, 0x06U, 0x0FU, 0x0FU, 0x07U, 0x03U, 0x01U, 0x00U, 0xC0U,
+    0xE0U, 0xE0U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x03U, 0x07U, 0x07U, 0x03U, 0x01U, 0x00U, 0x00U, 0x60U, 0xF0U, 0xF0U,
+    0xE0U, 0xC0U, 0x80U, 0x00U, 0x01U, 0x03U, 0x03U, 0x01U, 0x00U, 0x00U, 0x00U, 0xB0U, 0xF8U, 0xF8U, 0xF0U, 0xE0U,
+    0x40U, 0x00U, 0x00U, 0x01U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0xD8U, 0xFCU, 0xFCU, 0xF8U, 0x70U, 0x20U, 0x00U,
+    0x10U, 0x38U, 0x7CU, 0xFEU, 0x7CU, 0x38U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x1CU,
+    0x3EU, 0x7FU, 0x3EU, 0x1CU, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x0EU, 0x1FU, 0x3FU,
+    0x1FU, 0x0EU, 0x04U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x07U, 0x0FU, 0x1FU, 0x0FU, 0x07U,
+    0x02U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x01U, 0x03U, 0x07U, 0x0FU, 0x07U, 0x03U, 0x01U, 0x00U,
+    0x80U, 0xC0U, 0xE0U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x01U, 0x03U, 0x07U, 0x03U, 0x01U, 0x00U, 0x80U, 0xC0U, 0xE0U,
+    0xF0U, 0xE0U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x01U, 0x03U, 0x01U, 0x00U, 0x00U, 0x40U, 0xE0U, 0xF0U, 0xF8U, 0xF0U,
+    0xE0U, 0x40U, 0x00U, 0x00U, 0x00U, 0x01U, 0x00U, 0x00U, 0x00U, 0x20U, 0x70U, 0xF8U, 0xFCU, 0xF8U, 0x70U, 0x20U,
+    0x80U, 0xC0U, 0xE0U, 0xF0U, 0xE0U, 0xC0U, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x40U, 0x60U,
+    0x70U, 0x78U, 0x70U, 0x60U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U, 0x30U, 0x38U, 0x3CU,
+    0x38U, 0x30U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x18U, 0x1CU, 0x1EU, 0x1CU, 0x18U,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x0CU, 0x0EU, 0x0FU, 0x0EU, 0x0CU, 0x08U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x06U, 0x07U, 0x07U, 0x07U, 0x06U, 0x04U, 0x00U, 0x00U, 0x00U,
+    0x80U, 0x00U, 0x00U, 0x00U, 0x02U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x02U, 0x00U, 0x00U, 0x80U, 0xC0U, 0x80U,
+    0x00U, 0x00U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x00U, 0x80U, 0xC0U, 0xE0U, 0xC0U, 0x80U, 0x00U
+};
+
+BANKREF(font_vwf)
+const vwf_font_t font_vwf = {
+    font_vwf_widths, font_vwf_glyphs, 32U, 101U, 7U
+};
@@ -0,0 +1,14 @@
+/* Auto-generated by tools/gen_font.py - edit that script to change. */
+#ifndef FONT_VWF_H
+#define FONT_VWF_H
+
+#include <gbdk/platform.h>
+#include "vwf.h"
+
+#define FONT_VWF_GLYPH_COUNT 101U
+#define FONT_VWF_HEIGHT      7U
+
+BANKREF_EXTERN(font_vwf)
+extern const vwf_font_t font_vwf;
+
+#endif
@@ -7,9 +7,14 @@ The font covers ASCII 32-127 (96 chars) plus 5 extra glyphs at indices 96-100:
   96 - spade, 97 - club, 98 - heart, 99 - diamond, 100 - cursor arrow
 
 The font palette is loaded at GBC background palette slot 2.
+
+VWF = True also produces res/font_vwf.c / .h, the same glyphs as a
+proportional font for src/lib vwf (extra glyphs are characters 128-132).
 """
 
 NAME = 'font'
+VWF  = True
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
 
 # ---------------------------------------------------------------------------
 # Font palette (default: sky-blue bg, black text)
@@ -0,0 +1,16 @@
+/* Auto-generated by tools/gen_sprite.py for sprite "fx". */
+
+#include <gbdk/platform.h>
+#include "fx.h"
+
+/* GBC sprite palette (1 palette x 4 colors). Index 0 = transparent. */
+const palette_color_t fx_palettes[4] = {
+    RGB8(255,  0,255), RGB8(235,235,220), RGB8(160,150,130), RGB8(255,210, 60)
+};
+
+/* Sprite tiles: 6 tiles total (3 frames, 2 tiles/frame), pb16-compressed */
+const uint8_t fx_tiles[35] = {
+    0x02U, 0x40U, 0x20U, 0x80U, 0x70U, 0x00U, 0x60U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x40U, 0x40U, 0xE0U, 0xA0U,
+    0x40U, 0x40U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0xA0U, 0xA0U, 0x40U, 0x00U, 0xA0U, 0xA0U, 0x00U, 0x00U,
+    0xFFU, 0xFFU, 0xFFU
+};
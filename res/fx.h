@@ -0,0 +1,37 @@
+/* Auto-generated by tools/gen_sprite.py for sprite "fx". */
+#ifndef FX_H
+#define FX_H
+
+#include <gbdk/platform.h>
+#include <gb/cgb.h>
+#include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
+
+#define FX_TILE_COUNT      6U
+#define FX_PALETTE_COUNT    1U
+#define FX_TILES_PER_FRAME  2U
+#define FX_TILE_CODEC    TILE_CODEC_PB16
+#define FX_TILES_SIZE    35U
+#define FX_SET_TILES(first)  pb16_set_sprite_data((first), FX_TILE_COUNT, fx_tiles)
+#define FX_VRAM_LOAD()  vram_load(VRAM_OBJ, fx_tiles, 0U, FX_TILE_COUNT, FX_TILE_CODEC)
+
+/* Animation: dust */
+#define FX_ANIM_DUST_START   0U
+#define FX_ANIM_DUST_FRAMES  1U
+#define FX_ANIM_DUST_SPEED   8U
+
+/* Animation: spark */
+#define FX_ANIM_SPARK_START   2U
+#define FX_ANIM_SPARK_FRAMES  1U
+#define FX_ANIM_SPARK_SPEED   8U
+
+/* Animation: star */
+#define FX_ANIM_STAR_START   4U
+#define FX_ANIM_STAR_FRAMES  1U
+#define FX_ANIM_STAR_SPEED   8U
+
+extern const palette_color_t fx_palettes[4];
+extern const uint8_t fx_tiles[35];
+
+#endif
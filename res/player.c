@@ -8,7 +8,7 @@ const palette_color_t player_palettes[4] = {
     RGB8(255,  0,255), RGB8(240,180, 80), RGB8( 50,100,200), RGB8( 20, 20, 20)
 };
 
-/* Sprite tiles: 28 tiles total (7 frames, 4 tiles/frame) */
+/* Sprite tiles: 28 tiles total (7 frames, 4 tiles/frame), 16 bytes each */
 const uint8_t player_tiles[448] = {
     0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x03U, 0x07U, 0x07U, 0x0FU, 0x0EU, 0x1FU, 0x1BU,
     0x1FU, 0x18U, 0x07U, 0x00U, 0x0DU, 0x0FU, 0x1DU, 0x1FU, 0x1CU, 0x07U, 0x18U, 0x07U, 0x06U, 0x06U, 0x0EU, 0x0EU,
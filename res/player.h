@@ -5,10 +5,16 @@
 #include <gbdk/platform.h>
 #include <gb/cgb.h>
 #include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
 
 #define PLAYER_TILE_COUNT      28U
 #define PLAYER_PALETTE_COUNT    1U
 #define PLAYER_TILES_PER_FRAME  4U
+#define PLAYER_TILE_CODEC    TILE_CODEC_RAW
+#define PLAYER_TILES_SIZE    448U
+#define PLAYER_SET_TILES(first)  set_sprite_data((first), PLAYER_TILE_COUNT, player_tiles)
+#define PLAYER_VRAM_LOAD()  vram_load(VRAM_OBJ, player_tiles, 0U, PLAYER_TILE_COUNT, PLAYER_TILE_CODEC)
 
 /* Animation: idle */
 #define PLAYER_ANIM_IDLE_START   0U
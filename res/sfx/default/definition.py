@@ -0,0 +1,115 @@
+"""
+Sound effect definitions for gen_sfx.py directory discovery.
+
+Generates: res/sfx_defs.c / res/sfx_defs.h
+
+Each effect lists the channels it may play on (register writes address
+the first of them and are moved to the channel actually used), a default
+priority (1 = low, 2 = normal, 3 = high) and its frames.  A frame is
+(vbls, writes): wait vbls VBlanks after the previous frame, then apply
+the writes in order.  A frame with no writes just keeps the channel busy
+until the sound has died away.  The NRx4 trigger bit is set automatically
+in the first frame.
+
+Effects
+-------
+    jump        - rising square sweep              (CH1, CH2)
+    fall        - long falling sweep, lost a life  (CH1)
+    hit         - noise burst, touched an enemy    (CH4)
+    checkpoint  - two-note chime                   (CH2)
+    blip        - short UI tick                    (CH2)
+    laser       - falling retriggered zap          (CH1, CH2)
+"""
+
+NAME = 'sfx_defs'
+
+
+def _freq(hz):
+    """(NRx3, NRx4) pair for a square channel tone of hz Hz."""
+    x = 2048 - round(131072 / hz)
+    return x & 0xFF, (x >> 8) & 0x07
+
+
+def _tone(ch, hz, trigger=False):
+    lo, hi = _freq(hz)
+    return [(f'NR{ch}3', lo), (f'NR{ch}4', hi | (0x80 if trigger else 0))]
+
+
+EFFECTS = [
+    {
+        'name': 'jump',
+        'channels': ['CH1', 'CH2'],
+        'priority': 2,
+        'frames': [
+            (0, [('NR10', 0x16),          # sweep up, time 1, shift 6
+                 ('NR11', 0x80),          # 50% duty
+                 ('NR12', 0xA2)]          # vol 10, fade out
+                + _tone(1, 392)),
+            (12, []),
+        ],
+    },
+    {
+        'name': 'fall',
+        'channels': ['CH1'],
+        'priority': 3,
+        'frames': [
+            (0, [('NR10', 0x2B),          # sweep down, time 2, shift 3
+                 ('NR11', 0x40),          # 25% duty
+                 ('NR12', 0xF5)]          # vol 15, slow fade
+                + _tone(1, 880)),
+            (40, []),
+        ],
+    },
+    {
+        'name': 'hit',
+        'channels': ['CH4'],
+        'priority': 3,
+        'frames': [
+            (0, [('NR41', 0x00),
+                 ('NR42', 0xF2),          # vol 15, fast fade
+                 ('NR43', 0x55),          # mid-pitch noise
+                 ('NR44', 0x00)]),
+            (4, [('NR43', 0x67)]),        # drop the pitch while it decays
+            (12, []),
+        ],
+    },
+    {
+        'name': 'checkpoint',
+        'channels': ['CH2'],
+        'priority': 2,
+        'frames': [
+            (0, [('NR21', 0x80),
+                 ('NR22', 0xC3)]
+                + _tone(2, 659)),          # E5
+            (6, [('NR22', 0xC4)]
+                + _tone(2, 988, trigger=True)),   # B5
+            (18, []),
+        ],
+    },
+    {
+        'name': 'blip',
+        'channels': ['CH2'],
+        'priority': 1,
+        'frames': [
+            (0, [('NR21', 0x40),
+                 ('NR22', 0x81)]
+                + _tone(2, 1047)),         # C6
+            (4, []),
+        ],
+    },
+    {
+        'name': 'laser',
+        'channels': ['CH1', 'CH2'],
+        'priority': 2,
+        'frames': [
+            (0, [('NR10', 0x00),
+                 ('NR11', 0xC0),          # 75% duty
+                 ('NR12', 0xD1)]
+                + _tone(1, 1760)),
+            (2, _tone(1, 1319, trigger=True)),
+            (2, _tone(1, 988, trigger=True)),
+            (2, _tone(1, 740, trigger=True)),
+            (6, []),
+        ],
+    },
+]
@@ -0,0 +1,69 @@
+/* Auto-generated by tools/gen_sfx.py - edit that script to change. */
+/* No #pragma bank: sfx_update() reads these tables every frame from bank 0. */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sfx.h"
+#include "sfx_defs.h"
+
+/* jump */
+static const sfx_write_t jump_ops0[5] = { { 0x10U, 0x16U }, { 0x11U, 0x80U }, { 0x12U, 0xA2U }, { 0x13U, 0xB2U }, { 0x14U, 0x86U } };
+static const sfx_frame_t jump_frames[2] = {
+    { 0U, jump_ops0, 5U },
+    { 12U, NULL, 0U }
+};
+
+/* fall */
+static const sfx_write_t fall_ops0[5] = { { 0x10U, 0x2BU }, { 0x11U, 0x40U }, { 0x12U, 0xF5U }, { 0x13U, 0x6BU }, { 0x14U, 0x87U } };
+static const sfx_frame_t fall_frames[2] = {
+    { 0U, fall_ops0, 5U },
+    { 40U, NULL, 0U }
+};
+
+/* hit */
+static const sfx_write_t hit_ops0[4] = { { 0x20U, 0x00U }, { 0x21U, 0xF2U }, { 0x22U, 0x55U }, { 0x23U, 0x80U } };
+static const sfx_write_t hit_ops1[1] = { { 0x22U, 0x67U } };
+static const sfx_frame_t hit_frames[3] = {
+    { 0U, hit_ops0, 4U },
+    { 4U, hit_ops1, 1U },
+    { 12U, NULL, 0U }
+};
+
+/* checkpoint */
+static const sfx_write_t checkpoint_ops0[4] = { { 0x16U, 0x80U }, { 0x17U, 0xC3U }, { 0x18U, 0x39U }, { 0x19U, 0x87U } };
+static const sfx_write_t checkpoint_ops1[3] = { { 0x17U, 0xC4U }, { 0x18U, 0x7BU }, { 0x19U, 0x87U } };
+static const sfx_frame_t checkpoint_frames[3] = {
+    { 0U, checkpoint_ops0, 4U },
+    { 6U, checkpoint_ops1, 3U },
+    { 18U, NULL, 0U }
+};
+
+/* blip */
+static const sfx_write_t blip_ops0[4] = { { 0x16U, 0x40U }, { 0x17U, 0x81U }, { 0x18U, 0x83U }, { 0x19U, 0x87U } };
+static const sfx_frame_t blip_frames[2] = {
+    { 0U, blip_ops0, 4U },
+    { 4U, NULL, 0U }
+};
+
+/* laser */
+static const sfx_write_t laser_ops0[5] = { { 0x10U, 0x00U }, { 0x11U, 0xC0U }, { 0x12U, 0xD1U }, { 0x13U, 0xB6U }, { 0x14U, 0x87U } };
+static const sfx_write_t laser_ops1[2] = { { 0x13U, 0x9DU }, { 0x14U, 0x87U } };
+static const sfx_write_t laser_ops2[2] = { { 0x13U, 0x7BU }, { 0x14U, 0x87U } };
+static const sfx_write_t laser_ops3[2] = { { 0x13U, 0x4FU }, { 0x14U, 0x87U } };
+static const sfx_frame_t laser_frames[5] = {
+    { 0U, laser_ops0, 5U },
+    { 2U, laser_ops1, 2U },
+    { 2U, laser_ops2, 2U },
+    { 2U, laser_ops3, 2U },
+    { 6U, NULL, 0U }
+};
+
+const sfx_def_t sfx_defs[6] = {
+    { 0x03U, 2U, jump_frames, 2U },  /* SFX_JUMP */
+    { 0x01U, 3U, fall_frames, 2U },  /* SFX_FALL */
+    { 0x08U, 3U, hit_frames, 3U },  /* SFX_HIT */
+    { 0x02U, 2U, checkpoint_frames, 3U },  /* SFX_CHECKPOINT */
+    { 0x02U, 1U, blip_frames, 2U },  /* SFX_BLIP */
+    { 0x03U, 2U, laser_frames, 5U }   /* SFX_LASER */
+};
+const uint8_t   sfx_defs_count = 6U;
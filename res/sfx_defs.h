@@ -0,0 +1,15 @@
+/* Auto-generated by tools/gen_sfx.py - edit that script to change. */
+#ifndef SFX_DEFS_H
+#define SFX_DEFS_H
+
+/* Effect ids for sfx_play() */
+#define SFX_JUMP        0U
+#define SFX_FALL        1U
+#define SFX_HIT         2U
+#define SFX_CHECKPOINT  3U
+#define SFX_BLIP        4U
+#define SFX_LASER       5U
+
+#define SFX_COUNT       6U
+
+#endif
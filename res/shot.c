@@ -0,0 +1,15 @@
+/* Auto-generated by tools/gen_sprite.py for sprite "shot". */
+
+#include <gbdk/platform.h>
+#include "shot.h"
+
+/* GBC sprite palette (1 palette x 4 colors). Index 0 = transparent. */
+const palette_color_t shot_palettes[4] = {
+    RGB8(255,  0,255), RGB8(255,255,255), RGB8(255,200, 40), RGB8(230, 60, 30)
+};
+
+/* Sprite tiles: 4 tiles total (2 frames, 2 tiles/frame), pb16-compressed */
+const uint8_t shot_tiles[22] = {
+    0xF8U, 0x3CU, 0x3EU, 0xC1U, 0xCBU, 0x00U, 0x3CU, 0x00U, 0xFFU, 0xFFU, 0xF0U, 0x18U, 0x18U, 0x24U, 0x3CU, 0xC3U,
+    0x18U, 0x18U, 0x00U, 0x00U, 0xFFU, 0xFFU
+};
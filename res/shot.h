@@ -0,0 +1,32 @@
+/* Auto-generated by tools/gen_sprite.py for sprite "shot". */
+#ifndef SHOT_H
+#define SHOT_H
+
+#include <gbdk/platform.h>
+#include <gb/cgb.h>
+#include <stdint.h>
+#include "pb16.h"
+#include "vram.h"
+
+#define SHOT_TILE_COUNT      4U
+#define SHOT_PALETTE_COUNT    1U
+#define SHOT_TILES_PER_FRAME  2U
+#define SHOT_TILE_CODEC    TILE_CODEC_PB16
+#define SHOT_TILES_SIZE    22U
+#define SHOT_SET_TILES(first)  pb16_set_sprite_data((first), SHOT_TILE_COUNT, shot_tiles)
+#define SHOT_VRAM_LOAD()  vram_load(VRAM_OBJ, shot_tiles, 0U, SHOT_TILE_COUNT, SHOT_TILE_CODEC)
+
+/* Animation: player */
+#define SHOT_ANIM_PLAYER_START   0U
+#define SHOT_ANIM_PLAYER_FRAMES  1U
+#define SHOT_ANIM_PLAYER_SPEED   8U
+
+/* Animation: enemy */
+#define SHOT_ANIM_ENEMY_START   2U
+#define SHOT_ANIM_ENEMY_FRAMES  1U
+#define SHOT_ANIM_ENEMY_SPEED   8U
+
+extern const palette_color_t shot_palettes[4];
+extern const uint8_t shot_tiles[22];
+
+#endif
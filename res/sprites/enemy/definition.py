@@ -15,6 +15,7 @@ Animation list
 """
 
 NAME = 'enemy'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
 SIZE = '8x8'
 
 # Keep enemy sprite data in Bank 0 (accessed directly from main.c)
@@ -0,0 +1,77 @@
+"""
+Particle (fx) sprite definition for generate_sprites (gen_sprite.py).
+
+SIZE = '8x8': one small graphic per particle kind, in the top half of an
+8x16 OBJ slot.  The particle emitter (src/lib/include/particle.h) places
+the top-left of the tile at the particle position, so keep the pixels
+near the top-left corner for effects that should hug the ground.
+
+Animation list
+--------------
+  dust  (1 frame) – grey puff kicked up on landing
+  spark (1 frame) – bright cross for projectile hits
+  star  (1 frame) – burst when the player dies
+"""
+
+NAME = 'fx'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
+SIZE = '8x8'
+
+# Keep particle sprite data in Bank 0 (loaded directly from main.c)
+USE_AUTOBANK = False
+
+# GBC sprite palette: index 0 = transparent on OBJ layer
+PALETTE = [
+    (255,   0, 255),   # 0 – transparent (magenta key)
+    (235, 235, 220),   # 1 – light dust / spark core (W)
+    (160, 150, 130),   # 2 – dark dust (G)
+    (255, 210,  60),   # 3 – yellow spark (Y)
+]
+
+# Character → colour index.  '.' is always 0 (transparent).
+PIXEL_CHARS = {'.': 0, 'W': 1, 'G': 2, 'Y': 3}
+
+ANIM_SPEEDS = {
+    'dust':  8,
+    'spark': 8,
+    'star':  8,
+}
+
+_DUST = [
+    '.WG.....',
+    'WGGG....',
+    '.GG.....',
+    '........',
+    '........',
+    '........',
+    '........',
+    '........',
+]
+
+_SPARK = [
+    '.Y......',
+    'YWY.....',
+    '.Y......',
+    '........',
+    '........',
+    '........',
+    '........',
+    '........',
+]
+
+_STAR = [
+    'Y.Y.....',
+    '.W......',
+    'Y.Y.....',
+    '........',
+    '........',
+    '........',
+    '........',
+    '........',
+]
+
+ANIMATIONS = {
+    'dust':  [_DUST],
+    'spark': [_SPARK],
+    'star':  [_STAR],
+}
@@ -20,6 +20,7 @@ Animation list
 """
 
 NAME = 'player'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
 SIZE = '16x16'
 
 # Keep player sprite data in Bank 0 (accessed directly from main.c)
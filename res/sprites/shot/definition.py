@@ -0,0 +1,63 @@
+"""
+Projectile sprite definition for generate_sprites (gen_sprite.py).
+
+SIZE = '8x8': like the enemy, each frame is 8 rows of 8 characters and
+occupies the top half of an 8x16 OBJ slot.  The projectile pool
+(src/lib/include/projectile.h) uses the PROJ_HIT_* box in the middle of
+the tile, so keep the bright pixels within rows/columns 2-5.
+
+Animation list
+--------------
+  player (1 frame) – horizontal energy bolt (mirrored when fired left)
+  enemy  (1 frame) – round bullet
+"""
+
+NAME = 'shot'
+TILE_CODEC = 'auto'   # tile storage: 'auto', 'raw' or 'pb16' (see the make generate report)
+SIZE = '8x8'
+
+# Keep projectile sprite data in Bank 0 (loaded directly from main.c)
+USE_AUTOBANK = False
+
+# GBC sprite palette: index 0 = transparent on OBJ layer
+PALETTE = [
+    (255,   0, 255),   # 0 – transparent (magenta key)
+    (255, 255, 255),   # 1 – white core (W)
+    (255, 200,  40),   # 2 – yellow glow (Y)
+    (230,  60,  30),   # 3 – red rim (R)
+]
+
+# Character → colour index.  '.' is always 0 (transparent).
+PIXEL_CHARS = {'.': 0, 'W': 1, 'Y': 2, 'R': 3}
+
+ANIM_SPEEDS = {
+    'player': 8,
+    'enemy':  8,
+}
+
+_BOLT = [
+    '........',
+    '........',
+    '..YYYY..',
+    'YYWWWWWY',
+    'YYWWWWWY',
+    '..YYYY..',
+    '........',
+    '........',
+]
+
+_BULLET = [
+    '........',
+    '........',
+    '...RR...',
+    '..RYYR..',
+    '..RYYR..',
+    '...RR...',
+    '........',
+    '........',
+]
+
+ANIMATIONS = {
+    'player': [_BOLT],
+    'enemy':  [_BULLET],
+}
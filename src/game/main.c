@@ -2,26 +2,43 @@
 #include <gb/cgb.h>
 #include <stdint.h>
 #include "states.h"
+#include "frame.h"
+#include "input.h"
+#include "palette.h"
+#include "profiler.h"
+#include "sfx.h"
+#include "tile_anim.h"
+#include "vram.h"
+#include "vwf.h"
 #include "player.h"
 #include "enemy.h"
+#include "shot.h"
+#include "fx.h"
 
 /*
  * main.c – entry point for the GBDK-QuickStart GBC template.
  *
  * Responsibilities:
- *   - Load sprite tile data (player + enemy) into OBJ VRAM once.
- *   - Set up GBC sprite palettes (slots 0 and 1).
+ *   - Load sprite tile data (player, enemy, shots, particles) into OBJ
+ *     VRAM once, through the VRAM allocator.
+ *   - Set up GBC sprite palettes (slots 0 to 3).
  *   - Set up shared HUD background palettes (slots 3 and 4).
+ *   - Start the palette engine fully faded to black so the first state
+ *     fades in; palettes are committed once per frame during VBlank.
+ *   - Start the sound effect engine; effects advance once per frame.
+ *   - Start joypad sampling in the VBlank interrupt; the per-frame input
+ *     masks are built once per logic tick before the state runs.
+ *   - Pace logic with frame_begin()/frame_end(): scroll and sprites are
+ *     committed in VBlank only for finished frames (see frame.h).
  *   - Background tiles and font tiles are loaded per-state in each
  *     state's init() function (to support distinct per-state backgrounds).
  *
- * VRAM tile layout (per-state, loaded by each state's init):
- *   BKG slots 0 .. <bg_tile_count>-1 : background tiles for current state
- *   BKG slots <bg_tile_count> ..     : font tiles
- *
- * OBJ tile layout (loaded once here):
- *   Slots 0 .. PLAYER_TILE_COUNT-1              : player tiles
- *   Slots PLAYER_TILE_COUNT .. (P+E tile count) : enemy tiles
+ * VRAM tile layout: placed by vram.h, first fit over both CGB VRAM banks.
+ *   OBJ tiles (loaded once here, before any state) are permanent; states
+ *   look them up again with <NAME>_VRAM_LOAD(), which only takes another
+ *   reference, and read the tile index / bank bit from the handle.
+ *   BG tiles (background, font, VWF ring) are loaded by each state's
+ *   init() and released with the state's arena when it is left.
  */
 
 /* HUD window palette (dark background, white text) */
@@ -41,28 +58,46 @@ static const palette_color_t hud_red_palette[4] = {
 };
 
 void main(void) {
+    uint8_t ticks;
 
     DISPLAY_OFF;
 
+    sfx_init();
+    input_init();
+    frame_init();
+
+    /* Start black: the first state's init() fades in from here */
+    palette_init();
+    palette_fade_set(PAL_FADE_BLACK, PAL_FADE_STEPS);
+
     /* --- GBC background palettes shared across all states --- */
     /* Slot 3: HUD palette (white text on dark background) */
-    set_bkg_palette(3, 1, hud_palette);
+    palette_set_bkg(3, 1, hud_palette);
     /* Slot 4: HUD red palette (red text on dark background – lives hearts) */
-    set_bkg_palette(4, 1, hud_red_palette);
+    palette_set_bkg(4, 1, hud_red_palette);
 
     /* --- GBC sprite palettes --- */
     /* Slot 0: player palette */
-    set_sprite_palette(0, PLAYER_PALETTE_COUNT, player_palettes);
+    palette_set_sprite(0, PLAYER_PALETTE_COUNT, player_palettes);
     /* Slot 1: enemy palette */
-    set_sprite_palette(1, ENEMY_PALETTE_COUNT, enemy_palettes);
+    palette_set_sprite(1, ENEMY_PALETTE_COUNT, enemy_palettes);
+    /* Slot 2: projectile palette */
+    palette_set_sprite(2, SHOT_PALETTE_COUNT, shot_palettes);
+    /* Slot 3: particle palette */
+    palette_set_sprite(3, FX_PALETTE_COUNT, fx_palettes);
+    /* Display is off, so the shadow can be uploaded right away */
+    palette_commit();
 
-    /* --- Load sprite tiles (persists across all states) --- */
-    set_sprite_data(0, PLAYER_TILE_COUNT, player_tiles);
-    set_sprite_data(PLAYER_TILE_COUNT, ENEMY_TILE_COUNT, enemy_tiles);
-
-    /* Use 8x16 sprite mode */
+    /* Use 8x16 sprite mode (before any OBJ tiles are placed, see vram.h) */
     SPRITES_8x16;
 
+    /* --- Load sprite tiles (root arena: persists across all states) --- */
+    vram_init();
+    PLAYER_VRAM_LOAD();
+    ENEMY_VRAM_LOAD();
+    SHOT_VRAM_LOAD();
+    FX_VRAM_LOAD();
+
     DISPLAY_ON;
     SHOW_BKG;
     SHOW_SPRITES;
@@ -70,9 +105,24 @@ void main(void) {
     /* Start with the title screen */
     switch_state(STATE_TITLE_SCREEN);
 
-    /* Main game loop */
+    /* Main game loop: palettes, queued VWF text tiles and animated BG
+     * tile frames are committed at the start of VBlank and sound effects
+     * step right after.  The state then runs one logic tick (more when
+     * catching up after dropped frames, see frame.h), each with the
+     * input latched by the VBL handler; scroll and sprites are published
+     * once all ticks are done, and fades/cycles advance last.         */
     while (1) {
-        vsync();
-        run_current_state();
+        ticks = frame_begin();
+        PROF_FRAME();
+        palette_commit();
+        vwf_commit();
+        tile_anim_commit();
+        sfx_update();
+        do {
+            input_update();
+            run_current_state();
+        } while (--ticks);
+        frame_end();
+        palette_update();
     }
 }
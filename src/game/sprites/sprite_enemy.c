@@ -8,124 +8,71 @@
 #include "sprite.h"
 #include "sprite_manager.h"
 #include "sprite_enemy.h"
+#include "behaviour.h"
+#include "behaviours.h"
 #include "player.h"
 #include "enemy.h"
-#include "bg_gameplay.h"
 
 /* -----------------------------------------------------------------------
  * Enemy constants
  * -------------------------------------------------------------------- */
 #define ENEMY_OBJ_ID          2U   /* hardware OBJ slot used by enemy     */
-#define ENEMY_PATROL_LEFT    10U   /* left patrol boundary (world-X)      */
-#define ENEMY_PATROL_RIGHT  180U   /* right patrol boundary (world-X)     */
 
-static Sprite   *_enemy_sprite;
-static uint16_t  _enemy_world_x16;   /* full 16-bit absolute world X      */
-static int8_t    _enemy_dx;          /* patrol direction (+1 or -1)       */
-static uint8_t   _enemy_is_idle;     /* 1 = currently using idle animation */
-
-/* -----------------------------------------------------------------------
- * _enemy_has_ground_at
- * Returns 1 if there is a solid tile (ground) at the given world-X and
- * directly below the enemy's feet.  Used to detect pit edges.
- * -------------------------------------------------------------------- */
-static uint8_t _enemy_has_ground_at(uint16_t world_x16)
-{
-    uint8_t feet_y;
-    uint8_t tile_row;
-    uint8_t tile;
-    uint8_t i;
-
-    feet_y   = (uint8_t)(_enemy_sprite->world_y + _enemy_sprite->height);
-    tile_row = (uint8_t)(feet_y >> 3);
-    tile     = sprite_manager_tile_at(
-        world_x16, tile_row, bg_gameplay_map, BG_GAMEPLAY_MAP_WIDTH);
-    /* treat any landing surface (collision_down tiles) as ground so enemies
-     * stop at platforms and ledges just as the player does. */
-    for (i = 0U; i < BG_GAMEPLAY_COLLISION_DOWN_TILE_COUNT; i++) {
-        if (bg_gameplay_collision_down_tiles[i] == tile) return 1U;
-    }
-    return 0U;
-}
+static Sprite    *_enemy_sprite;
+static Behaviour  _enemy_bhv;        /* script state, world X, facing    */
 
 BANKREF(enemy_init)
-void enemy_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base) BANKED
+void enemy_init(uint16_t start_x, uint8_t ground_y, uint8_t tile_base,
+                uint8_t prop, uint8_t script) BANKED
 {
-    _enemy_dx      = 1;
-    _enemy_is_idle = 0U;
-    _enemy_world_x16 = (uint16_t)start_x;
-
     _enemy_sprite = sprite_manager_alloc(
         ENEMY_OBJ_ID, 1U, 8U, 8U, tile_base, ENEMY_TILES_PER_FRAME);
-    _enemy_sprite->world_x    = start_x;
+    _enemy_sprite->world_x    = (uint8_t)start_x;
     _enemy_sprite->world_y    = ground_y;
     _enemy_sprite->anim_speed = ENEMY_ANIM_WALK_SPEED;
 
-    /* GBC sprite palette slot 1 for enemy */
+    /* The script runs from its own bank; the first ANIM picks the frames */
+    behaviour_start(&_enemy_bhv, BANK(behaviours), behaviours, script,
+                    _enemy_sprite, start_x);
+
+    /* GBC sprite palette slot 1 for enemy (passed in prop) */
     set_sprite_tile(ENEMY_OBJ_ID, (uint8_t)(tile_base + ENEMY_ANIM_WALK_START));
-    set_sprite_prop(ENEMY_OBJ_ID, 0x01U);
+    set_sprite_prop(ENEMY_OBJ_ID, prop);
     move_sprite(ENEMY_OBJ_ID, (uint8_t)(start_x + 8U),
                 (uint8_t)(_enemy_sprite->world_y + 16U));
 }
 
 BANKREF(enemy_update)
-void enemy_update(uint8_t camera_x) BANKED
+void enemy_update(uint16_t camera_x, uint16_t player_x16) BANKED
 {
-    uint16_t next_x16;
     int16_t  screen_x;
     uint8_t  hw_x, hw_y;
     uint8_t  tile_idx;
     uint8_t  prop;
-    uint8_t  anim_start, anim_frames;
-
-    /* --- Patrol movement with pit-edge and wall detection --- */
-    next_x16 = (uint16_t)((int16_t)_enemy_world_x16 + _enemy_dx);
-
-    /* Check for a solid wall ahead (collision tiles, all directions) or an
-     * edge drop.  One-way ledges (collision_down only) are passable from
-     * the side so the enemy walks through them horizontally.             */
-    _enemy_sprite->world_x = (uint8_t)next_x16;  /* temp for tile_collision */
-    if (sprite_manager_tile_collision(
-            _enemy_sprite, next_x16,
-            bg_gameplay_map, BG_GAMEPLAY_MAP_WIDTH, BG_GAMEPLAY_MAP_HEIGHT,
-            bg_gameplay_collision_tiles, BG_GAMEPLAY_COLLISION_TILE_COUNT) ||
-        !_enemy_has_ground_at(next_x16)) {
-        /* Hit a wall/platform side or about to walk off a pit edge – reverse */
-        _enemy_dx = -_enemy_dx;
-        next_x16  = _enemy_world_x16;   /* stay in place this frame */
-    }
 
-    _enemy_world_x16 = next_x16;
-
-    /* Enforce patrol boundaries */
-    if (_enemy_world_x16 >= (uint16_t)ENEMY_PATROL_RIGHT) {
-        _enemy_dx = -1;
-    }
-    if (_enemy_world_x16 <= (uint16_t)ENEMY_PATROL_LEFT) {
-        _enemy_dx = 1;
-    }
-
-    /* --- Animation: walk while moving --- */
-    anim_start  = ENEMY_ANIM_WALK_START;
-    anim_frames = ENEMY_ANIM_WALK_FRAMES;
-    if (_enemy_is_idle) {
-        anim_start  = ENEMY_ANIM_IDLE_START;
-        anim_frames = ENEMY_ANIM_IDLE_FRAMES;
+    /* --- Behaviour script: walking, turning, jumping, firing --- */
+    behaviour_update(&_enemy_bhv, player_x16);
+    if (!_enemy_bhv.script) {
+        /* Fell out of the level: gone until the next respawn */
+        _enemy_sprite->active = 0U;
+        move_sprite(ENEMY_OBJ_ID, 0U, 0U);
+        return;
     }
 
+    /* --- Animation: whatever the script's last ANIM chose --- */
     _enemy_sprite->anim_counter++;
     if (_enemy_sprite->anim_counter >= _enemy_sprite->anim_speed) {
         _enemy_sprite->anim_counter = 0U;
         _enemy_sprite->anim_frame   =
-            (uint8_t)((_enemy_sprite->anim_frame + 1U) % anim_frames);
+            (uint8_t)((_enemy_sprite->anim_frame + 1U) % _enemy_bhv.anim_frames);
     }
-    tile_idx = (uint8_t)(_enemy_sprite->tile_base + anim_start +
+    tile_idx = (uint8_t)(_enemy_sprite->tile_base + _enemy_bhv.anim_start +
                           _enemy_sprite->anim_frame * ENEMY_TILES_PER_FRAME);
     set_sprite_tile(ENEMY_OBJ_ID, tile_idx);
 
-    /* --- Flip enemy to face direction of travel --- */
+    /* --- Flip enemy to face its direction --- */
     prop = get_sprite_prop(ENEMY_OBJ_ID);
-    if (_enemy_dx < 0) {
+    if (_enemy_bhv.dx < 0) {
         prop = (uint8_t)(prop | S_FLIPX);
     } else {
         prop = (uint8_t)(prop & ~S_FLIPX);
@@ -142,7 +89,7 @@ void enemy_update(uint8_t camera_x) BANKED
      * (e.g. -1 → 255) and happened to overlap the player's position.
      * world_x is only written with the clamped uint8_t value when the
      * enemy is actually visible, keeping it in the valid 0..255 range.  */
-    screen_x = (int16_t)_enemy_world_x16 - (int16_t)camera_x;
+    screen_x = (int16_t)_enemy_bhv.x16 - (int16_t)camera_x;
 
     if (screen_x < -8 || screen_x > 168) {
         /* Off-screen: deactivate collision and hide the hardware sprite */
@@ -158,6 +105,12 @@ void enemy_update(uint8_t camera_x) BANKED
     }
 }
 
+BANKREF(enemy_events)
+uint8_t enemy_events(void) BANKED
+{
+    return _enemy_bhv.events;
+}
+
 BANKREF(enemy_cleanup)
 void enemy_cleanup(void) BANKED
 {
@@ -167,6 +120,18 @@ void enemy_cleanup(void) BANKED
     }
 }
 
+BANKREF(enemy_get_world_x16)
+uint16_t enemy_get_world_x16(void) BANKED
+{
+    return _enemy_bhv.x16;
+}
+
+BANKREF(enemy_shift_x)
+void enemy_shift_x(uint16_t dx) BANKED
+{
+    _enemy_bhv.x16 = (uint16_t)(_enemy_bhv.x16 - dx);
+}
+
 BANKREF(enemy_get_sprite)
 Sprite* enemy_get_sprite(void) BANKED
 {
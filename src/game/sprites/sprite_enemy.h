@@ -6,28 +6,46 @@
 #include "sprite.h"
 
 /* -----------------------------------------------------------------------
- * Enemy sprite – provides init, update, and cleanup for the patrol enemy.
+ * Enemy sprite – provides init, update, and cleanup for the enemy.
  *
- * The enemy patrols between ENEMY_PATROL_LEFT and ENEMY_PATROL_RIGHT,
- * flipping direction (and sprite) at each boundary.
+ * What the enemy does is a behaviour script (behaviour.h, scripts in
+ * res/behaviours/enemy); this module draws it, animates it and faces it
+ * in its direction of travel.
  * ----------------------------------------------------------------------- */
 
 /* Initialise and allocate the enemy sprite.
  * start_x   : starting world-X position
  * ground_y  : world-Y when standing on the ground
- * tile_base : first VRAM tile slot used by enemy tile data */
+ * tile_base : first VRAM tile slot used by enemy tile data
+ * prop      : OBJ attributes (CGB palette, VRAM bank bit of the tiles)
+ * script    : BHV_* behaviour script id (behaviours.h) */
 BANKREF_EXTERN(enemy_init)
-void enemy_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base) BANKED;
+void enemy_init(uint16_t start_x, uint8_t ground_y, uint8_t tile_base,
+                uint8_t prop, uint8_t script) BANKED;
 
 /* Update enemy for one frame.
- * camera_x : current camera X scroll value (for hardware sprite positioning) */
+ * camera_x   : current camera X scroll value (for hardware sprite positioning)
+ * player_x16 : player world-X, for the script's distance tests */
 BANKREF_EXTERN(enemy_update)
-void enemy_update(uint8_t camera_x) BANKED;
+void enemy_update(uint16_t camera_x, uint16_t player_x16) BANKED;
+
+/* BHV_EV_* raised by the last enemy_update() (e.g. BHV_EV_FIRE) */
+BANKREF_EXTERN(enemy_events)
+uint8_t enemy_events(void) BANKED;
 
 /* Free the enemy sprite and hide its OBJ slot. */
 BANKREF_EXTERN(enemy_cleanup)
 void enemy_cleanup(void) BANKED;
 
+/* Return the enemy's full 16-bit world X position. */
+BANKREF_EXTERN(enemy_get_world_x16)
+uint16_t enemy_get_world_x16(void) BANKED;
+
+/* Move the enemy dx pixels left with the rest of the world (the endless
+ * runner's rebase); it must be at world X dx or more. */
+BANKREF_EXTERN(enemy_shift_x)
+void enemy_shift_x(uint16_t dx) BANKED;
+
 /* Return a pointer to the enemy's Sprite struct (for collision checks). */
 BANKREF_EXTERN(enemy_get_sprite)
 Sprite* enemy_get_sprite(void) BANKED;
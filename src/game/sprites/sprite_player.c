@@ -12,10 +12,7 @@
 #include "sprite_manager.h"
 #include "sprite_player.h"
 #include "player.h"
-#include "bg_gameplay.h"
-
-/* vertical location of the HUD window (matches state_gameplay.c) */
-#define HUD_WIN_Y 112U
+#include "level.h"
 
 /* -----------------------------------------------------------------------
  * Player physics constants
@@ -24,11 +21,9 @@
 #define WALK_SPEED         1U   /* world pixels per frame                */
 #define GRAVITY_DELAY      3U   /* frames between gravity steps          */
 
-/* World extents – 48-tile map */
-#define MAX_WORLD_X      376U   /* 48*8-8 = 376                          */
-#define SCROLL_R_LIMIT   100U   /* scroll right when screen-X exceeds    */
-#define SCROLL_L_LIMIT    60U   /* scroll left  when screen-X falls below */
-#define MAX_SCROLL_X     224U   /* max camera_x: (48-20)*8 = 224         */
+/* World extents – derived from the selected level's map (width 0: a
+ * generated level with no right edge) */
+#define MAX_WORLD_X      (level.width ? (uint16_t)level.width * 8U - 8U : 0xFFFFU)
 
 /* Sprite Y constants */
 #define GROUND_WORLD_Y    64U   /* initial world_y when spawned on ground */
@@ -42,6 +37,7 @@ static int8_t       _player_vy;
 static uint8_t      _player_facing_r;
 static PlayerState  _player_state;
 static uint8_t      _gravity_delay_ctr;
+static uint8_t      _player_prop;        /* palette + VRAM bank bit        */
 /* Death animation variables */
 static uint8_t      _death_bounce_count;
 static uint8_t      _death_timer;
@@ -75,29 +71,15 @@ static uint8_t _has_ground_below(uint8_t world_y, uint16_t world_x16)
                                                  : _player_sprite->height;
     uint8_t  feet_y   = (uint8_t)(world_y + hy + ah);
     uint8_t  tile_row = (uint8_t)(feet_y >> 3);
-    uint16_t col_start = (uint16_t)((world_x16 + hx) >> 3);
-    uint16_t col_end   = (uint16_t)((world_x16 + hx + aw - 1U) >> 3);
-    uint16_t col;
-    uint8_t tile, i;
-
-    if (col_start >= (uint16_t)BG_GAMEPLAY_MAP_WIDTH) return 0U;
-    if (col_end >= (uint16_t)BG_GAMEPLAY_MAP_WIDTH)
-        col_end = (uint16_t)(BG_GAMEPLAY_MAP_WIDTH - 1U);
-
-    for (col = col_start; col <= col_end; col++) {
-        tile = sprite_manager_tile_at((uint16_t)(col * 8U), tile_row,
-                                      bg_gameplay_map, BG_GAMEPLAY_MAP_WIDTH);
-        for (i = 0U; i < BG_GAMEPLAY_COLLISION_DOWN_TILE_COUNT; i++) {
-            if (bg_gameplay_collision_down_tiles[i] == tile) {
-                return 1U;
-            }
-        }
-    }
-    return 0U;
+    uint16_t x_start  = (uint16_t)(world_x16 + hx);
+
+    /* All columns are read in one bank switch; right of the map is air */
+    return level_ground_span(x_start, (uint16_t)(x_start + aw - 1U), tile_row);
 }
 
 BANKREF(player_init)
-void player_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base) BANKED
+void player_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base,
+                 uint8_t prop) BANKED
 {
     _player_vy         = 0;
     _player_facing_r   = 1U;
@@ -106,6 +88,7 @@ void player_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base) BANKED
     _player_world_x16  = (uint16_t)start_x;
     _death_bounce_count = 0U;
     _death_timer = 0U;
+    _player_prop = prop;
 
     /* Player is a 16x16 graphic made from two 8x16 OBJ slots.  The
      * sprite manager needs the full visual width so hitbox/collision
@@ -120,21 +103,45 @@ void player_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base) BANKED
     _player_sprite->world_y    = ground_y;
     _player_sprite->anim_speed = PLAYER_ANIM_IDLE_SPEED;
 
-    set_sprite_tile(0U, PLAYER_ANIM_IDLE_START);
-    set_sprite_tile(1U, (uint8_t)(PLAYER_ANIM_IDLE_START + 2U));
-    set_sprite_prop(0U, 0U);
-    set_sprite_prop(1U, 0U);
+    set_sprite_tile(0U, (uint8_t)(_player_sprite->tile_base + PLAYER_ANIM_IDLE_START));
+    set_sprite_tile(1U, (uint8_t)(_player_sprite->tile_base + PLAYER_ANIM_IDLE_START + 2U));
+    set_sprite_prop(0U, _player_prop);
+    set_sprite_prop(1U, _player_prop);
+    sprite_manager_update_hw(_player_sprite, 0U, 0U);
+}
+
+BANKREF(player_respawn)
+void player_respawn(uint16_t world_x16, uint8_t ground_y, uint16_t camera_x) BANKED
+{
+    /* Reset physics and animation only – the sprite slot and tile data
+     * allocated by player_init() are kept. */
+    _player_vy          = 0;
+    _player_facing_r    = 1U;
+    _player_state       = PSTATE_IDLE;
+    _gravity_delay_ctr  = 0U;
+    _player_world_x16   = world_x16;
+    _death_bounce_count = 0U;
+    _death_timer        = 0U;
+
+    _player_sprite->world_x      = (uint8_t)(world_x16 - (uint16_t)camera_x);
+    _player_sprite->world_y      = ground_y;
+    _player_sprite->anim_frame   = 0U;
+    _player_sprite->anim_counter = 0U;
+    _player_sprite->anim_speed   = PLAYER_ANIM_IDLE_SPEED;
+
+    set_sprite_tile(0U, (uint8_t)(_player_sprite->tile_base + PLAYER_ANIM_IDLE_START));
+    set_sprite_tile(1U, (uint8_t)(_player_sprite->tile_base + PLAYER_ANIM_IDLE_START + 2U));
+    set_sprite_prop(0U, _player_prop);
+    set_sprite_prop(1U, _player_prop);
     sprite_manager_update_hw(_player_sprite, 0U, 0U);
 }
 
 BANKREF(player_update)
-uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
-                      uint16_t min_world_x) BANKED
+uint8_t player_update(uint8_t joy, uint8_t joy_press, uint16_t min_world_x) BANKED
 {
     uint8_t     events  = 0U;
     uint8_t     moved   = 0U;
     int16_t     new_y;
-    uint8_t     screen_x, hw_x, hw_y;
     uint8_t     tile_idx, prop;
     uint8_t     anim_start, anim_frames;
     uint8_t     snap_row;
@@ -145,17 +152,12 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
         _player_facing_r = 1U;
         if (_player_world_x16 < (uint16_t)MAX_WORLD_X) {
             uint16_t try_x16 = (uint16_t)(_player_world_x16 + 1U);
-            _player_sprite->world_x =
-                (uint8_t)(try_x16 - (uint16_t)(*camera_x));
 #ifdef DEBUG
             EMU_printf("Checking right movement collision at world_x16=%u\n", try_x16);
 #endif
             /* check collision tiles (multi-directional) only –
              * collision_down_tiles are one-way and must not block lateral movement */
-            if (sprite_manager_tile_collision(
-                    _player_sprite, try_x16,
-                    bg_gameplay_map, BG_GAMEPLAY_MAP_WIDTH, BG_GAMEPLAY_MAP_HEIGHT,
-                    bg_gameplay_collision_tiles, BG_GAMEPLAY_COLLISION_TILE_COUNT)) {
+            if (level_box_solid(_player_sprite, try_x16)) {
 #ifdef DEBUG
                 EMU_printf("Collision detected, movement blocked\n");
 #endif
@@ -171,17 +173,12 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
         _player_facing_r = 0U;
         if (_player_world_x16 > min_world_x) {
             uint16_t try_x16 = (uint16_t)(_player_world_x16 - 1U);
-            _player_sprite->world_x =
-                (uint8_t)(try_x16 - (uint16_t)(*camera_x));
 #ifdef DEBUG
             EMU_printf("Checking left movement collision at world_x16=%u\n", try_x16);
 #endif
             /* check collision tiles (multi-directional) only –
              * collision_down_tiles are one-way and must not block lateral movement */
-            if (sprite_manager_tile_collision(
-                    _player_sprite, try_x16,
-                    bg_gameplay_map, BG_GAMEPLAY_MAP_WIDTH, BG_GAMEPLAY_MAP_HEIGHT,
-                    bg_gameplay_collision_tiles, BG_GAMEPLAY_COLLISION_TILE_COUNT)) {
+            if (level_box_solid(_player_sprite, try_x16)) {
 #ifdef DEBUG
                 EMU_printf("Collision detected, movement blocked\n");
 #endif
@@ -195,12 +192,8 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
         }
     }
 
-    /* Sync screen-relative world_x after potential revert */
-    _player_sprite->world_x =
-        (uint8_t)(_player_world_x16 - (uint16_t)(*camera_x));
-
-    /* --- Jump (A or B button, only when grounded) --- */
-    if ((joy_press & J_A) || (joy_press & J_B)) {
+    /* --- Jump (A button, only when grounded; B fires) --- */
+    if (joy_press & J_A) {
         if (_player_state != PSTATE_JUMP && _player_state != PSTATE_DIE) {
             _player_vy         = JUMP_VY;
             _gravity_delay_ctr = 0U;
@@ -273,14 +266,12 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
             _player_vy         = 0;
             _gravity_delay_ctr = 0U;
             _player_state      = moved ? PSTATE_WALK : PSTATE_IDLE;
+            events |= PLAYER_EVENT_LANDED;
         }
 
         /* Ceiling: multi-directional collision tiles block upward movement */
         if (_player_vy < 0 &&
-            sprite_manager_tile_collision(
-                _player_sprite, _player_world_x16,
-                bg_gameplay_map, BG_GAMEPLAY_MAP_WIDTH, BG_GAMEPLAY_MAP_HEIGHT,
-                bg_gameplay_collision_tiles, BG_GAMEPLAY_COLLISION_TILE_COUNT)) {
+            level_box_solid(_player_sprite, _player_world_x16)) {
             /* Snap to the bottom of the tile hit from below */
             snap_row = (uint8_t)((uint8_t)new_y >> 3);
             _player_sprite->world_y = (uint8_t)((snap_row + 1U) * 8U);
@@ -313,27 +304,13 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
         }
     }
 
-    /* --- Camera / scroll ---
-     * Update camera_x only; the caller (gameplay_update) writes SCX_REG
-     * during VBlank so the scroll register is never touched mid-frame.   */
-    screen_x = (uint8_t)(_player_world_x16 - (uint16_t)(*camera_x));
-    if (screen_x > SCROLL_R_LIMIT && *camera_x < MAX_SCROLL_X) {
-        (*camera_x)++;
-    } else if (screen_x < SCROLL_L_LIMIT && *camera_x > 0U) {
-        (*camera_x)--;
-    }
-
-    /* Re-sync sprite world_x with updated camera */
-    _player_sprite->world_x =
-        (uint8_t)(_player_world_x16 - (uint16_t)(*camera_x));
-
     /* --- Animation selection --- */
     if (_player_state == PSTATE_DIE) {
         /* Show death animation frame */
-        tile_idx = (uint8_t)(PLAYER_ANIM_DIE_START);
+        tile_idx = (uint8_t)(_player_sprite->tile_base + PLAYER_ANIM_DIE_START);
     } else if (_player_state == PSTATE_JUMP) {
         _player_sprite->anim_frame = (_player_vy < 0) ? 0U : 1U;
-        tile_idx = (uint8_t)(PLAYER_ANIM_JUMP_START +
+        tile_idx = (uint8_t)(_player_sprite->tile_base + PLAYER_ANIM_JUMP_START +
                               _player_sprite->anim_frame * PLAYER_TILES_PER_FRAME);
     } else {
         anim_start  = (_player_state == PSTATE_WALK) ? PLAYER_ANIM_WALK_START
@@ -346,7 +323,7 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
             _player_sprite->anim_frame   =
                 (uint8_t)((_player_sprite->anim_frame + 1U) % anim_frames);
         }
-        tile_idx = (uint8_t)(anim_start +
+        tile_idx = (uint8_t)(_player_sprite->tile_base + anim_start +
                               _player_sprite->anim_frame * PLAYER_TILES_PER_FRAME);
     }
 
@@ -367,9 +344,6 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
     } else {
         prop = (uint8_t)(prop | S_FLIPX);
     }
-    /* window is drawn above sprites; we can't place a sprite behind it,
-       so we will hide the hardware objects when the player drops into the
-       HUD region (see movement below). */
     set_sprite_prop(0U, prop);
 
     prop = get_sprite_prop(1U);
@@ -380,20 +354,23 @@ uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
     }
     set_sprite_prop(1U, prop);
 
+    return events;
+}
+
+BANKREF(player_draw)
+void player_draw(uint16_t camera_x) BANKED
+{
+    uint8_t hw_x, hw_y;
+
+    /* Screen-relative world_x for sprites_collide() */
+    _player_sprite->world_x = (uint8_t)(_player_world_x16 - camera_x);
+
     /* --- Move player OBJ slots --- */
-    hw_x = (uint8_t)(_player_world_x16 - (uint16_t)(*camera_x) + 8U);
+    hw_x = (uint8_t)(_player_sprite->world_x + 8U);
     hw_y = (uint8_t)(_player_sprite->world_y + 16U);
-    /* hide sprites if they would overlap the HUD window; they will be
-       respawned when the level restarts or player is reset. */
-    if (hw_y >= HUD_WIN_Y) {
-        move_sprite(0U, 0U, 0U);
-        move_sprite(1U, 0U, 0U);
-    } else {
-        move_sprite(0U, hw_x, hw_y);
-        move_sprite(1U, (uint8_t)(hw_x + 8U), hw_y);
-    }
-
-    return events;
+    /* No HUD check: OBJ display is off below the HUD line (frame.h) */
+    move_sprite(0U, hw_x, hw_y);
+    move_sprite(1U, (uint8_t)(hw_x + 8U), hw_y);
 }
 
 BANKREF(player_cleanup)
@@ -417,6 +394,12 @@ uint16_t player_get_world_x16(void) BANKED
     return _player_world_x16;
 }
 
+BANKREF(player_shift_x)
+void player_shift_x(uint16_t dx) BANKED
+{
+    _player_world_x16 = (uint16_t)(_player_world_x16 - dx);
+}
+
 BANKREF(player_is_facing_right)
 uint8_t player_is_facing_right(void) BANKED
 {
@@ -9,7 +9,8 @@
  * Player sprite – provides init, update, and cleanup for the player.
  *
  * Call player_init() once when entering the gameplay state.
- * Call player_update() every frame (after vsync).
+ * Call player_update() every frame (after vsync), then player_draw() once
+ * the camera has followed the new position.
  * Call player_cleanup() when leaving the gameplay state.
  * ----------------------------------------------------------------------- */
 
@@ -17,23 +18,38 @@
 #define PLAYER_EVENT_JUMPED    0x01U  /* player jumped this frame     */
 #define PLAYER_EVENT_FELL_GAP  0x02U  /* player fell into a gap       */
 #define PLAYER_EVENT_DIED      0x04U  /* death animation completed    */
+#define PLAYER_EVENT_LANDED    0x08U  /* touched down after a jump/fall */
 
 /* Initialise and allocate the player sprite.
  * start_x   : starting world-X position
  * ground_y  : world-Y when standing on the ground (sprite top of ground frame)
- * tile_base : first VRAM tile slot used by player tile data */
+ * tile_base : first VRAM tile slot used by player tile data
+ * prop      : OBJ attributes (CGB palette, VRAM bank bit of the tiles) */
 BANKREF_EXTERN(player_init)
-void player_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base) BANKED;
+void player_init(uint8_t start_x, uint8_t ground_y, uint8_t tile_base,
+                 uint8_t prop) BANKED;
 
-/* Update player for one frame.
+/* Put the already-allocated player back on its feet at a respawn point.
+ * Resets physics, facing and animation without touching VRAM.
+ * world_x16 : respawn world-X position
+ * ground_y  : world-Y when standing on the ground
+ * camera_x  : camera X scroll value the level was rebuilt around */
+BANKREF_EXTERN(player_respawn)
+void player_respawn(uint16_t world_x16, uint8_t ground_y, uint16_t camera_x) BANKED;
+
+/* Update player movement, physics and animation for one frame.
  * joy       : current joypad state
- * joy_press : buttons newly pressed this frame (joy & ~prev_joy)
- * camera_x  : pointer to current camera X scroll value; updated in place
+ * joy_press : buttons pressed recently and not yet acted on
+ *             (input_buffered(); a jump is taken as soon as it can be)
  * min_world_x : leftward movement limit (ring-buffer safety, world pixels)
  * Returns   : bitmask of PLAYER_EVENT_* flags */
 BANKREF_EXTERN(player_update)
-uint8_t player_update(uint8_t joy, uint8_t joy_press, uint8_t *camera_x,
-                      uint16_t min_world_x) BANKED;
+uint8_t player_update(uint8_t joy, uint8_t joy_press, uint16_t min_world_x) BANKED;
+
+/* Place the player's OBJ slots (and its screen-relative world_x used by
+ * sprites_collide()) for the given camera X. */
+BANKREF_EXTERN(player_draw)
+void player_draw(uint16_t camera_x) BANKED;
 
 /* Free the player sprite and hide its OBJ slots. */
 BANKREF_EXTERN(player_cleanup)
@@ -55,6 +71,11 @@ uint8_t player_is_jumping(void) BANKED;
 BANKREF_EXTERN(player_get_world_x16)
 uint16_t player_get_world_x16(void) BANKED;
 
+/* Move the player dx pixels left with the rest of the world (the endless
+ * runner's rebase); the screen position is unchanged. */
+BANKREF_EXTERN(player_shift_x)
+void player_shift_x(uint16_t dx) BANKED;
+
 /* Trigger the player death animation. */
 BANKREF_EXTERN(player_die)
 void player_die(void) BANKED;
@@ -3,10 +3,15 @@
 #include <gbdk/platform.h>
 #include <gb/gb.h>
 #include <gb/cgb.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "states.h"
+#include "frame.h"
+#include "input.h"
+#include "palette.h"
 #include "state_gameover.h"
 #include "utils.h"
+#include "vram.h"
 #include "bg_gameover.h"
 #include "font.h"
 
@@ -18,61 +23,57 @@ static const palette_color_t gameover_font_palette[4] = {
     RGB8( 85,  85,  85),   /* 3 - unused                      */
 };
 
-/* Font starts immediately after bg_gameover tiles in VRAM */
-#define FONT_FIRST_TILE  BG_GAMEOVER_TILE_COUNT
-
-static uint8_t prev_joy;
+static uint8_t sky_cycle;   /* palette cycle handle for the glowing sky */
 
 static void gameover_init(void)
 {
-    prev_joy = 0;
-
-    /* Load game-over background tiles into VRAM slot 0 */
-    set_bkg_data(0, BG_GAMEOVER_TILE_COUNT, bg_gameover_tiles);
-    /* Font tiles immediately after background tiles */
-    set_bkg_data(BG_GAMEOVER_TILE_COUNT, FONT_TILE_COUNT, font_tiles);
+    /* Background and font tiles wherever the allocator puts them; both
+     * are released with this state's arena */
+    uint8_t bg   = BG_GAMEOVER_VRAM_LOAD();
+    uint8_t font = FONT_VRAM_LOAD();
 
     /* Set game-over background palettes (slots 0-1) */
-    set_bkg_palette(0, BG_GAMEOVER_PALETTE_COUNT, bg_gameover_palettes);
+    palette_set_bkg(0, BG_GAMEOVER_PALETTE_COUNT, bg_gameover_palettes);
     /* Font palette with dark-crimson background (slot 2) */
-    set_bkg_palette(2, 1, gameover_font_palette);
+    palette_set_bkg(2, 1, gameover_font_palette);
 
     /* Load tilemap and palette attributes; reset scroll */
-    set_bkg_tiles(0, 0, BG_GAMEOVER_MAP_WIDTH, BG_GAMEOVER_MAP_HEIGHT,
-                  bg_gameover_map);
-    VBK_REG = 1;
-    set_bkg_tiles(0, 0, BG_GAMEOVER_MAP_WIDTH, BG_GAMEOVER_MAP_HEIGHT,
-                  bg_gameover_attr_map);
-    VBK_REG = 0;
+    vram_set_bkg_submap(bg, 0, 0, BG_GAMEOVER_MAP_WIDTH, BG_GAMEOVER_MAP_HEIGHT,
+                        bg_gameover_map, bg_gameover_attr_map,
+                        BG_GAMEOVER_MAP_WIDTH);
 
-    SCX_REG = 0;
-    SCY_REG = 0;
+    frame_scx = 0;
+    frame_scy = 0;
 
     HIDE_WIN;  /* hide the HUD window shown during gameplay */
 
-    draw_text(5,  6, "GAME OVER",   FONT_FIRST_TILE);
-    draw_text(2,  9, "PRESS START", FONT_FIRST_TILE);
+    draw_text(5,  6, "GAME OVER",   font);
+    draw_text(2,  9, "PRESS START", font);
+
+    /* Smouldering sky: rotate the red / orange sky colours (1-2) */
+    sky_cycle = palette_cycle_start(PAL_BKG(0), 1U, 2U, 20U);
+    palette_fade_in(PAL_FADE_SPEED);
 }
 
 static void gameover_update(void)
 {
-    uint8_t joy       = joypad();
-    uint8_t joy_press = (uint8_t)(joy & ~prev_joy);
-
-    if (joy_press & J_START) {
+    if (input_pressed() & J_START) {
+        palette_fade_out(PAL_FADE_BLACK, PAL_FADE_SPEED);
+        palette_fade_wait();
         switch_state(STATE_TITLE_SCREEN);
     }
-    prev_joy = joy;
 }
 
 static void gameover_cleanup(void)
 {
-    /* Nothing to clean up */
+    palette_cycle_stop(sky_cycle);
 }
 
 BANKREF(state_gameover)
 const GameState state_gameover = {
     gameover_init,
     gameover_update,
-    gameover_cleanup
+    gameover_cleanup,
+    NULL,   /* pause  */
+    NULL    /* resume */
 };
@@ -3,27 +3,46 @@
 #include <gbdk/platform.h>
 #include <gb/gb.h>
 #include <gb/cgb.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <rand.h>
 #include "states.h"
+#include "behaviour.h"
+#include "camera.h"
+#include "frame.h"
+#include "input.h"
+#include "level.h"
+#include "palette.h"
+#include "profiler.h"
+#include "particle.h"
+#include "projectile.h"
+#include "replay.h"
+#include "save.h"
+#include "sfx.h"
 #include "state_gameplay.h"
+#include "state_pause.h"
+#include "tile_anim.h"
 #include "sprite.h"
 #include "sprite_manager.h"
 #include "sprite_player.h"
 #include "sprite_enemy.h"
+#include "vram.h"
 #include "bg_gameplay.h"
+#include "bg_level2.h"
+#include "sfx_defs.h"
 #include "font.h"
 #include "player.h"
 #include "enemy.h"
+#include "shot.h"
+#include "fx.h"
 
 /* -----------------------------------------------------------------------
  * Constants
  * -------------------------------------------------------------------- */
-/* Font starts immediately after background tiles in VRAM */
-#define FONT_FIRST_TILE  BG_GAMEPLAY_TILE_COUNT
-
-/* Win condition: reached the finish flag.  flag is one tile beyond
- * the previous checkpoint so we must bump the world‑X accordingly.       */
-#define CHECKPOINT_X16   368U   /* world-X >= 368 triggers win           */
+/* Tiles come from the VRAM allocator (vram.h): the font and the sprite
+ * sets stay put while each level's tiles are swapped in and out around
+ * them.  Spawn points, checkpoints and the win line all come from the
+ * level data.                                                            */
 
 /* HUD window */
 #define HUD_WIN_Y        112U   /* window Y: bottom 4 tile rows (32 px)  */
@@ -33,15 +52,84 @@
 /* Collision */
 #define COLLISION_COOLDOWN  60U  /* vblanks of invincibility after a hit */
 
+/* Projectiles: OBJ slots after the player (0-1) and the enemy (2) */
+#define PROJ_FIRST_OBJ      3U
+#define PROJ_PAL            2U   /* OBJ palette slot loaded by main.c    */
+#define SHOT_SPEED          3    /* player shot, px/frame                */
+#define SHOT_LIFE          60U
+#define SHOT_COOLDOWN       8U   /* frames between player shots          */
+#define SHOT_SCORE          5U   /* points for hitting the enemy         */
+#define BULLET_SPEED        2    /* enemy bullet, px/frame               */
+#define BULLET_LIFE       120U
+
+/* Particles: the OBJ slots left after the projectiles (OBJ 27..38) */
+#define PART_FIRST_OBJ     (PROJ_FIRST_OBJ + PROJ_MAX)
+#define PART_OBJS          12U
+#define PART_PAL            3U   /* OBJ palette slot loaded by main.c    */
+
+/* Player and enemy OBJ palette slots loaded by main.c */
+#define PLAYER_PAL          0U
+#define ENEMY_PAL           1U
+
 /* Timer: 60 seconds at ~60 vblanks/sec */
 #define TIMER_START      3600U
 
-/* Column streaming constants (48-tile level, 32-tile ring buffer) */
-#define SCROLL_L_LIMIT     60U   /* must match sprite_player.c           */
+/* Profiler phases (make PROFILE=1) – overlay drawn on HUD window row 3 */
+#define PROF_STREAM       0U
+#define PROF_INPUT        1U
+#define PROF_PLAYER       2U
+#define PROF_ENEMY        3U
+#define PROF_COLLIDE      4U
+#define PROF_HUD          5U
+#define PROF_SHOTS        6U
+#define PROF_FX           7U
+#define PROF_PHASE_COUNT  8U
+#define PROF_ROW          3U
+
+/* Camera: the player walks freely between these screen-X limits */
+#define CAM_DZ_LEFT        60U
+#define CAM_DZ_RIGHT      100U
+#define CAM_LOOK_SCALE     16U   /* look-ahead pixels per pixel/frame    */
+#define CAM_LOOK_MAX       16U
+#define CAM_SMOOTH_SHIFT    2U   /* close 1/4 of the gap per frame       */
+#define CAM_MAX_STEP        2U   /* px/frame; <= 8 for column streaming  */
+
+/* Endless runner: every chunk pattern starts and ends on plain ground, so
+ * checkpoints and enemy respawns go on chunk edges.  A lap is the 256
+ * columns after which 8-bit column numbers repeat. */
+#define RUNNER_CHUNK_PX    (LEVEL_CHUNK_W * 8U)
+#define RUNNER_CHECKPOINT_PX 512U   /* 8 chunks between checkpoints      */
+#define RUNNER_LAP_PX     2048U
+#define RUNNER_LEASH_PX    256U   /* enemy further behind is moved ahead */
 
 /* -----------------------------------------------------------------------
- * Font palette for gameplay sky
+ * Particle kinds (velocities in 1/16 px per frame; tiles relative to the
+ * fx tiles)
  * -------------------------------------------------------------------- */
+static const ParticleKind fx_dust = {
+    FX_ANIM_DUST_START,  14U, 12U, 4U, -6, 1
+};
+static const ParticleKind fx_spark = {
+    FX_ANIM_SPARK_START, 12U, 24U, 24U, -8, 2
+};
+static const ParticleKind fx_star = {
+    FX_ANIM_STAR_START,  40U, 20U, 12U, -24, 2
+};
+
+/* -----------------------------------------------------------------------
+ * Levels, played in order.  Each descriptor sits in the bank of its own
+ * data; level.h's accessors do the bank switching.
+ * -------------------------------------------------------------------- */
+static const LevelRef levels[] = {
+    LEVEL_REF(bg_gameplay_level),
+    LEVEL_REF(bg_level2_level)
+};
+#define LEVEL_COUNT  ((uint8_t)(sizeof(levels) / sizeof(levels[0])))
+
+/* Endless runner: one generated level with no end, seeded from the
+ * session seed */
+static const LevelRef runner_level = LEVEL_REF(bg_gameplay_runner_level);
+
 static const palette_color_t gameplay_font_palette[4] = {
     RGB8(155, 200, 234),   /* 0 - sky blue background */
     RGB8(  0,   0,   0),   /* 1 - black text          */
@@ -52,37 +140,65 @@ static const palette_color_t gameplay_font_palette[4] = {
 /* -----------------------------------------------------------------------
  * Game state
  * -------------------------------------------------------------------- */
-static uint8_t  camera_x;
 static uint16_t score;
 static uint8_t  lives;
-static uint8_t  prev_joy;
 static uint8_t  collision_cooldown;
+static uint8_t  shot_cooldown;     /* frames until the player may fire again */
 static uint16_t time_remaining;
 static uint8_t  last_seconds;
 static uint8_t  bg_stream_right;   /* next column to stream into the ring buffer */
+static uint8_t  bg_stream_left;    /* first column still in the ring buffer  */
+static uint16_t respawn_x16;       /* world-X the player respawns at         */
+static uint8_t  next_checkpoint;   /* index of the next checkpoint to pass   */
+static uint16_t next_cp_x16;       /* endless: world-X of the next one       */
+static uint8_t  level_index;       /* index into levels[]                    */
+static uint8_t  level_won;         /* set when the last level is finished    */
+static uint8_t  endless;           /* endless runner instead of levels[]     */
+
+/* VRAM handles (vram.h) and what the HUD and spawns need from them */
+static uint8_t  font_vram;
+static uint8_t  level_vram;        /* current level's BG tiles               */
+static uint8_t  player_vram;
+static uint8_t  enemy_vram;
+static uint8_t  shot_vram;
+static uint8_t  fx_vram;
+static uint8_t  font_tile;         /* BG tile of ASCII 32                    */
+static uint8_t  font_attr;         /* VRAM bank bit of the font tiles        */
+static uint8_t  shot_tile;         /* OBJ tile of the first shot frame       */
 
 /* -----------------------------------------------------------------------
  * Column streaming
  *
- * The GBC hardware background is a 32x32 tile ring buffer.  We store
- * a 48x18 level map in ROM and stream one column at a time into the
- * ring buffer as the camera scrolls right.
+ * The GBC hardware background is a 32x32 tile ring buffer.  Level maps
+ * are wider (up to 255 columns) and stay in ROM; one column at a time is
+ * streamed into the ring buffer as the camera scrolls right.  The
+ * endless runner's columns are generated as they are streamed and never
+ * run out: column numbers are 8-bit and wrap from 255 to 0 (level.h), so
+ * the stream positions below are compared modulo 256.
+ *
+ * set_bkg_submap() masks the destination X to 5 bits, so level column N
+ * always lands in ring column N % 32 and a range may wrap freely.
  * -------------------------------------------------------------------- */
-static void load_bg_column(uint8_t level_col)
+/* Place the camera for a player standing at spawn_x16 (at the left edge
+ * of the dead-zone, clamped to the level) and load only the columns it
+ * can see plus the next one.  The rest is filled by the normal streamer. */
+static void reset_view(uint16_t spawn_x16)
 {
-    uint8_t bg_col = (uint8_t)(level_col % 32U);
-    uint8_t row;
-    VBK_REG = 0;
-    for (row = 0; row < BG_GAMEPLAY_MAP_HEIGHT; row++) {
-        set_bkg_tile_xy(bg_col, row,
-            bg_gameplay_map[(uint16_t)row * BG_GAMEPLAY_MAP_WIDTH + level_col]);
-    }
-    VBK_REG = 1;
-    for (row = 0; row < BG_GAMEPLAY_MAP_HEIGHT; row++) {
-        set_bkg_tile_xy(bg_col, row,
-            bg_gameplay_attr_map[(uint16_t)row * BG_GAMEPLAY_MAP_WIDTH + level_col]);
+    uint8_t first_col, count;
+
+    camera_set_min_x(0U);
+    camera_snap(spawn_x16, 0U);
+
+    first_col = camera.col_left;
+    count     = (uint8_t)(camera.col_right - first_col + 2U);
+    if (level.width && (uint16_t)first_col + count > level.width) {
+        count = (uint8_t)(level.width - first_col);
     }
-    VBK_REG = 0;
+    level_set_columns(first_col, count);
+    bg_stream_left  = first_col;
+    bg_stream_right = (uint8_t)(first_col + count);
+
+    frame_scx = (uint8_t)camera.x;
 }
 
 /* -----------------------------------------------------------------------
@@ -94,9 +210,10 @@ static void hud_write_text(uint8_t x, uint8_t y, const char *str, uint8_t pal)
     VBK_REG = 0;
     while (str[i]) {
         set_win_tile_xy((uint8_t)(x + i), y,
-                        (uint8_t)(FONT_FIRST_TILE + str[i] - 32U));
+                        (uint8_t)(font_tile + str[i] - 32U));
         i++;
     }
+    pal = (uint8_t)(pal | font_attr);
     VBK_REG = 1;
     for (uint8_t j = 0; j < i; j++) {
         set_win_tile_xy((uint8_t)(x + j), y, pal);
@@ -113,22 +230,22 @@ static void hud_update_score(void)
     uint8_t d0 = (uint8_t)(s % 10U);
 
     VBK_REG = 0;
-    set_win_tile_xy(7U, 1U, (uint8_t)(FONT_FIRST_TILE + d0 + ('0' - 32U)));
-    set_win_tile_xy(8U, 1U, (uint8_t)(FONT_FIRST_TILE + d1 + ('0' - 32U)));
-    set_win_tile_xy(9U, 1U, (uint8_t)(FONT_FIRST_TILE + d2 + ('0' - 32U)));
-    set_win_tile_xy(10U, 1U, (uint8_t)(FONT_FIRST_TILE + d3 + ('0' - 32U)));
+    set_win_tile_xy(7U, 1U, (uint8_t)(font_tile + d0 + ('0' - 32U)));
+    set_win_tile_xy(8U, 1U, (uint8_t)(font_tile + d1 + ('0' - 32U)));
+    set_win_tile_xy(9U, 1U, (uint8_t)(font_tile + d2 + ('0' - 32U)));
+    set_win_tile_xy(10U, 1U, (uint8_t)(font_tile + d3 + ('0' - 32U)));
     VBK_REG = 1;
-    set_win_tile_xy(7U, 1U, HUD_PAL);
-    set_win_tile_xy(8U, 1U, HUD_PAL);
-    set_win_tile_xy(9U, 1U, HUD_PAL);
-    set_win_tile_xy(10U, 1U, HUD_PAL);
+    set_win_tile_xy(7U, 1U, HUD_PAL | font_attr);
+    set_win_tile_xy(8U, 1U, HUD_PAL | font_attr);
+    set_win_tile_xy(9U, 1U, HUD_PAL | font_attr);
+    set_win_tile_xy(10U, 1U, HUD_PAL | font_attr);
     VBK_REG = 0;
 }
 
 static void hud_update_lives(void)
 {
-    uint8_t heart_tile = (uint8_t)(FONT_FIRST_TILE + FONT_TILE_HEART);
-    uint8_t space_tile = (uint8_t)(FONT_FIRST_TILE);
+    uint8_t heart_tile = (uint8_t)(font_tile + FONT_TILE_HEART);
+    uint8_t space_tile = (uint8_t)(font_tile);
     uint8_t i;
 
     VBK_REG = 0;
@@ -138,7 +255,7 @@ static void hud_update_lives(void)
     }
     VBK_REG = 1;
     for (i = 0; i < 3U; i++) {
-        set_win_tile_xy((uint8_t)(7U + i), 2U, HUD_RED_PAL);
+        set_win_tile_xy((uint8_t)(7U + i), 2U, HUD_RED_PAL | font_attr);
     }
     VBK_REG = 0;
 }
@@ -151,17 +268,17 @@ static void hud_update_time(void)
     uint8_t i;
 
     VBK_REG = 0;
-    set_win_tile_xy(12U, 1U, (uint8_t)(FONT_FIRST_TILE + 'T' - 32U));
-    set_win_tile_xy(13U, 1U, (uint8_t)(FONT_FIRST_TILE + 'I' - 32U));
-    set_win_tile_xy(14U, 1U, (uint8_t)(FONT_FIRST_TILE + 'M' - 32U));
-    set_win_tile_xy(15U, 1U, (uint8_t)(FONT_FIRST_TILE + 'E' - 32U));
-    set_win_tile_xy(16U, 1U, (uint8_t)(FONT_FIRST_TILE + ':' - 32U));
-    set_win_tile_xy(17U, 1U, (uint8_t)(FONT_FIRST_TILE + ' ' - 32U));
-    set_win_tile_xy(18U, 1U, (uint8_t)(FONT_FIRST_TILE + d1 + ('0' - 32U)));
-    set_win_tile_xy(19U, 1U, (uint8_t)(FONT_FIRST_TILE + d0 + ('0' - 32U)));
+    set_win_tile_xy(12U, 1U, (uint8_t)(font_tile + 'T' - 32U));
+    set_win_tile_xy(13U, 1U, (uint8_t)(font_tile + 'I' - 32U));
+    set_win_tile_xy(14U, 1U, (uint8_t)(font_tile + 'M' - 32U));
+    set_win_tile_xy(15U, 1U, (uint8_t)(font_tile + 'E' - 32U));
+    set_win_tile_xy(16U, 1U, (uint8_t)(font_tile + ':' - 32U));
+    set_win_tile_xy(17U, 1U, (uint8_t)(font_tile + ' ' - 32U));
+    set_win_tile_xy(18U, 1U, (uint8_t)(font_tile + d1 + ('0' - 32U)));
+    set_win_tile_xy(19U, 1U, (uint8_t)(font_tile + d0 + ('0' - 32U)));
     VBK_REG = 1;
     for (i = 12U; i < 20U; i++) {
-        set_win_tile_xy(i, 1U, HUD_PAL);
+        set_win_tile_xy(i, 1U, HUD_PAL | font_attr);
     }
     VBK_REG = 0;
 }
@@ -175,13 +292,13 @@ static void hud_init(void)
     VBK_REG = 0;
     for (row = 0; row < 4U; row++) {
         for (x = 0; x < 20U; x++) {
-            set_win_tile_xy(x, row, (uint8_t)(FONT_FIRST_TILE));
+            set_win_tile_xy(x, row, (uint8_t)(font_tile));
         }
     }
     VBK_REG = 1;
     for (row = 0; row < 4U; row++) {
         for (x = 0; x < 20U; x++) {
-            set_win_tile_xy(x, row, HUD_PAL);
+            set_win_tile_xy(x, row, HUD_PAL | font_attr);
         }
     }
     VBK_REG = 0;
@@ -194,50 +311,352 @@ static void hud_init(void)
 }
 
 /* -----------------------------------------------------------------------
- * State callbacks
+ * Player hit by the enemy or one of its bullets
  * -------------------------------------------------------------------- */
-static void gameplay_init(void)
+static void player_hurt(void)
 {
-    uint8_t col;
+    if (lives > 0U) {
+        lives--;
+        hud_update_lives();
+    }
+    /* Start death animation instead of immediate game over */
+    player_die();
+    particle_emit(&fx_star, (uint16_t)(player_get_world_x16() + 4U),
+                  (uint8_t)(player_get_sprite()->world_y + 4U), 8U);
+    sfx_play(SFX_HIT, SFX_PRIO_DEFAULT);
+    collision_cooldown = COLLISION_COOLDOWN;
+    /* Blink the player's OBJ palette white for the invincibility window */
+    palette_flash(PAL_OBJ(0), RGB8(255, 255, 255), 4U, COLLISION_COOLDOWN);
+}
 
-    camera_x           = 0;
-    score              = 0;
-    lives              = 3;
-    prev_joy           = 0;
+/* -----------------------------------------------------------------------
+ * Projectiles: player shots (B) and the enemy's bullets, aimed at the
+ * player.  All of them move and collide in one batch per frame.
+ * -------------------------------------------------------------------- */
+static void update_projectiles(uint8_t joy_buffered)
+{
+    Sprite  *enemy = enemy_get_sprite();
+    uint16_t px    = player_get_world_x16();
+    uint16_t ex;
+    uint8_t  py    = player_get_sprite()->world_y;
+
+    if (shot_cooldown > 0U) shot_cooldown--;
+    if ((joy_buffered & J_B) && shot_cooldown == 0U && !player_is_dying()) {
+        input_consume(J_B);
+        if (player_is_facing_right()) {
+            projectile_spawn((uint16_t)(px + 16U), (uint8_t)(py + 4U), SHOT_SPEED, 0,
+                             SHOT_LIFE, shot_tile + SHOT_ANIM_PLAYER_START,
+                             PROJ_OWNER_PLAYER);
+        } else {
+            projectile_spawn((uint16_t)(px - 8U), (uint8_t)(py + 4U), -SHOT_SPEED, 0,
+                             SHOT_LIFE, shot_tile + SHOT_ANIM_PLAYER_START,
+                             PROJ_OWNER_PLAYER);
+        }
+        shot_cooldown = SHOT_COOLDOWN;
+        sfx_play(SFX_LASER, SFX_PRIO_DEFAULT);
+    }
+
+    /* The enemy's script fires; bullets only come while it is on screen */
+    if ((enemy_events() & BHV_EV_FIRE) && enemy->active) {
+        ex = enemy_get_world_x16();
+        projectile_spawn(ex, enemy->world_y, (px < ex) ? -BULLET_SPEED : BULLET_SPEED, 0,
+                         BULLET_LIFE, shot_tile + SHOT_ANIM_ENEMY_START,
+                         PROJ_OWNER_ENEMY);
+    }
+
+    projectile_update(camera.x);
+
+    if (projectile_hit(enemy, PROJ_OWNER_PLAYER)) {
+        particle_emit(&fx_spark, enemy_get_world_x16(), enemy->world_y, 4U);
+        score += SHOT_SCORE;
+        hud_update_score();
+        palette_flash(PAL_OBJ(1), RGB8(255, 255, 255), 2U, 16U);
+    }
+    /* Bullets pass through the player while it is invincible */
+    if (collision_cooldown == 0U && !player_is_dying() &&
+        projectile_hit(player_get_sprite(), PROJ_OWNER_ENEMY)) {
+        player_hurt();
+    }
+
+    projectile_draw();
+}
+
+#ifdef PROFILE
+/* -----------------------------------------------------------------------
+ * Profiler overlay
+ *
+ * SELECT toggles it.  One phase is shown per profiler window (~1 s), as
+ * "NAME min/avg/max Lnn" in scanlines, plus lag frames in that window.
+ * -------------------------------------------------------------------- */
+static const char * const prof_names[PROF_PHASE_COUNT] = {
+    "STRM", "INPT", "PLYR", "ENMY", "COLL", "HUD ", "SHOT", "FX  "
+};
+
+static uint8_t prof_overlay;
+static uint8_t prof_phase;
+
+static void prof_put3(char *dst, uint8_t v)
+{
+    dst[0] = (char)('0' + v / 100U);
+    dst[1] = (char)('0' + (v / 10U) % 10U);
+    dst[2] = (char)('0' + v % 10U);
+}
+
+static void prof_draw_overlay(void)
+{
+    char line[21];
+    const ProfilerStat *st = profiler_stat(prof_phase);
+    uint8_t lag = profiler_lag_frames();
+    uint8_t i;
+
+    for (i = 0; i < 4U; i++) line[i] = prof_names[prof_phase][i];
+    line[4] = ' ';
+    prof_put3(&line[5], st->min);
+    line[8] = '/';
+    prof_put3(&line[9], st->avg);
+    line[12] = '/';
+    prof_put3(&line[13], st->max);
+    line[16] = ' ';
+    line[17] = 'L';
+    line[18] = (char)('0' + (lag > 99U ? 9U : lag / 10U));
+    line[19] = (char)('0' + (lag > 99U ? 9U : lag % 10U));
+    line[20] = '\0';
+    hud_write_text(0U, PROF_ROW, line, HUD_PAL);
+
+    prof_phase = (uint8_t)((prof_phase + 1U) % PROF_PHASE_COUNT);
+}
+#endif
+
+/* -----------------------------------------------------------------------
+ * Endless runner
+ *
+ * Checkpoints come every RUNNER_CHECKPOINT_PX and refill the timer.  The
+ * enemy is brought back ahead of the view once it is left behind, and
+ * the whole world moves back a lap when the respawn point passes one, so
+ * world X stays small (particles hold it in 12.4 fixed point).  Moving by
+ * a lap keeps every 8-bit column number, so the ring buffer, the stream
+ * positions and the generated columns are untouched.
+ * -------------------------------------------------------------------- */
+/* Enemy restarts its script on the first chunk edge right of the view */
+static void runner_place_enemy(void)
+{
+    enemy_cleanup();
+    enemy_init((uint16_t)((camera.x + CAMERA_VIEW_W + RUNNER_CHUNK_PX)
+                          & ~(uint16_t)(RUNNER_CHUNK_PX - 1U)),
+               level.enemy_y, vram_tile(enemy_vram),
+               ENEMY_PAL | vram_attr(enemy_vram), level.enemy_behaviour);
+}
+
+static void runner_update(void)
+{
+    /* Checkpoint: respawn on the ground either side of this chunk edge */
+    if (player_get_world_x16() >= next_cp_x16) {
+        respawn_x16 = (uint16_t)(next_cp_x16 - 8U);
+        next_cp_x16 += RUNNER_CHECKPOINT_PX;
+        if (next_checkpoint < 255U) next_checkpoint++;
+        time_remaining = TIMER_START;
+        last_seconds   = 60U;
+        hud_update_time();
+        palette_flash(PAL_BKG(HUD_PAL), RGB8(255, 255, 0), 4U, 32U);
+        sfx_play(SFX_CHECKPOINT, SFX_PRIO_DEFAULT);
+    }
+
+    if (respawn_x16 >= RUNNER_LAP_PX) {
+        camera_shift_x(RUNNER_LAP_PX);
+        player_shift_x(RUNNER_LAP_PX);
+        projectile_shift_x(RUNNER_LAP_PX);
+        particle_shift_x(RUNNER_LAP_PX);
+        respawn_x16 -= RUNNER_LAP_PX;
+        next_cp_x16 -= RUNNER_LAP_PX;
+        if (enemy_get_world_x16() >= RUNNER_LAP_PX) {
+            enemy_shift_x(RUNNER_LAP_PX);
+        } else {
+            runner_place_enemy();
+        }
+    }
+
+    if (camera.x > RUNNER_LEASH_PX &&
+        enemy_get_world_x16() < (uint16_t)(camera.x - RUNNER_LEASH_PX)) {
+        runner_place_enemy();
+    }
+}
+
+/* -----------------------------------------------------------------------
+ * Respawn
+ *
+ * Losing a life resets only entity, physics and timer state: tiles,
+ * palettes, HUD text, score and lives are left alone, and the background
+ * is rebuilt for the visible columns around the respawn point only.
+ * -------------------------------------------------------------------- */
+static void gameplay_respawn(void)
+{
     collision_cooldown = 0;
     time_remaining     = TIMER_START;
     last_seconds       = 60U;
-    bg_stream_right    = 0;
+    hud_update_time();
 
-    sprite_manager_init();
+    reset_view(respawn_x16);
+    player_respawn(respawn_x16, level.player_y, camera.x);
+    projectile_clear();
+    particle_clear();
+    shot_cooldown    = 0;
 
-    /* Load gameplay background tiles (slot 0..BG_GAMEPLAY_TILE_COUNT-1) */
-    set_bkg_data(0, BG_GAMEPLAY_TILE_COUNT, bg_gameplay_tiles);
-    /* Font tiles immediately after background tiles */
-    set_bkg_data(BG_GAMEPLAY_TILE_COUNT, FONT_TILE_COUNT, font_tiles);
+    /* Enemy goes back to its start and restarts its script (no VRAM work);
+     * in the endless runner its start is just ahead of the view */
+    if (endless) {
+        runner_place_enemy();
+        return;
+    }
+    enemy_cleanup();
+    enemy_init(level.enemy_x, level.enemy_y, vram_tile(enemy_vram),
+               ENEMY_PAL | vram_attr(enemy_vram), level.enemy_behaviour);
+}
 
-    /* Background palettes (slots 0-1: sky and ground) */
-    set_bkg_palette(0, BG_GAMEPLAY_PALETTE_COUNT, bg_gameplay_palettes);
-    /* Font palette: sky-blue background, black text (slot 2) */
-    set_bkg_palette(2, 1, gameplay_font_palette);
+/* Black out for one frame so the view can be rebuilt off-screen, then
+ * fade straight back in while play resumes. */
+static void gameplay_restart(void)
+{
+    palette_fade_set(PAL_FADE_BLACK, PAL_FADE_STEPS);
+    palette_fade_wait();
+    gameplay_respawn();
+    frame_resync();  /* the blackout and rebuild are not lag */
+    input_flush();   /* no jump or shot carried over from the last life */
+    palette_fade_in(1U);
+}
 
-    /* Player: 16x16 -> 2 OBJ slots */
-    player_init(20U, 64U, 0U);
+/* -----------------------------------------------------------------------
+ * Level start
+ *
+ * Select levels[level_index] (or the endless runner, seeded from the
+ * session seed) and load everything that belongs to it:
+ * BG tiles and palettes, camera bounds, the visible columns, entities
+ * and the projectile collision map.  Score, lives, the font and the HUD
+ * carry over from the previous level; its BG tiles are released first.
+ * -------------------------------------------------------------------- */
+static void gameplay_load_level(void)
+{
+    if (endless) {
+        level_select(&runner_level);
+        level_set_seed(replay_seed());
+    } else {
+        level_select(&levels[level_index]);
+    }
 
-    /* Enemy: 8x8 -> 1 OBJ slot; tile_base after player tiles */
-    enemy_init(160U, 72U, PLAYER_TILE_COUNT);
+    collision_cooldown = 0;
+    shot_cooldown      = 0;
+    time_remaining     = TIMER_START;
+    last_seconds       = 60U;
+    respawn_x16        = level.player_x;
+    next_checkpoint    = 0;
+    next_cp_x16        = RUNNER_CHECKPOINT_PX;
+
+    /* Background tiles wherever the allocator has room, palettes 0-1;
+     * the level's animated tiles (the flag) are swapped in VBlank */
+    level_vram = level_load_tiles();
+    level_set_palettes(0);
+    tile_anim_start(level_bank, level.tile_anims, vram_tile(level_vram),
+                    vram_bank(level_vram));
+
+    /* Camera bounds come from the level size */
+    camera_init(level.width, level.height);
+    camera_set_deadzone(CAM_DZ_LEFT, CAM_DZ_RIGHT, 0U, CAMERA_VIEW_H - 1U);
+    camera_set_lookahead(CAM_LOOK_SCALE, CAM_LOOK_MAX);
+    camera_set_smoothing(CAM_SMOOTH_SHIFT, CAM_MAX_STEP);
+
+    /* Load the columns visible from the start position */
+    reset_view(respawn_x16);
+    frame_scy = 0;
 
-    /* Load initial 32 columns into hardware background ring buffer */
-    for (col = 0; col < 32U; col++) {
-        load_bg_column(col);
+    /* Player: 16x16 -> 2 OBJ slots */
+    player_init(level.player_x, level.player_y, vram_tile(player_vram),
+                PLAYER_PAL | vram_attr(player_vram));
+
+    /* Enemy: 8x8 -> 1 OBJ slot */
+    enemy_init(level.enemy_x, level.enemy_y, vram_tile(enemy_vram),
+               ENEMY_PAL | vram_attr(enemy_vram), level.enemy_behaviour);
+
+    /* Projectiles stop at the same solid tiles that block the player */
+    projectile_clear();
+    if (level.gen) {
+        projectile_set_map_reader(level_tile, level_bank, level.width,
+                                  level.height, level.solid, level.solid_count);
+    } else {
+        projectile_set_map(level_bank, level.map, level.width, level.height,
+                           level.solid, level.solid_count);
     }
-    bg_stream_right = 32U;
+    particle_clear();
+}
+
+/* Level finished: fade to white, then either load the next level (the
+ * HUD and score stay) or end the session on the win screen.  The endless
+ * runner never gets here. */
+static void gameplay_next_level(void)
+{
+    palette_fade_out(PAL_FADE_WHITE, PAL_FADE_SPEED);
+    palette_fade_wait();
+    if ((uint8_t)(level_index + 1U) >= LEVEL_COUNT) {
+        level_won = 1;
+        switch_state(STATE_WIN);
+        return;
+    }
+    level_index++;
+    player_cleanup();
+    enemy_cleanup();
+    tile_anim_stop();
+    vram_release(level_vram);
+    gameplay_load_level();
+    hud_update_time();
+    frame_resync();  /* the fade and the reload are not lag */
+    input_flush();
+    palette_fade_in(PAL_FADE_SPEED);
+}
 
-    SCX_REG = 0;
-    SCY_REG = 0;
+/* -----------------------------------------------------------------------
+ * State callbacks
+ * -------------------------------------------------------------------- */
+static void gameplay_init(void)
+{
+    score       = 0;
+    lives       = 3;
+    level_index = 0;
+    level_won   = 0;
+    endless     = (replay_seed() & GAMEPLAY_SEED_ENDLESS) ? 1U : 0U;
+
+    /* Same seed as the recording being made or replayed */
+    initrand(replay_seed());
+#ifdef PROFILE
+    prof_overlay       = 0;
+    prof_phase         = 0;
+    profiler_init(prof_names, PROF_PHASE_COUNT);
+#endif
+
+    sprite_manager_init();
+
+    /* Font tiles; the sprite sets loaded by main.c are only looked up
+     * (their data is already resident, so this just takes a reference) */
+    font_vram   = FONT_VRAM_LOAD();
+    font_tile   = vram_tile(font_vram);
+    font_attr   = vram_attr(font_vram);
+    player_vram = PLAYER_VRAM_LOAD();
+    enemy_vram  = ENEMY_VRAM_LOAD();
+    shot_vram   = SHOT_VRAM_LOAD();
+    shot_tile   = vram_tile(shot_vram);
+    fx_vram     = FX_VRAM_LOAD();
+    /* Font palette: sky-blue background, black text (slot 2) */
+    palette_set_bkg(2, 1, gameplay_font_palette);
+
+    projectile_init(PROJ_FIRST_OBJ, PROJ_PAL | vram_attr(shot_vram));
+    particle_init(PART_FIRST_OBJ, PART_OBJS, PART_PAL | vram_attr(fx_vram),
+                  vram_tile(fx_vram));
+    particle_seed(replay_seed());
+
+    gameplay_load_level();
 
     hud_init();
     SHOW_WIN;
+    frame_set_obj_limit(HUD_WIN_Y);   /* sprites stop at the HUD edge */
+
+    palette_fade_in(PAL_FADE_SPEED);
 }
 
 static void gameplay_update(void)
@@ -245,30 +664,54 @@ static void gameplay_update(void)
     uint8_t  joy;
     uint8_t  joy_press;
     uint8_t  events;
-    uint16_t min_world_x;
-    uint8_t  cam_tile, needed_col;
-
-    /* --- Hardware register + VRAM updates (VBlank window) ---
-     * main() calls vsync() immediately before run_current_state(), so
-     * this function is entered right at the start of VBlank.  Commit the
-     * scroll register and stream any pending BG column now while VRAM
-     * and registers are safely accessible.  No wait_vbl_done() needed
-     * here because we are already inside VBlank.                        */
-    SCX_REG = camera_x;
-
-    cam_tile   = (uint8_t)(camera_x >> 3);
-    needed_col = (uint8_t)(cam_tile + 21U);
-    if (needed_col < BG_GAMEPLAY_MAP_WIDTH && needed_col >= bg_stream_right) {
-        load_bg_column(bg_stream_right);
+    uint16_t min_world_x, min_x;
+    uint8_t  needed_col, held_cols;
+
+    /* --- Column streaming ---
+     * main() runs its own VBlank work (palettes, VWF, tile animation,
+     * sound) first and may run this several times to catch up, so this is
+     * not entered at the start of VBlank and can reach active display.
+     * Streaming relies on GBDK's map writes instead: set_bkg_based_submap()
+     * waits for STAT to report VRAM accessible before each byte, so a late
+     * column only costs stalls, and at most one column goes per tick.   */
+    PROF_BEGIN(PROF_STREAM);
+    needed_col = (uint8_t)(camera.col_right + 1U);
+    if ((!level.width || needed_col < level.width) &&
+        (int8_t)(uint8_t)(needed_col - bg_stream_right) >= 0) {
+        level_set_columns(bg_stream_right, 1U);
         bg_stream_right++;
     }
+    PROF_END(PROF_STREAM);
 
     /* --- Game logic (runs during active display) --- */
-    joy       = joypad();
-    joy_press = (uint8_t)(joy & ~prev_joy);
+    PROF_BEGIN(PROF_INPUT);
+    joy       = input_held();      /* sampled in VBlank, recorded / replayed */
+    joy_press = input_pressed();
+    PROF_END(PROF_INPUT);
+
+#ifdef PROFILE
+    /* --- Profiler overlay: SELECT toggles, refreshed once per window --- */
+    if (joy_press & J_SELECT) {
+        prof_overlay ^= 1U;
+        if (!prof_overlay) {
+            hud_write_text(0U, PROF_ROW, "                    ", HUD_PAL);
+        }
+    }
+    if (profiler_window_ready() && prof_overlay) {
+        prof_draw_overlay();
+    }
+#endif
+
+    /* --- Pause: push the overlay; everything here stays as it is --- */
+    if (joy_press & J_START) {
+        sfx_play(SFX_BLIP, SFX_PRIO_DEFAULT);
+        push_state(STATE_PAUSE);
+        return;
+    }
 
     /* --- Countdown timer --- */
     if (time_remaining > 0U) {
+        PROF_BEGIN(PROF_HUD);
         time_remaining--;
         {
             uint8_t secs = (uint8_t)(time_remaining / 60U);
@@ -277,40 +720,71 @@ static void gameplay_update(void)
                 hud_update_time();
             }
         }
+        PROF_END(PROF_HUD);
     } else {
+        palette_fade_out(PAL_FADE_BLACK, PAL_FADE_SPEED);
+        palette_fade_wait();
         switch_state(STATE_GAME_OVER);
         return;
     }
 
     /* --- Ring-buffer safety: compute min_world_x ---
-     * Camera left tile must stay >= (bg_stream_right - 32) at all times.
-     * Player must stay >= (bg_stream_right-32)*8 + SCROLL_L_LIMIT so the
-     * camera never exposes overwritten ring-buffer columns.              */
-    if (bg_stream_right > 32U) {
-        min_world_x = (uint16_t)((uint16_t)(bg_stream_right - 32U) * 8U
-                                 + (uint16_t)SCROLL_L_LIMIT);
+     * Camera left tile must stay >= the leftmost column still held in the
+     * ring buffer: bg_stream_left after a respawn, (bg_stream_right - 32)
+     * once streaming has wrapped.  The camera is bounded there, and the
+     * player must stay >= that column * 8 + CAM_DZ_LEFT so it cannot walk
+     * off the left edge of the view.  Columns are 8-bit, so the world X of
+     * bg_stream_left is found from its distance to the camera's column. */
+    if ((uint8_t)(bg_stream_right - bg_stream_left) > 32U) {
+        bg_stream_left = (uint8_t)(bg_stream_right - 32U);
+    }
+    held_cols = (uint8_t)(camera.col_left - bg_stream_left);
+    min_x     = (uint16_t)(((camera.x >> 3) - held_cols) << 3);
+    camera_set_min_x(min_x);
+    if (min_x > 0U) {
+        min_world_x = (uint16_t)(min_x + (uint16_t)CAM_DZ_LEFT);
     } else {
         min_world_x = 8U;  /* MIN_WORLD_X from sprite_player.c */
     }
 
-    /* --- Update player (handles movement, physics, animation, camera) --- */
-    events = player_update(joy, joy_press, &camera_x, min_world_x);
+    /* --- Update player (movement, physics, animation), camera follows --- */
+    PROF_BEGIN(PROF_PLAYER);
+    events = player_update(joy, input_buffered(), min_world_x);
+    if (events & PLAYER_EVENT_JUMPED) input_consume(J_A);
+    camera_update(player_get_world_x16(), player_get_sprite()->world_y);
+    frame_scx = (uint8_t)camera.x;   /* shown with this frame's sprites */
+    player_draw(camera.x);
+    PROF_END(PROF_PLAYER);
+
+    if (events & PLAYER_EVENT_LANDED) {
+        /* Dust at both feet */
+        particle_emit(&fx_dust, (uint16_t)(player_get_world_x16() + 2U),
+                      (uint8_t)(player_get_sprite()->world_y + 14U), 2U);
+        particle_emit(&fx_dust, (uint16_t)(player_get_world_x16() + 11U),
+                      (uint8_t)(player_get_sprite()->world_y + 14U), 2U);
+    }
 
     if (events & PLAYER_EVENT_JUMPED) {
+        sfx_play(SFX_JUMP, SFX_PRIO_DEFAULT);
+        PROF_BEGIN(PROF_HUD);
         score++;
         hud_update_score();
+        PROF_END(PROF_HUD);
     }
 
     /* --- Fell into a pit: lose a life and restart or game over --- */
     if (events & PLAYER_EVENT_FELL_GAP) {
+        sfx_play(SFX_FALL, SFX_PRIO_DEFAULT);
         if (lives > 0U) {
             lives--;
             hud_update_lives();
         }
         if (lives == 0U) {
+            palette_fade_out(PAL_FADE_BLACK, PAL_FADE_SPEED);
+            palette_fade_wait();
             switch_state(STATE_GAME_OVER);
         } else {
-            switch_state(STATE_GAMEPLAY);  /* restart from beginning */
+            gameplay_restart();  /* respawn at the last checkpoint */
         }
         return;
     }
@@ -318,51 +792,92 @@ static void gameplay_update(void)
     /* --- Death animation completed: check game over --- */
     if (events & PLAYER_EVENT_DIED) {
         if (lives == 0U) {
+            palette_fade_out(PAL_FADE_BLACK, PAL_FADE_SPEED);
+            palette_fade_wait();
             switch_state(STATE_GAME_OVER);
         } else {
-            switch_state(STATE_GAMEPLAY);  /* restart from beginning */
+            gameplay_restart();  /* respawn at the last checkpoint */
         }
         return;
     }
 
-    /* --- Update enemy (handles patrol, animation, hardware move) --- */
-    enemy_update(camera_x);
+    /* --- Endless runner: checkpoints, enemy leash, lap rebase --- */
+    if (endless) runner_update();
+
+    /* --- Update enemy (runs its behaviour script, animation, hardware move) --- */
+    PROF_BEGIN(PROF_ENEMY);
+    enemy_update(camera.x, player_get_world_x16());
+    PROF_END(PROF_ENEMY);
+
+    /* --- Projectiles (fire, move, tile and sprite hits) --- */
+    PROF_BEGIN(PROF_SHOTS);
+    update_projectiles(input_buffered());
+    PROF_END(PROF_SHOTS);
+
+    /* --- Particles (bounded: at most PART_OBJS, oldest dropped) --- */
+    PROF_BEGIN(PROF_FX);
+    particle_update(camera.x);
+    PROF_END(PROF_FX);
+
+    /* --- Checkpoints: passing one moves the respawn point there --- */
+    if (!endless && next_checkpoint < level.checkpoint_count &&
+        player_get_world_x16() >= level_checkpoint(next_checkpoint)) {
+        respawn_x16 = level_checkpoint(next_checkpoint);
+        next_checkpoint++;
+        /* Blink the HUD so the player sees the checkpoint was reached */
+        palette_flash(PAL_BKG(HUD_PAL), RGB8(255, 255, 0), 4U, 32U);
+        sfx_play(SFX_CHECKPOINT, SFX_PRIO_DEFAULT);
+    }
 
-    /* --- Win condition: player reaches end of level --- */
-    if (player_get_world_x16() >= (uint16_t)CHECKPOINT_X16) {
-        switch_state(STATE_WIN);
+    /* --- End of level: next level, or the win screen after the last --- */
+    if (!endless && player_get_world_x16() >= level.goal_x16) {
+        gameplay_next_level();
         return;
     }
 
     /* --- Sprite collision: player vs enemy --- */
+    PROF_BEGIN(PROF_COLLIDE);
     if (collision_cooldown > 0U) {
         collision_cooldown--;
     } else if (sprites_collide(player_get_sprite(), enemy_get_sprite()) && !player_is_dying()) {
-        if (lives > 0U) {
-            lives--;
-            hud_update_lives();
-        }
-        /* Start death animation instead of immediate game over */
-        player_die();
-        collision_cooldown = COLLISION_COOLDOWN;
+        player_hurt();
     }
-
-    prev_joy = joy;
+    PROF_END(PROF_COLLIDE);
 }
 
 static void gameplay_cleanup(void)
 {
+    /* Session over: finish the recording or end the replay */
+    replay_stop();
+
+    /* Keep new bests; only the changed fields are written to SRAM */
+    if (score > save_data.high_score) {
+        SAVE_SET(high_score, score);
+    }
+    if (next_checkpoint > save_data.best_checkpoint) {
+        SAVE_SET(best_checkpoint, next_checkpoint);
+    }
+    if (level_won && last_seconds > save_data.best_time) {
+        SAVE_SET(best_time, last_seconds);
+    }
+    save_commit();
+
     player_cleanup();
     enemy_cleanup();
-    /* don't hide the window here – leaving it visible avoids a one-frame
-       blink when the level is reset after falling.  gameover_init() and
-       state_win already hide the HUD when appropriate. */
-    SCX_REG = 0;
+    projectile_clear();
+    particle_clear();
+    tile_anim_stop();
+    frame_set_obj_limit(0U);
+    /* don't hide the window here – gameover_init() and state_win already
+       hide the HUD when appropriate. */
+    frame_scx = 0;
 }
 
 BANKREF(state_gameplay)
 const GameState state_gameplay = {
     gameplay_init,
     gameplay_update,
-    gameplay_cleanup
+    gameplay_cleanup,
+    NULL,   /* pause  */
+    NULL    /* resume: the START that closed the overlay is not a new press */
 };
@@ -4,6 +4,10 @@
 #include <gbdk/platform.h>
 #include "states.h"
 
+/* Replay seed bit that selects the endless runner (set by the title
+ * screen), so a replay plays the same mode */
+#define GAMEPLAY_SEED_ENDLESS  0x8000U
+
 BANKREF_EXTERN(state_gameplay)
 extern const GameState state_gameplay;
 
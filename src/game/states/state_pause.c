@@ -0,0 +1,105 @@
+#pragma bank 255
+
+#include <gbdk/platform.h>
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "states.h"
+#include "input.h"
+#include "state_pause.h"
+#include "vram.h"
+#include "font.h"
+
+/* Borrowed window row: row 0 of the gameplay HUD is blank padding */
+#define PAUSE_ROW        0U
+#define PAUSE_TEXT_X     7U
+#define PAUSE_PAL        3U   /* HUD palette slot (set up in main.c)     */
+#define PAUSE_BLINK     30U   /* vblanks per blink phase                 */
+#define WIN_COLS        20U
+
+static const char pause_text[] = "PAUSED";
+
+static uint8_t saved_tiles[WIN_COLS];
+static uint8_t saved_attrs[WIN_COLS];
+static uint8_t win_was_shown;
+static uint8_t font_first_tile;
+static uint8_t font_attr;
+static uint8_t blink_counter;
+static uint8_t show_text;
+
+static void pause_draw_text(uint8_t visible)
+{
+    uint8_t i;
+    VBK_REG = 0;
+    for (i = 0; pause_text[i]; i++) {
+        set_win_tile_xy((uint8_t)(PAUSE_TEXT_X + i), PAUSE_ROW,
+                        visible ? (uint8_t)(font_first_tile + pause_text[i] - 32U)
+                                : font_first_tile);
+    }
+}
+
+static void pause_init(void)
+{
+    uint8_t i;
+    uint8_t font;
+
+    blink_counter = 0;
+    show_text     = 1;
+
+    /* Shared with the state below; loaded only if it has no font */
+    font            = FONT_VRAM_LOAD();
+    font_first_tile = vram_tile(font);
+    font_attr       = vram_attr(font);
+
+    /* Save the window row we are about to draw over (tiles + attributes) */
+    VBK_REG = 0;
+    get_win_tiles(0U, PAUSE_ROW, WIN_COLS, 1U, saved_tiles);
+    VBK_REG = 1;
+    get_win_tiles(0U, PAUSE_ROW, WIN_COLS, 1U, saved_attrs);
+    for (i = 0; pause_text[i]; i++) {
+        set_win_tile_xy((uint8_t)(PAUSE_TEXT_X + i), PAUSE_ROW,
+                        PAUSE_PAL | font_attr);
+    }
+    pause_draw_text(1U);
+
+    win_was_shown = (LCDC_REG & LCDCF_WINON) ? 1U : 0U;
+    SHOW_WIN;
+}
+
+static void pause_update(void)
+{
+    blink_counter++;
+    if (blink_counter >= PAUSE_BLINK) {
+        blink_counter = 0;
+        show_text ^= 1U;
+        pause_draw_text(show_text);
+    }
+
+    /* The START that opened the overlay was last frame's press */
+    if (input_pressed() & J_START) {
+        pop_state();
+    }
+}
+
+static void pause_cleanup(void)
+{
+    /* Hand the borrowed window row back untouched */
+    VBK_REG = 1;
+    set_win_tiles(0U, PAUSE_ROW, WIN_COLS, 1U, saved_attrs);
+    VBK_REG = 0;
+    set_win_tiles(0U, PAUSE_ROW, WIN_COLS, 1U, saved_tiles);
+
+    if (!win_was_shown) {
+        HIDE_WIN;
+    }
+}
+
+BANKREF(state_pause)
+const GameState state_pause = {
+    pause_init,
+    pause_update,
+    pause_cleanup,
+    NULL,   /* pause  */
+    NULL    /* resume */
+};
@@ -0,0 +1,17 @@
+#ifndef STATE_PAUSE_H
+#define STATE_PAUSE_H
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+#include "states.h"
+
+/* Pause overlay – push_state(STATE_PAUSE) from a running state.
+ * It borrows one window row (saved and restored) and draws with the font
+ * tiles the underlying state already has in VRAM: FONT_VRAM_LOAD() finds
+ * them resident and only takes a reference, which the overlay's arena
+ * drops again when it is popped with START. */
+
+BANKREF_EXTERN(state_pause)
+extern const GameState state_pause;
+
+#endif
@@ -3,12 +3,22 @@
 #include <gbdk/platform.h>
 #include <gb/gb.h>
 #include <gb/cgb.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "states.h"
+#include "frame.h"
+#include "input.h"
+#include "palette.h"
+#include "replay.h"
+#include "save.h"
+#include "state_gameplay.h"
 #include "state_title.h"
 #include "utils.h"
+#include "vram.h"
+#include "vwf.h"
 #include "bg_title.h"
 #include "font.h"
+#include "font_vwf.h"
 
 /* Font palette slot 2 with night-sky background colour to match bg_title */
 static const palette_color_t title_font_palette[4] = {
@@ -18,68 +28,121 @@ static const palette_color_t title_font_palette[4] = {
     RGB8( 85,  85,  85),   /* 3 - unused                      */
 };
 
-/* Font starts immediately after bg_title tiles in VRAM */
-#define FONT_FIRST_TILE  BG_TITLE_TILE_COUNT
+/* VWF tile ring: enough for the subtitle */
+#define VWF_TILES        16U
+
+/* Subtitle typed out in proportional text, one character per TYPE_SPEED frames */
+#define TYPE_SPEED       3U
+static const char subtitle[] = "QuickStart Template";
 
 static uint8_t flash_counter;
 static uint8_t show_prompt;
+static uint8_t type_pos;
+static uint8_t type_timer;
+static uint8_t font;   /* VRAM handle of the font tiles */
+
+/* "HI-SCORE nnnn" from the save data */
+static void draw_high_score(void)
+{
+    char     line[14] = "HI-SCORE 0000";
+    uint16_t s = save_data.high_score;
+    uint8_t  i;
+
+    for (i = 12U; i >= 9U; i--) {
+        line[i] = (char)('0' + (uint8_t)(s % 10U));
+        s /= 10U;
+    }
+    draw_text(3, 13, line, font);
+}
 
 static void title_init(void)
 {
+    uint8_t bg, vwf;
+
     flash_counter = 0;
     show_prompt   = 1;
+    type_pos      = 0;
+    type_timer    = 0;
 
-    /* Load title-screen background tiles into VRAM slot 0 */
-    set_bkg_data(0, BG_TITLE_TILE_COUNT, bg_title_tiles);
-    /* Font tiles immediately after background tiles */
-    set_bkg_data(BG_TITLE_TILE_COUNT, FONT_TILE_COUNT, font_tiles);
+    /* Two CRC checks over a few bytes of SRAM: no visible delay */
+    save_load();
+
+    /* Background, font and VWF ring tiles wherever the allocator puts
+     * them; all are released with this state's arena */
+    bg   = BG_TITLE_VRAM_LOAD();
+    font = FONT_VRAM_LOAD();
+    vwf  = vram_alloc(VRAM_BG, VWF_TILES);
 
     /* Set title background palettes (slots 0-1) */
-    set_bkg_palette(0, BG_TITLE_PALETTE_COUNT, bg_title_palettes);
+    palette_set_bkg(0, BG_TITLE_PALETTE_COUNT, bg_title_palettes);
     /* Font palette with night-sky background (slot 2) */
-    set_bkg_palette(2, 1, title_font_palette);
+    palette_set_bkg(2, 1, title_font_palette);
 
     /* Load tilemap and palette attributes */
-    set_bkg_tiles(0, 0, BG_TITLE_MAP_WIDTH, BG_TITLE_MAP_HEIGHT, bg_title_map);
-    VBK_REG = 1;
-    set_bkg_tiles(0, 0, BG_TITLE_MAP_WIDTH, BG_TITLE_MAP_HEIGHT, bg_title_attr_map);
-    VBK_REG = 0;
+    vram_set_bkg_submap(bg, 0, 0, BG_TITLE_MAP_WIDTH, BG_TITLE_MAP_HEIGHT,
+                        bg_title_map, bg_title_attr_map, BG_TITLE_MAP_WIDTH);
 
-    SCX_REG = 0;
-    SCY_REG = 0;
+    frame_scx = 0;
+    frame_scy = 0;
 
     /* Draw title text */
-    draw_text(6, 3,  "GBDK-GBC", FONT_FIRST_TILE);
-    draw_text(1, 4,  "QuickStart Template", FONT_FIRST_TILE);
-    draw_text(4, 16, "PRESS START",  FONT_FIRST_TILE);
+    draw_text(6, 3,  "GBDK-GBC", font);
+    vwf_init(&font_vwf, BANK(font_vwf), vram_tile(vwf), VWF_TILES,
+             vram_bank(vwf));
+    vwf_move_to((uint8_t)((160U - vwf_text_width(subtitle)) / 16U), 4);
+    draw_text(4, 16, "PRESS START",  font);
+    draw_high_score();
+
+    palette_fade_in(PAL_FADE_SPEED);
 }
 
 static void title_update(void)
 {
+    uint16_t seed;
+
+    if (subtitle[type_pos] && ++type_timer >= TYPE_SPEED) {
+        type_timer = 0;
+        vwf_putc(subtitle[type_pos++]);
+    }
+
     flash_counter++;
     if (flash_counter >= 30U) {
         flash_counter = 0;
         show_prompt ^= 1U;
         if (show_prompt) {
-            draw_text(4, 16, "PRESS START", FONT_FIRST_TILE);
+            draw_text(4, 16, "PRESS START", font);
         } else {
-            draw_text(4, 16, "           ", FONT_FIRST_TILE);
+            draw_text(4, 16, "           ", font);
         }
     }
 
-    if (joypad() & J_START) {
+    if (input_pressed() & J_START) {
+        /* SELECT+START replays the last recorded run; a plain START starts
+         * a new game and records it over the previous one, B+START the
+         * same in the endless runner (the mode is part of the seed). */
+        if (!((input_held() & J_SELECT) && replay_play_start())) {
+            seed = (uint16_t)(sys_time ^ ((uint16_t)DIV_REG << 8));
+            if (input_held() & J_B) seed |= GAMEPLAY_SEED_ENDLESS;
+            else                    seed &= (uint16_t)~GAMEPLAY_SEED_ENDLESS;
+            replay_record_start(seed);
+        }
+        palette_fade_out(PAL_FADE_BLACK, PAL_FADE_SPEED);
+        palette_fade_wait();
         switch_state(STATE_GAMEPLAY);
     }
 }
 
 static void title_cleanup(void)
 {
-    /* Nothing to clean up */
+    /* Drop queued subtitle tiles: the next state reuses that VRAM */
+    vwf_clear();
 }
 
 BANKREF(state_title)
 const GameState state_title = {
     title_init,
     title_update,
-    title_cleanup
+    title_cleanup,
+    NULL,   /* pause  */
+    NULL    /* resume */
 };
@@ -3,10 +3,15 @@
 #include <gbdk/platform.h>
 #include <gb/gb.h>
 #include <gb/cgb.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "states.h"
+#include "frame.h"
+#include "input.h"
+#include "palette.h"
 #include "state_win.h"
 #include "utils.h"
+#include "vram.h"
 #include "bg_win.h"
 #include "font.h"
 
@@ -18,50 +23,42 @@ static const palette_color_t win_font_palette[4] = {
     RGB8( 85,  85,  85),   /* 3 - unused                      */
 };
 
-/* Font starts immediately after bg_win tiles in VRAM */
-#define FONT_FIRST_TILE  BG_WIN_TILE_COUNT
-
-static uint8_t prev_joy;
-
 static void win_init(void)
 {
-    prev_joy = 0;
-
-    /* Load win background tiles into VRAM slot 0 */
-    set_bkg_data(0, BG_WIN_TILE_COUNT, bg_win_tiles);
-    /* Font tiles immediately after background tiles */
-    set_bkg_data(BG_WIN_TILE_COUNT, FONT_TILE_COUNT, font_tiles);
+    /* Background and font tiles wherever the allocator puts them; both
+     * are released with this state's arena */
+    uint8_t bg   = BG_WIN_VRAM_LOAD();
+    uint8_t font = FONT_VRAM_LOAD();
 
     /* Set win background palettes (slots 0-1) */
-    set_bkg_palette(0, BG_WIN_PALETTE_COUNT, bg_win_palettes);
+    palette_set_bkg(0, BG_WIN_PALETTE_COUNT, bg_win_palettes);
     /* Font palette with golden-sky background (slot 2) */
-    set_bkg_palette(2, 1, win_font_palette);
+    palette_set_bkg(2, 1, win_font_palette);
 
     /* Load tilemap and palette attributes; reset scroll */
-    set_bkg_tiles(0, 0, BG_WIN_MAP_WIDTH, BG_WIN_MAP_HEIGHT, bg_win_map);
-    VBK_REG = 1;
-    set_bkg_tiles(0, 0, BG_WIN_MAP_WIDTH, BG_WIN_MAP_HEIGHT, bg_win_attr_map);
-    VBK_REG = 0;
+    vram_set_bkg_submap(bg, 0, 0, BG_WIN_MAP_WIDTH, BG_WIN_MAP_HEIGHT,
+                        bg_win_map, bg_win_attr_map, BG_WIN_MAP_WIDTH);
 
-    SCX_REG = 0;
-    SCY_REG = 0;
+    frame_scx = 0;
+    frame_scy = 0;
 
     HIDE_WIN;  /* hide the HUD window shown during gameplay */
 
-    draw_text(4,  5, "YOU WIN!",         FONT_FIRST_TILE);
-    draw_text(1,  7, "CONGRATULATIONS!", FONT_FIRST_TILE);
-    draw_text(2,  9, "PRESS START",      FONT_FIRST_TILE);
+    draw_text(4,  5, "YOU WIN!",         font);
+    draw_text(1,  7, "CONGRATULATIONS!", font);
+    draw_text(2,  9, "PRESS START",      font);
+
+    /* Gameplay faded out to white; fade back in from there */
+    palette_fade_in(PAL_FADE_SPEED);
 }
 
 static void win_update(void)
 {
-    uint8_t joy       = joypad();
-    uint8_t joy_press = (uint8_t)(joy & ~prev_joy);
-
-    if (joy_press & J_START) {
+    if (input_pressed() & J_START) {
+        palette_fade_out(PAL_FADE_BLACK, PAL_FADE_SPEED);
+        palette_fade_wait();
         switch_state(STATE_TITLE_SCREEN);
     }
-    prev_joy = joy;
 }
 
 static void win_cleanup(void)
@@ -73,5 +70,7 @@ BANKREF(state_win)
 const GameState state_win = {
     win_init,
     win_update,
-    win_cleanup
+    win_cleanup,
+    NULL,   /* pause  */
+    NULL    /* resume */
 };
@@ -0,0 +1,99 @@
+#ifndef BEHAVIOUR_H
+#define BEHAVIOUR_H
+
+#include <stdint.h>
+#include "sprite.h"
+
+/* -----------------------------------------------------------------------
+ * Behaviour scripts – a small bytecode interpreter for enemies.
+ *
+ * An enemy type is a script, not code: const bytes generated by
+ * tools/gen_behaviour.py from the assembly in res/behaviours/<name>/
+ * definition.py into res/<name>.c / .h (an autobanked table of scripts
+ * and a BHV_<NAME> id per script).  New types therefore cost ROM bytes in
+ * any bank, and every type runs through the same bank-0 interpreter.
+ *
+ * Each Behaviour runs at most BHV_BUDGET instructions per
+ * behaviour_update(); WALK and WAIT end the frame.  A script that loops
+ * without waiting just carries on next frame, so the cost per enemy per
+ * frame is bounded whatever the script does.
+ *
+ * Movement uses the level accessors (level.h): WALK stops at walls and,
+ * on the ground, at edges; after JUMP the enemy falls at up to
+ * BHV_FALL_MAX px/frame and lands on any ground tile.  Game-specific
+ * actions are reported as events (FIRE sets BHV_EV_FIRE) for the caller
+ * to act on after the update.
+ *
+ * Instructions (operands are bytes; labels are offsets in the script)
+ * ------------------------------------------------------------------
+ *   END                        stop here (the enemy stays put)
+ *   WALK   frames              walk 1 px/frame; ends early when blocked
+ *   WAIT   frames              stand still
+ *   TURN                       reverse
+ *   TURN_AT_EDGE               reverse if a wall or edge is one step ahead
+ *   FACE                       face the player
+ *   JUMP   speed               leave the ground at speed px/frame
+ *   FIRE                       raise BHV_EV_FIRE
+ *   NEAR   dist, label         branch if the player is within dist px
+ *   FAR    dist, label         branch if the player is dist px or more away
+ *   ANIM   start, frames, speed   play an animation (see anim_*)
+ *   GOTO   label
+ * ----------------------------------------------------------------------- */
+
+#define BHV_BUDGET     8U    /* instructions per enemy per frame          */
+#define BHV_FALL_MAX   4     /* px/frame                                  */
+#define BHV_MAX_LEN  255U    /* script bytes (labels are 8-bit)           */
+
+/* Opcodes */
+#define BHV_OP_END           0x00U
+#define BHV_OP_WALK          0x01U
+#define BHV_OP_WAIT          0x02U
+#define BHV_OP_TURN          0x03U
+#define BHV_OP_TURN_AT_EDGE  0x04U
+#define BHV_OP_FACE          0x05U
+#define BHV_OP_JUMP          0x06U
+#define BHV_OP_FIRE          0x07U
+#define BHV_OP_NEAR          0x08U
+#define BHV_OP_FAR           0x09U
+#define BHV_OP_ANIM          0x0AU
+#define BHV_OP_GOTO          0x0BU
+
+/* Events raised by the last behaviour_update() */
+#define BHV_EV_FIRE   0x01U
+#define BHV_EV_FELL   0x02U   /* fell out of the level; the script stops */
+
+typedef struct {
+    const uint8_t *script;     /* in rom_bank                          */
+    uint8_t        rom_bank;
+    uint8_t        pc;         /* offset of the next instruction       */
+    uint8_t        wait;       /* frames left of the current WALK/WAIT */
+    uint8_t        walking;
+    uint8_t        airborne;
+    int8_t         dx;         /* facing: +1 / -1                      */
+    int8_t         vy;         /* px/frame while airborne              */
+    uint8_t        events;     /* BHV_EV_*                             */
+    uint8_t        anim_start; /* current animation (ANIM operands)    */
+    uint8_t        anim_frames;
+    uint16_t       x16;        /* world X                              */
+    Sprite        *sprite;     /* world_y and box; world_x is not used */
+} Behaviour;
+
+/* -----------------------------------------------------------------------
+ * behaviour_start
+ * Run script id of a generated table (e.g. BANK(behaviours), behaviours)
+ * for the enemy whose box is sprite, standing at world X x16 and facing
+ * right.  Resets the sprite's animation.
+ * ----------------------------------------------------------------------- */
+void behaviour_start(Behaviour *b, uint8_t rom_bank,
+                     const uint8_t * const *table, uint8_t id,
+                     Sprite *sprite, uint16_t x16);
+
+/* -----------------------------------------------------------------------
+ * behaviour_update
+ * One frame: fall if airborne, then run the script until it waits or the
+ * budget runs out.  player_x16 is the player's world X.  Reads the
+ * script from its bank and restores the caller's bank.
+ * ----------------------------------------------------------------------- */
+void behaviour_update(Behaviour *b, uint16_t player_x16);
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Scrolling camera
+ *
+ * Owns the 16-bit world position of the top-left corner of the view and
+ * moves it after a focus point (usually the player) once per frame:
+ *
+ *   Dead-zone  : a box in screen pixels; the camera only moves when the
+ *                focus leaves it.
+ *   Look-ahead : a horizontal offset that grows towards the direction the
+ *                focus is moving (velocity = focus movement per frame) by
+ *                one pixel per frame, and is kept while the focus stands.
+ *   Smoothing  : the camera closes 1/2^shift of the remaining distance per
+ *                frame (at least one pixel), never more than max_step.
+ *   Bounds     : derived from the map size by camera_init(); the lower X
+ *                bound can be raised while the level streams (ring buffer
+ *                columns already overwritten).  A map of width 0 has no
+ *                right bound; its world X is kept small by moving the
+ *                whole world back with camera_shift_x().
+ *
+ * After each update the tile edges of the view are published in camera
+ * (col_left..col_right, row_top..row_bottom, inclusive, 8-bit so they
+ * wrap every 2048 px) for the map streamer.  As long as max_step <= 8 the view gains at most one new
+ * column or row per frame, so streaming col_right + 1 once per frame keeps
+ * it ahead of the view.
+ *
+ * Frame protocol
+ * --------------
+ *   camera_update() : after the focus has moved (game logic).
+ *   SCX_REG / SCY_REG = camera.x / camera.y during the next VBlank; the
+ *   8-bit registers wrap with the 32x32 hardware map.
+ * ----------------------------------------------------------------------- */
+
+#define CAMERA_VIEW_W      160U
+#define CAMERA_VIEW_H      144U
+#define CAMERA_MAX_X     0x7000U   /* right bound of a width-0 map      */
+
+/* camera_update() result flags */
+#define CAMERA_COL_CHANGED  0x01U   /* col_left / col_right changed */
+#define CAMERA_ROW_CHANGED  0x02U   /* row_top / row_bottom changed */
+
+typedef struct {
+    uint16_t x;            /* view left edge, world pixels  */
+    uint16_t y;            /* view top edge, world pixels   */
+    uint16_t min_x;        /* bounds for x / y              */
+    uint16_t max_x;
+    uint16_t max_y;
+    uint8_t  col_left;     /* tile columns / rows in view   */
+    uint8_t  col_right;
+    uint8_t  row_top;
+    uint8_t  row_bottom;
+} Camera;
+
+extern Camera camera;
+
+/* -----------------------------------------------------------------------
+ * camera_init
+ * Set the bounds for a map_w x map_h tile map (map_w 0: endless), reset
+ * the position to the top-left corner and restore the defaults: no look-ahead, no smoothing,
+ * max_step 8 and a dead-zone of the whole view.
+ * ----------------------------------------------------------------------- */
+void camera_init(uint8_t map_w, uint8_t map_h);
+
+/* Dead-zone box in screen pixels (focus may move freely inside it) */
+void camera_set_deadzone(uint8_t left, uint8_t right,
+                         uint8_t top, uint8_t bottom);
+
+/* Look-ahead target = focus velocity * scale, clamped to +/- max_px.
+ * max_px = 0 disables look-ahead. */
+void camera_set_lookahead(uint8_t scale, uint8_t max_px);
+
+/* Close 1/2^shift of the distance per frame, at most max_step pixels */
+void camera_set_smoothing(uint8_t shift, uint8_t max_step);
+
+/* Raise (or reset to 0) the lowest allowed camera.x */
+void camera_set_min_x(uint16_t min_x);
+
+/* Move the view, its bounds and the focus history dx pixels left, for a
+ * world that is moved back as a whole (endless levels) */
+void camera_shift_x(uint16_t dx);
+
+/* Jump straight to the view that has the focus at the left / top edge of
+ * the dead-zone (clamped to the bounds), with no look-ahead. */
+void camera_snap(uint16_t focus_x, uint16_t focus_y);
+
+/* Follow the focus for one frame.  Returns CAMERA_*_CHANGED flags. */
+uint8_t camera_update(uint16_t focus_x, uint16_t focus_y);
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Frame pacing: fixed-timestep logic with VBlank-committed registers
+ *
+ * Game logic runs in ticks of one frame each, bracketed by frame_begin()
+ * and frame_end().  While a tick runs, OAM DMA is off and the scroll
+ * registers are only written to frame_scx / frame_scy, so a VBlank that
+ * arrives mid-tick (an overrun) shows the last finished frame unchanged
+ * instead of half-moved sprites over a new scroll position.  frame_end()
+ * publishes the shadows and re-enables DMA; the VBL handler writes them
+ * to SCX/SCY on the next VBlank, together with the OAM DMA.
+ *
+ * Lag and catch-up
+ * ----------------
+ *   Every VBlank that passes while a tick runs is a dropped frame and is
+ *   counted by frame_lag_count().  frame_begin() returns the number of
+ *   logic ticks to run before the next frame_end(): 1, plus up to
+ *   FRAME_CATCHUP_MAX extra ticks to make up for frames dropped by the
+ *   last tick, so game time keeps pace with real time under short
+ *   overloads.  With the default of 0 a dropped frame is simply a dropped
+ *   logic tick.  A tick that waits on purpose (a blocking fade, a level
+ *   reload, a state change) calls frame_resync() afterwards, so the
+ *   VBlanks it spent are neither lag nor caught up; stalls longer than
+ *   FRAME_STALL_VBLS VBlanks are ignored the same way as a fallback.
+ *
+ * OBJ limit line
+ * --------------
+ *   Sprites are drawn over the window, so a HUD window at the bottom of
+ *   the screen would show any OBJ that reaches it.  frame_set_obj_limit()
+ *   turns OBJ display (LCDC bit 1) off from a screen line down: an LYC
+ *   interrupt on the line before waits for its HBlank and clears the
+ *   bit, and the VBL handler sets it again for the next frame.  A sprite
+ *   across the line is cut there, and entities need no HUD clipping.
+ *
+ * Frame protocol
+ * --------------
+ *   frame_init()  : once at boot (installs the VBL and LCD handlers).
+ *   frame_begin() : waits for VBlank; the VBlank window follows.
+ *   frame_resync(): after a deliberate wait inside a tick.
+ *   frame_end()   : once all ticks of the frame have run.
+ * ----------------------------------------------------------------------- */
+
+#ifndef FRAME_CATCHUP_MAX
+#define FRAME_CATCHUP_MAX   0U   /* extra ticks per frame (make CATCHUP=n) */
+#endif
+#define FRAME_STALL_VBLS    4U
+
+/* Scroll shadows; logic writes these instead of SCX_REG / SCY_REG */
+extern uint8_t frame_scx;
+extern uint8_t frame_scy;
+
+void frame_init(void);
+
+/* VBL handler: commit the last published scroll and show OBJ again if
+ * the limit line hid them (installed by frame_init) */
+void frame_vbl(void);
+
+/* LCD (LYC) handler: hide OBJ from the limit line (installed by frame_init) */
+void frame_lcd(void);
+
+/* Hide OBJ from screen line line (1-143) down every frame; 0 turns the
+ * limit off */
+void frame_set_obj_limit(uint8_t line);
+
+/* Wait for the next VBlank and open a tick.  Returns the logic ticks to
+ * run this frame (1 .. FRAME_CATCHUP_MAX + 1). */
+uint8_t frame_begin(void);
+
+/* Restart the running tick's VBlank count after a deliberate wait */
+void frame_resync(void);
+
+/* Publish this frame's scroll and sprites */
+void frame_end(void);
+
+/* Frames dropped since frame_init() */
+uint16_t frame_lag_count(void);
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Joypad input, sampled in the VBlank interrupt
+ *
+ * input_vbl() is installed as a VBL handler and reads the pad once per
+ * VBlank.  Every button seen held at any VBlank since the last
+ * input_update() is latched, so a tap is not lost when game logic runs
+ * late and skips a frame.  input_update() turns the latched sample into
+ * the per-frame masks below; states read those instead of calling
+ * joypad() and keeping their own prev_joy.
+ *
+ *   held     : buttons down this frame
+ *   pressed  : down this frame, up the frame before
+ *   released : up this frame, down the frame before
+ *   repeat   : pressed, then again every INPUT_REPEAT_RATE frames once a
+ *              button has been held for INPUT_REPEAT_DELAY (menus)
+ *   buffered : pressed within the last INPUT_BUFFER_FRAMES frames and
+ *              not consumed yet, so e.g. a jump pressed just before
+ *              landing still happens
+ *
+ * Replay
+ * ------
+ *   input_update() passes the sample through replay_input(), so recording
+ *   and playback see exactly the held mask the game logic sees, and all
+ *   derived masks are rebuilt identically on playback.
+ *
+ * Frame protocol
+ * --------------
+ *   input_init()   : once at boot (installs the VBL handler).
+ *   input_update() : once per logic tick, before the current state runs
+ *                    (a second tick in the same frame sees the same
+ *                    buttons held and nothing newly pressed).
+ * ----------------------------------------------------------------------- */
+
+#define INPUT_REPEAT_DELAY   20U   /* frames before auto-repeat starts */
+#define INPUT_REPEAT_RATE     6U   /* frames between repeats           */
+#define INPUT_BUFFER_FRAMES   6U   /* lifetime of a buffered press     */
+
+void input_init(void);
+
+/* VBL handler: sample the pad (installed by input_init()) */
+void input_vbl(void);
+
+/* Build this frame's masks from the buttons latched since the last call */
+void input_update(void);
+
+uint8_t input_held(void);
+uint8_t input_pressed(void);
+uint8_t input_released(void);
+uint8_t input_repeat(void);
+uint8_t input_buffered(void);
+
+/* Drop buffered presses of the given buttons (the action has happened) */
+void input_consume(uint8_t mask);
+
+/* Forget buffered presses and restart auto-repeat, e.g. on a respawn */
+void input_flush(void);
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <gb/cgb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "pb16.h"
+#include "sprite.h"
+#include "tile_anim.h"
+
+/* -----------------------------------------------------------------------
+ * Level descriptors and bank-safe level data access
+ *
+ * A level's tiles, maps, collision lists and checkpoints are generated
+ * into one autobanked ROM bank together with a Level descriptor
+ * (<name>_level, see tools/gen_background.py).  The game lists its levels
+ * as LevelRef entries ({bank, descriptor}) and selects one with
+ * level_select(), which copies the descriptor, the collision sets and the
+ * checkpoints into WRAM.
+ *
+ * Map data stays in its bank.  Banked game code must not read it through
+ * level.map directly: the accessors below live in bank 0, switch to the
+ * level's bank once per batch (a column range, a box, a span of cells)
+ * and restore the caller's bank before returning.  The ROM can therefore
+ * hold any number of levels in any banks.
+ *
+ * Tile classes
+ * ------------
+ *   solid  : blocks sprites from every side (COLLISION_TILE_IDS)
+ *   ground : can be landed on from above  (COLLISION_TILE_DOWN_IDS)
+ *   Both are kept as 256-bit sets in WRAM, so classifying a tile costs
+ *   the same for any list length and needs no bank switch.
+ *
+ * Generated levels
+ * ----------------
+ *   A level with a LevelGen (Level.gen) has no ROM map and no end: its
+ *   width is 0 and its columns are made from chunk patterns of
+ *   LEVEL_CHUNK_W columns, one picked per chunk by a PRNG seeded with
+ *   level_set_seed().  The pick for chunk k depends only on the seed and
+ *   k, so any column can be made again at any time, e.g. when respawning
+ *   behind the streamed area.
+ *
+ *   Column arguments stay 8-bit and wrap from 255 to 0 with the world X
+ *   (world X >> 3, truncated).  Each one stands for the generated column
+ *   nearest the last one streamed, within -128..+127, so streaming and
+ *   the accessors carry on past column 255 with new chunks (the chunk
+ *   sequence repeats after 32768 columns).  A caller may therefore move
+ *   its world X back by any multiple of 2048 px without changing what the
+ *   level looks like there.
+ *
+ *   Streamed columns are kept in a WRAM cache laid out like the BG ring:
+ *   column c in cache column c % LEVEL_GEN_COLS (level_gen_map).  Only
+ *   level_set_columns() writes it, one column per frame at top scroll
+ *   speed.  The collision accessors read the cache when it holds the
+ *   column and otherwise make the column into a small scratch buffer, so
+ *   a probe outside the view (an off-screen enemy) never replaces a
+ *   column on screen.  Pattern table and seed are in WRAM, so none of
+ *   this switches banks, and a level costs no ROM beyond its patterns.
+ *
+ *   Column codes (one byte per pattern column): LEVEL_GEN_GROUND fills
+ *   the grass row and everything below it, LEVEL_GEN_BLOCK adds a block
+ *   on the grass and LEVEL_GEN_LEDGE a one-way ledge on ledge_row.
+ *   Pattern 0 must be flat ground: it is used for the first flat_chunks
+ *   chunks.
+ * ----------------------------------------------------------------------- */
+
+#define LEVEL_MAX_CHECKPOINTS  8U
+
+#define LEVEL_GEN_COLS        32U   /* column cache = BG map width      */
+#define LEVEL_GEN_ROWS        18U   /* tallest generated level          */
+#define LEVEL_GEN_MAX_CHUNKS  16U   /* patterns per LevelGen            */
+#define LEVEL_CHUNK_W          8U   /* columns per pattern              */
+
+/* Column codes */
+#define LEVEL_GEN_GROUND      0x01U
+#define LEVEL_GEN_BLOCK       0x02U
+#define LEVEL_GEN_LEDGE       0x04U
+
+/* Tile kinds, indices into LevelGen.tiles / .attrs */
+#define LEVEL_KIND_SKY         0U
+#define LEVEL_KIND_GRASS       1U
+#define LEVEL_KIND_SOIL        2U   /* the 3 rows under the grass       */
+#define LEVEL_KIND_DEEP        3U
+#define LEVEL_KIND_BLOCK       4U
+#define LEVEL_KIND_LEDGE       5U
+#define LEVEL_KINDS            6U
+
+typedef struct {
+    const uint8_t *chunks;             /* chunk_count x LEVEL_CHUNK_W codes */
+    uint8_t        chunk_count;
+    uint8_t        flat_chunks;        /* leading chunks that are pattern 0 */
+    uint8_t        ground_row;         /* grass row                         */
+    uint8_t        ledge_row;
+    uint8_t        tiles[LEVEL_KINDS];   /* tile ID per kind              */
+    uint8_t        attrs[LEVEL_KINDS];   /* CGB attributes per kind       */
+} LevelGen;
+
+typedef struct {
+    const uint8_t         *tiles;          /* raw or pb16, see tile_codec */
+    const palette_color_t *palettes;
+    const uint8_t         *map;            /* width x height, row-major   */
+    const uint8_t         *attr_map;       /* CGB attributes, same layout */
+    const uint8_t         *solid;          /* tile ID lists               */
+    const uint8_t         *ground;
+    const uint16_t        *checkpoints;    /* world X, ascending          */
+    const TileAnimSet     *tile_anims;     /* animated tiles, or NULL     */
+    const LevelGen        *gen;            /* generated level, or NULL    */
+    uint16_t               goal_x16;       /* world X of the end (0: gen) */
+    uint8_t                width;          /* map size in tiles (0: gen)  */
+    uint8_t                height;
+    uint8_t                tile_count;
+    uint8_t                tile_codec;     /* TILE_CODEC_*                */
+    uint8_t                palette_count;
+    uint8_t                solid_count;
+    uint8_t                ground_count;
+    uint8_t                checkpoint_count;
+    uint8_t                player_x;       /* spawn points (world pixels) */
+    uint8_t                player_y;
+    uint8_t                enemy_x;
+    uint8_t                enemy_y;
+    uint8_t                enemy_behaviour;  /* BHV_* script id       */
+} Level;
+
+/* Where a descriptor lives; build tables with LEVEL_REF(<name>_level) */
+typedef struct {
+    uint8_t      bank;
+    const Level *level;
+} LevelRef;
+
+#define LEVEL_REF(desc)  { BANK(desc), &(desc) }
+
+/* WRAM copy of the selected descriptor (pointers refer to level_bank) */
+extern Level   level;
+extern uint8_t level_bank;
+
+/* Column cache of a generated level (see above) */
+extern uint8_t level_gen_map[LEVEL_GEN_ROWS * LEVEL_GEN_COLS];
+
+/* Select a level: copy its descriptor, collision sets and checkpoints.
+ * The LevelRef itself may live in any bank (e.g. a banked state's table). */
+void level_select(const LevelRef *ref);
+
+/* Seed a generated level's PRNG (empties the column cache); the same
+ * seed gives the same level.  Call after level_select(). */
+void level_set_seed(uint16_t seed);
+
+/* Checkpoint i (i < level.checkpoint_count), from the WRAM copy */
+uint16_t level_checkpoint(uint8_t i);
+
+/* Load the level's BG tiles through vram_load() (shared with a level
+ * using the same tile set) and return the handle, VRAM_NONE when out of
+ * tiles; vram_release() it when leaving the level */
+uint8_t level_load_tiles(void);
+
+/* Load the level's palettes at BG slot first */
+void level_set_palettes(uint8_t first);
+
+/* -----------------------------------------------------------------------
+ * level_set_columns
+ * Copy map columns first_col .. first_col+count-1 (tiles and attributes)
+ * into the 32x32 hardware BG map; column N lands in ring column N % 32.
+ * Map entries are offset to the tiles of level_load_tiles().  Columns of
+ * a generated level are made into the cache first, and the range may
+ * wrap past column 255.
+ * ----------------------------------------------------------------------- */
+void level_set_columns(uint8_t first_col, uint8_t count);
+
+/* Tile ID at map cell (col, row); 0 outside the map (a generated level
+ * has no right edge) */
+uint8_t level_tile(uint8_t col, uint8_t row);
+
+uint8_t level_is_solid(uint8_t tile);
+uint8_t level_is_ground(uint8_t tile);
+
+/* 1 if the sprite's hit box at world_x16 overlaps a solid tile */
+uint8_t level_box_solid(const Sprite *s, uint16_t world_x16);
+
+/* 1 if any cell of row under world X x0 .. x1 (inclusive) is ground;
+ * cells right of the map are ignored */
+uint8_t level_ground_span(uint16_t x0, uint16_t x1, uint8_t row);
+
+#endif
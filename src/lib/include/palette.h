@@ -0,0 +1,120 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <gb/cgb.h>
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Palette engine – shadow copy of all 8 BG and 8 OBJ CGB palettes.
+ *
+ * Game code loads palettes with palette_set_bkg() / palette_set_sprite()
+ * instead of set_bkg_palette() / set_sprite_palette().  The engine keeps
+ * the source colours split into 5-bit R/G/B channels and derives the
+ * visible colours from per-channel lookup tables, so fades and cycles
+ * never do RGB555 arithmetic at runtime.
+ *
+ * Palette slots
+ * -------------
+ *   Effects address palettes by slot: 0..7 = BG palettes, 8..15 = OBJ
+ *   palettes.  Use PAL_BKG(n) / PAL_OBJ(n) to build a slot number.
+ *
+ * Frame protocol
+ * --------------
+ *   palette_commit() : call once per frame during VBlank; uploads only
+ *                      the palettes whose colours changed.
+ *   palette_update() : call once per frame after game logic; advances
+ *                      fades, cycles and flashes.
+ * ----------------------------------------------------------------------- */
+
+#define PAL_BKG(n)        ((uint8_t)(n))
+#define PAL_OBJ(n)        ((uint8_t)(8U + (n)))
+
+/* Fade levels: 0 = source colours, PAL_FADE_STEPS = solid black/white */
+#define PAL_FADE_STEPS    8U
+
+/* Fade target colours */
+#define PAL_FADE_BLACK    0U
+#define PAL_FADE_WHITE    1U
+
+/* Default vblanks per fade step used for state transitions */
+#define PAL_FADE_SPEED    2U
+
+/* Concurrent effect limits */
+#define PAL_CYCLE_MAX     4U
+#define PAL_FLASH_MAX     2U
+
+/* -----------------------------------------------------------------------
+ * palette_init
+ * Clear the shadow palettes, cancel all effects and reset the fade level
+ * to 0.  Call once at startup before loading any palettes.
+ * ----------------------------------------------------------------------- */
+void palette_init(void);
+
+/* -----------------------------------------------------------------------
+ * palette_set_bkg / palette_set_sprite
+ * Load nb palettes (4 colours each) starting at palette first.  Drop-in
+ * replacements for set_bkg_palette() / set_sprite_palette(): the current
+ * fade level is applied and the hardware is updated at the next commit.
+ * ----------------------------------------------------------------------- */
+void palette_set_bkg(uint8_t first, uint8_t nb, const palette_color_t *data);
+void palette_set_sprite(uint8_t first, uint8_t nb, const palette_color_t *data);
+
+/* -----------------------------------------------------------------------
+ * Fading
+ *
+ * palette_fade_out  : fade towards solid black or white (PAL_FADE_BLACK /
+ *                     PAL_FADE_WHITE), speed = vblanks per step.
+ * palette_fade_in   : fade back to the source colours from the current
+ *                     fade colour.
+ * palette_fade_set  : jump straight to a fade colour and level (e.g. start
+ *                     a state fully black before fading in).
+ * palette_fade_busy : 1 while a fade is in progress.
+ * palette_fade_wait : block until the running fade has finished, running
+ *                     vsync() / palette_commit() / palette_update() itself.
+ *                     Use before switch_state() to finish a fade-out.
+ * ----------------------------------------------------------------------- */
+void    palette_fade_out(uint8_t colour, uint8_t speed);
+void    palette_fade_in(uint8_t speed);
+void    palette_fade_set(uint8_t colour, uint8_t level);
+uint8_t palette_fade_busy(void);
+void    palette_fade_wait(void);
+
+/* -----------------------------------------------------------------------
+ * palette_cycle_start
+ * Rotate count colours of a palette slot, starting at colour first, by
+ * one position every period vblanks (water shimmer, glowing lava, ...).
+ * Returns the cycle handle (0..PAL_CYCLE_MAX-1), or 0xFF if all cycle
+ * slots are busy.
+ *
+ * palette_cycle_stop
+ * Stop a cycle.  Colours are left at their current rotation.
+ * ----------------------------------------------------------------------- */
+uint8_t palette_cycle_start(uint8_t slot, uint8_t first, uint8_t count,
+                            uint8_t period);
+void    palette_cycle_stop(uint8_t handle);
+
+/* -----------------------------------------------------------------------
+ * palette_flash
+ * Blink a palette slot between its own colours and a solid colour,
+ * toggling every period vblanks for duration vblanks.  Starting a flash
+ * on a slot that is already flashing restarts it.  Silently ignored when
+ * all PAL_FLASH_MAX flash slots are busy.
+ * ----------------------------------------------------------------------- */
+void palette_flash(uint8_t slot, palette_color_t colour,
+                   uint8_t period, uint8_t duration);
+
+/* -----------------------------------------------------------------------
+ * palette_update
+ * Advance fades, cycles and flashes by one frame and rebuild any palette
+ * whose visible colours changed.
+ * ----------------------------------------------------------------------- */
+void palette_update(void);
+
+/* -----------------------------------------------------------------------
+ * palette_commit
+ * Upload changed palettes to CGB palette RAM.  Must be called during
+ * VBlank; does nothing when no colour changed since the last commit.
+ * ----------------------------------------------------------------------- */
+void palette_commit(void);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef PARTICLE_H
+#define PARTICLE_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Particle emitter – dust, sparks and bursts drawn with OBJ slots.
+ *
+ * Particles live in a fixed ring (oldest first) whose capacity is the
+ * number of OBJ slots handed to particle_init(); ring slot i always uses
+ * OBJ first_obj + i.  Emitting into a full ring overwrites the oldest
+ * particles, so the OBJ count and the per-frame work (one pass over at
+ * most PART_MAX entries) have a hard upper bound and effects can never
+ * cause lag frames – they get shorter instead.
+ *
+ * Motion is 12.4 fixed point (1/16 pixel): positions are 16-bit, so
+ * particles must stay within the first 4096 world pixels.
+ *
+ * Scanline budget
+ * ---------------
+ *   The hardware shows at most 10 OBJs per scanline.  Particles are drawn
+ *   newest first and a particle is hidden for the frame when any 8-line
+ *   band it covers already holds PART_LINE_MAX particles, leaving the
+ *   rest of each line for the player, enemies and projectiles.
+ *
+ * Frame protocol
+ * --------------
+ *   particle_emit()   : any time during game logic.
+ *   particle_update() : once per frame; moves, expires and draws (writes
+ *                       the shadow OAM through move_sprite(), like the
+ *                       sprite modules).
+ * ----------------------------------------------------------------------- */
+
+#define PART_MAX       16U   /* ring capacity (upper bound of OBJ slots) */
+#define PART_LINE_MAX   4U   /* particles per 8-line band                */
+
+/* One kind of particle; velocities are picked at random per particle */
+typedef struct {
+    uint8_t tile;        /* OBJ tile, from particle_init()'s tile_base */
+    uint8_t life;        /* frames                                    */
+    uint8_t spread_x;    /* |vx| <= spread_x, 1/16 px per frame       */
+    uint8_t spread_y;    /* |vy - vy_bias| <= spread_y                */
+    int8_t  vy_bias;     /* e.g. negative to throw particles upwards  */
+    int8_t  gravity;     /* added to vy every frame, 1/16 px          */
+} ParticleKind;
+
+/* -----------------------------------------------------------------------
+ * particle_init
+ * Use OBJ slots first_obj .. first_obj+obj_count-1 (obj_count is clamped
+ * to PART_MAX) with OBJ attributes prop (CGB palette, plus VRAM_ATTR_BANK1
+ * for bank-1 tiles), and hide them.  Kind tiles are relative to tile_base
+ * (e.g. vram_tile() of the particle tiles).
+ * ----------------------------------------------------------------------- */
+void particle_init(uint8_t first_obj, uint8_t obj_count, uint8_t prop,
+                   uint8_t tile_base);
+
+/* Restart the spread generator from seed (e.g. replay_seed()), so the
+ * same emits give the same particles */
+void particle_seed(uint16_t seed);
+
+/* Emit count particles of a kind around world position (x, y) */
+void particle_emit(const ParticleKind *kind, uint16_t x, uint8_t y,
+                   uint8_t count);
+
+void particle_update(uint16_t camera_x);
+
+/* Move every particle dx pixels left (a world moved back as a whole);
+ * ones that would cross world X 0 expire */
+void particle_shift_x(uint16_t dx);
+
+/* Drop every particle and hide the OBJ slots */
+void particle_clear(void);
+
+/* Particles currently held in the ring (expired ones in the middle of
+ * the ring count until the older ones before them are gone) */
+uint8_t particle_count(void);
+
+#endif
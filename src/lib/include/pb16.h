@@ -0,0 +1,35 @@
+#ifndef PB16_H
+#define PB16_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * PB16 tile decompression
+ *
+ * PB16 is a PackBits variant tuned for 2bpp tiles: each byte is either a
+ * literal or a repeat of the byte two positions back, which is the same
+ * bit plane of the previous pixel row.  The stream is a run of packets,
+ * one control byte (bit 7 first, 1 = repeat) then the literals of up to 8
+ * output bytes.  Flat areas and vertical runs cost 1 bit per byte.
+ *
+ * Compressed tile blobs are generated by tools/gbc_asset_builder.py when
+ * a definition sets TILE_CODEC = 'pb16'; the generated header then has a
+ * <NAME>_SET_TILES(first) macro that calls the right loader for the
+ * codec, so switching an asset between 'raw' and 'pb16' needs no code
+ * change.  Decoding runs a few tiles at a time through a small buffer
+ * and straight on to VRAM, so no RAM copy of the whole tile set is made.
+ * ----------------------------------------------------------------------- */
+
+#define TILE_CODEC_RAW   0U
+#define TILE_CODEC_PB16  1U
+
+/* Decompress nb tiles (nb * 16 bytes) from src into BG / OBJ tile data
+ * starting at tile first, like set_bkg_data() / set_sprite_data(). */
+void pb16_set_bkg_data(uint8_t first, uint8_t nb, const uint8_t *src);
+void pb16_set_sprite_data(uint8_t first, uint8_t nb, const uint8_t *src);
+
+/* Decompress len bytes (a multiple of 8) from src into dst in RAM.
+ * Returns a pointer to the first byte after the packed data. */
+const uint8_t *pb16_unpack(uint8_t *dst, const uint8_t *src, uint16_t len);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * In-ROM frame profiler
+ *
+ * Wrap the phases of a frame in PROF_BEGIN(id) / PROF_END(id) and call
+ * PROF_FRAME() once per frame straight after vsync().  Each phase
+ * accumulates min / avg / max over a window of PROFILER_WINDOW frames;
+ * frames whose logic overran into the next VBlank are counted as lag.
+ *
+ * Time base
+ * ---------
+ *   LY_REG (scanline, 114 M-cycles each) combined with sys_time (VBlank
+ *   counter), so a phase may straddle VBlank or even several frames.
+ *   Results are in scanlines: 154 lines = one full frame.
+ *
+ * Build switch
+ * ------------
+ *   Everything here only exists when PROFILE is defined (make PROFILE=1).
+ *   In release builds the PROF_* markers expand to nothing.  With DEBUG
+ *   also defined, every completed window is printed with EMU_printf.
+ * ----------------------------------------------------------------------- */
+
+#define PROFILER_MAX_PHASES  8U
+#define PROFILER_WINDOW     64U   /* frames per statistics window (power of 2) */
+
+#ifdef PROFILE
+
+/* Statistics for one phase over the last completed window */
+typedef struct {
+    uint8_t min;    /* scanlines */
+    uint8_t avg;
+    uint8_t max;
+} ProfilerStat;
+
+/* -----------------------------------------------------------------------
+ * profiler_init
+ * Reset all statistics.  names[] gives a short label per phase for the
+ * EMU_printf report (may be NULL); count is the number of phases used.
+ * ----------------------------------------------------------------------- */
+void profiler_init(const char * const *names, uint8_t count);
+
+void profiler_begin(uint8_t phase);
+void profiler_end(uint8_t phase);
+
+/* -----------------------------------------------------------------------
+ * profiler_frame
+ * Close the previous frame: count lag when more than one VBlank passed
+ * since the last call, and roll the window every PROFILER_WINDOW frames.
+ * ----------------------------------------------------------------------- */
+void profiler_frame(void);
+
+/* -----------------------------------------------------------------------
+ * profiler_window_ready
+ * Returns 1 once per completed window (then clears the flag) so callers
+ * can refresh an on-screen overlay only when the numbers change.
+ * ----------------------------------------------------------------------- */
+uint8_t profiler_window_ready(void);
+
+/* Results of the last completed window */
+const ProfilerStat* profiler_stat(uint8_t phase);
+uint8_t profiler_lag_frames(void);
+
+#define PROF_BEGIN(phase)  profiler_begin(phase)
+#define PROF_END(phase)    profiler_end(phase)
+#define PROF_FRAME()       profiler_frame()
+
+#else
+
+#define PROF_BEGIN(phase)
+#define PROF_END(phase)
+#define PROF_FRAME()
+
+#endif
+
+#endif
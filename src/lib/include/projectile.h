@@ -0,0 +1,103 @@
+#ifndef PROJECTILE_H
+#define PROJECTILE_H
+
+#include <stdint.h>
+#include "sprite.h"
+
+/* -----------------------------------------------------------------------
+ * Projectile pool – player shots and enemy bullets.
+ *
+ * Projectiles are not Sprites: each one is a few bytes in parallel arrays
+ * (position, velocity, lifetime, tile, owner) plus one OBJ slot from a
+ * block reserved with projectile_init().  Live projectiles are kept packed
+ * at the front of the arrays (a despawn moves the last one into the hole),
+ * so the per-frame loop touches exactly the live count and nothing else.
+ *
+ * Coordinates
+ * -----------
+ *   x : 16-bit world X of the projectile's left edge
+ *   y : world Y (screen top), like Sprite.world_y
+ *   The hit box is the PROJ_HIT_* square inside the 8x8 graphic.
+ *
+ * Frame protocol
+ * --------------
+ *   projectile_update(camera_x) : move everything, test against the solid
+ *       tiles set with projectile_set_map() and despawn on wall hit, end
+ *       of life or leaving the camera view.
+ *   projectile_hit(sprite, owner) : test every live projectile of one
+ *       owner against one sprite (screen-relative world_x, as kept by the
+ *       game's sprite modules) and despawn the ones that hit.  The
+ *       sprite's hit box is computed once for the whole batch.
+ *   projectile_draw() : write the OBJ slots (hides freed ones).
+ * ----------------------------------------------------------------------- */
+
+#define PROJ_MAX          24U    /* live projectiles (one OBJ each)   */
+
+#define PROJ_OWNER_PLAYER 0U
+#define PROJ_OWNER_ENEMY  1U
+
+#define PROJ_NONE         0xFFU  /* projectile_spawn(): pool full     */
+
+/* Hit box inside the 8x8 graphic */
+#define PROJ_HIT_X        2U
+#define PROJ_HIT_Y        2U
+#define PROJ_HIT_W        4U
+#define PROJ_HIT_H        4U
+
+/* -----------------------------------------------------------------------
+ * projectile_init
+ * Empty the pool and hide its OBJ slots first_obj .. first_obj+PROJ_MAX-1.
+ * palette is the CGB OBJ palette used for all projectiles (with
+ * VRAM_ATTR_BANK1 when their tiles are in VRAM bank 1).  Call once
+ * when entering a state that uses projectiles.
+ * ----------------------------------------------------------------------- */
+void projectile_init(uint8_t first_obj, uint8_t palette);
+
+/* -----------------------------------------------------------------------
+ * projectile_set_map
+ * Set the tilemap projectiles collide with; tiles whose IDs appear in
+ * solid[] stop them.  The list is turned into a 256-bit lookup table, so
+ * the per-projectile cost does not depend on its length.  tilemap and
+ * solid[] live in ROM bank bank: projectile_update() maps it in once per
+ * frame for all map reads and restores the caller's bank.
+ * ----------------------------------------------------------------------- */
+void projectile_set_map(uint8_t bank, const uint8_t *tilemap,
+                        uint8_t map_w, uint8_t map_h,
+                        const uint8_t *solid, uint8_t solid_count);
+
+/* -----------------------------------------------------------------------
+ * projectile_set_map_reader
+ * projectile_set_map() for a map_w x map_h map with no ROM array (e.g. a
+ * generated level): each tile is read with tile_at(col, row), a bank-0
+ * function that does its own bank switching (level_tile()).  map_w 0
+ * means no right edge (an endless level; col wraps every 256).  solid[]
+ * lives in ROM bank bank.
+ * ----------------------------------------------------------------------- */
+typedef uint8_t (*ProjTileFn)(uint8_t col, uint8_t row);
+
+void projectile_set_map_reader(ProjTileFn tile_at, uint8_t bank,
+                               uint8_t map_w, uint8_t map_h,
+                               const uint8_t *solid, uint8_t solid_count);
+
+/* Spawn a projectile; life = frames before it expires (1..255).  The
+ * graphic is mirrored when vx < 0.  Returns its index or PROJ_NONE when
+ * the pool is full. */
+uint8_t projectile_spawn(uint16_t x, uint8_t y, int8_t vx, int8_t vy,
+                         uint8_t life, uint8_t tile, uint8_t owner);
+
+/* Despawn everything and hide the OBJ slots */
+void projectile_clear(void);
+
+void    projectile_update(uint16_t camera_x);
+
+/* Move every projectile dx pixels left (a world moved back as a whole);
+ * ones that would cross world X 0 are despawned */
+void    projectile_shift_x(uint16_t dx);
+
+uint8_t projectile_hit(const Sprite *s, uint8_t owner);
+void    projectile_draw(void);
+
+/* Number of live projectiles */
+uint8_t projectile_count(void);
+
+#endif
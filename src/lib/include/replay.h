@@ -0,0 +1,59 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Joypad recording / replay in cartridge SRAM
+ *
+ * While recording, every replay_input() call stores the live pad sample
+ * it is given run-length encoded as (buttons, run) byte pairs in SRAM bank
+ * REPLAY_SRAM_BANK.  While playing, replay_input() returns the recorded
+ * samples instead, so a deterministic game loop reproduces the recorded
+ * run frame-exactly.  A 16-bit seed is stored with the recording so any
+ * PRNG use can be replayed too.
+ *
+ * Rules for deterministic replay
+ * ------------------------------
+ *   - Sample input exactly once per logic frame.  input_update() (see
+ *     input.h) does this for every state, overlays such as pause
+ *     included.
+ *   - Seed every PRNG from replay_seed() when the recorded session starts.
+ *   - Game logic must not depend on sys_time, DIV_REG or LY_REG.
+ *
+ * SRAM is enabled only for the duration of each access.  The pair count in
+ * the header is updated with every pair, so a recording interrupted by a
+ * power-off stays playable up to the last completed run.
+ * ----------------------------------------------------------------------- */
+
+#define REPLAY_SRAM_BANK  1U   /* bank 0 is reserved for save data */
+
+#define REPLAY_IDLE       0U
+#define REPLAY_RECORDING  1U
+#define REPLAY_PLAYING    2U
+
+/* Start a new recording (overwrites the previous one). */
+void replay_record_start(uint16_t seed);
+
+/* Start playing back the stored recording.  Returns 0 (and stays idle)
+ * when SRAM holds no valid recording. */
+uint8_t replay_play_start(void);
+
+/* Finish recording (flushes the pending run) or abandon playback. */
+void replay_stop(void);
+
+/* Filter one frame's pad sample: records live, returns the recorded
+ * sample instead or passes live through depending on the mode.  When
+ * playback runs out the mode returns to REPLAY_IDLE and live input is
+ * returned from then on. */
+uint8_t replay_input(uint8_t live);
+
+uint8_t  replay_mode(void);
+
+/* Seed of the session being recorded or played back */
+uint16_t replay_seed(void);
+
+/* 1 if SRAM holds a valid, non-empty recording */
+uint8_t replay_available(void);
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef SAVE_H
+#define SAVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Battery-backed save data in cartridge SRAM
+ *
+ * The game reads and writes save_data, a WRAM mirror of the saved fields,
+ * and calls save_commit() at a safe point (end of a session, leaving an
+ * options screen, ...) to make the changes persistent.
+ *
+ * Power-loss safety
+ * -----------------
+ *   SRAM bank SAVE_SRAM_BANK holds two slots.  A commit always writes the
+ *   slot that is NOT the current one: payload first, then its CRC16, and
+ *   the sequence number last.  save_load() picks the valid slot (magic,
+ *   version, size and CRC all match) with the newest sequence number, so
+ *   a write cut short by a power-off only ever loses that one commit.
+ *
+ * Dirty blocks
+ * ------------
+ *   The payload is split into SAVE_BLOCK_SIZE-byte blocks.  Change fields
+ *   with SAVE_SET() (or call save_mark() after writing save_data directly)
+ *   and a commit writes only the blocks changed since the target slot was
+ *   last written, skipping bytes SRAM already holds.
+ *
+ * SRAM is enabled only for the duration of save_load() / save_commit().
+ * ----------------------------------------------------------------------- */
+
+#define SAVE_SRAM_BANK   0U   /* bank 1 is used by replay */
+
+/* Bump when the SaveData layout changes: older saves load as defaults */
+#define SAVE_VERSION     1U
+
+#define SAVE_BLOCK_SIZE  8U
+#define SAVE_MAX_SIZE    (SAVE_BLOCK_SIZE * 8U)   /* one bit per block */
+
+/* Saved fields.  Extend freely up to SAVE_MAX_SIZE bytes. */
+typedef struct {
+    uint16_t high_score;
+    uint16_t best_time;        /* most seconds left on a completed level */
+    uint8_t  best_checkpoint;  /* furthest checkpoint count ever reached */
+    uint8_t  options;          /* SAVE_OPT_* bits                        */
+} SaveData;
+
+/* Game options (bit flags in SaveData.options) */
+#define SAVE_OPT_SOUND_OFF  0x01U
+
+extern SaveData save_data;
+
+/* -----------------------------------------------------------------------
+ * save_load
+ * Read the newest valid slot into save_data.  Returns 1 if a save was
+ * found, 0 if save_data was reset to defaults (blank or corrupt SRAM).
+ * Checks both slots' CRCs only, so it is cheap enough for a state init().
+ * ----------------------------------------------------------------------- */
+uint8_t save_load(void);
+
+/* -----------------------------------------------------------------------
+ * save_mark
+ * Flag len bytes of save_data starting at offset as changed.
+ * ----------------------------------------------------------------------- */
+void save_mark(uint8_t offset, uint8_t len);
+
+#define SAVE_SET(field, value) do {                                        \
+        save_data.field = (value);                                         \
+        save_mark((uint8_t)offsetof(SaveData, field),                      \
+                  (uint8_t)sizeof(save_data.field));                       \
+    } while (0)
+
+/* -----------------------------------------------------------------------
+ * save_commit
+ * Write the changed blocks of save_data to the spare slot and make it the
+ * current one.  Returns the number of bytes written to SRAM (0 when
+ * nothing was marked since the last commit).
+ * ----------------------------------------------------------------------- */
+uint8_t save_commit(void);
+
+#endif
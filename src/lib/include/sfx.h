@@ -0,0 +1,105 @@
+#ifndef SFX_H
+#define SFX_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Scripted sound effects (see docs/sound-effects-lib.md)
+ *
+ * An effect is a list of frames; each frame waits a number of VBlanks and
+ * then writes a few APU registers.  One slot per hardware channel plays
+ * at most one effect, so sfx_update() costs O(1) per active channel:
+ * count down, and on the frame boundary apply that frame's writes.
+ *
+ * Effect scripts are const ROM tables generated by tools/gen_sfx.py from
+ * res/sfx/<name>/definition.py into res/<name>.c / .h, which provide the
+ * sfx_defs[] table used by sfx_play() and an SFX_<NAME> id per effect.
+ *
+ * Channels reserved for music with sfx_set_music_mask() are never
+ * touched, so a music driver (e.g. hUGEDriver) can run alongside.
+ *
+ * Frame protocol
+ * --------------
+ *   sfx_update() : call once per frame straight after vsync().
+ *
+ * SFX_TEST_MODE
+ * -------------
+ *   Register writes go to sfx_test_log[] instead of the APU, so a test can
+ *   check the exact write sequence of every effect frame by frame.
+ * ----------------------------------------------------------------------- */
+
+/* Channel bits for preferred_channel and the music mask */
+#define SFX_CH1  0x01U
+#define SFX_CH2  0x02U
+#define SFX_CH3  0x04U
+#define SFX_CH4  0x08U
+
+/* Priorities: a playing effect is only preempted by a higher one */
+typedef uint8_t sfx_priority_t;
+#define SFX_PRIO_DEFAULT  0U   /* use the effect's priority_hint */
+#define SFX_PRIO_LOW      1U
+#define SFX_PRIO_NORMAL   2U
+#define SFX_PRIO_HIGH     3U
+
+/* One register write: NRxx low address (0x10..0x26) and value.  Channel
+ * registers are written for the lowest channel in preferred_channel and
+ * moved to the channel the effect actually plays on. */
+typedef struct {
+    uint8_t reg;
+    uint8_t val;
+} sfx_write_t;
+
+typedef struct {
+    uint8_t vbls;            /* VBlanks after the previous frame (0 = 1) */
+    const sfx_write_t *ops;  /* writes applied in order                 */
+    uint8_t count;
+} sfx_frame_t;
+
+typedef struct {
+    uint8_t preferred_channel;  /* SFX_CHn bits the effect may play on */
+    uint8_t priority_hint;      /* priority for SFX_PRIO_DEFAULT       */
+    const sfx_frame_t *frames;
+    uint8_t frame_count;
+} sfx_def_t;
+
+/* Generated effect table (res/sfx_defs.c) */
+extern const sfx_def_t sfx_defs[];
+extern const uint8_t   sfx_defs_count;
+
+/* -----------------------------------------------------------------------
+ * sfx_init
+ * Power the APU on, route every channel to both speakers at full master
+ * volume (NR52 = 0x80, NR50 = 0x77, NR51 = 0xFF), clear all slots and the
+ * music mask.  Write NR50 / NR51 afterwards to override the routing.
+ * ----------------------------------------------------------------------- */
+void sfx_init(void);
+
+/* Advance every playing effect by one VBlank */
+void sfx_update(void);
+
+/* -----------------------------------------------------------------------
+ * sfx_play
+ * Start effect id on the first of its preferred channels that is not
+ * reserved for music and is idle; failing that, on the first one playing
+ * a lower-priority effect (or the same effect, which restarts it).
+ * Returns 1 if the effect started, 0 if every candidate channel was busy.
+ * ----------------------------------------------------------------------- */
+uint8_t sfx_play(uint8_t id, sfx_priority_t prio);
+
+/* 1 if an effect is playing on any of the given SFX_CHn channels */
+uint8_t sfx_is_busy(uint8_t channels);
+
+/* Stop every effect and silence the channels they were using */
+void sfx_stop_all(void);
+
+/* Reserve channels for music.  Effects playing on a newly reserved
+ * channel are dropped without touching its registers. */
+void sfx_set_music_mask(uint8_t mask);
+
+#ifdef SFX_TEST_MODE
+#define SFX_TEST_LOG_SIZE  64U   /* power of 2 */
+extern sfx_write_t sfx_test_log[SFX_TEST_LOG_SIZE];
+extern uint8_t     sfx_test_log_len;   /* total writes, wraps at 256 */
+#endif
+
+#endif
@@ -7,16 +7,39 @@ typedef enum {
     STATE_TITLE_SCREEN = 0,
     STATE_GAMEPLAY,
     STATE_GAME_OVER,
-    STATE_WIN
+    STATE_WIN,
+    STATE_PAUSE
 } GameStateID;
 
+/* init/update/cleanup are required; pause/resume may be NULL.
+ * pause()  : called on the state below when an overlay is pushed on top.
+ * resume() : called on it again when that overlay is popped.  The state
+ *            keeps its VRAM, WRAM and entity state in between, so resume
+ *            only has to restore what the overlay borrowed.              */
 typedef struct {
     void (*init)(void);
     void (*update)(void);
     void (*cleanup)(void);
+    void (*pause)(void);
+    void (*resume)(void);
 } GameState;
 
+/* Maximum number of stacked states (base state + overlays) */
+#define STATE_STACK_MAX 4U
+
+/* Replace the whole stack with new_state: every stacked state is cleaned
+ * up (top first), then new_state is initialised as the base state.       */
 void switch_state(GameStateID new_state);
+
+/* Push new_state as an overlay: pause() the current state, then init()
+ * new_state.  Ignored when the stack is full.                            */
+void push_state(GameStateID new_state);
+
+/* Pop the top overlay: cleanup() it, then resume() the state below.
+ * The base state is never popped.                                       */
+void pop_state(void);
+
+/* Run update() of the top state only. */
 void run_current_state(void);
 
 BANKREF_EXTERN(state_title)
@@ -31,4 +54,7 @@ extern const GameState state_gameover;
 BANKREF_EXTERN(state_win)
 extern const GameState state_win;
 
+BANKREF_EXTERN(state_pause)
+extern const GameState state_pause;
+
 #endif
@@ -0,0 +1,62 @@
+#ifndef TILE_ANIM_H
+#define TILE_ANIM_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Animated BG tiles
+ *
+ * An animated tile keeps its tile ID; only its 16 bytes of tile data are
+ * replaced in VRAM.  Every map cell showing the tile changes at once, so
+ * a flag, water surface or torch costs one tile upload per frame step
+ * however often it appears on the map, and no tilemap is rewritten.
+ *
+ * Frame sequences are declared in a background definition
+ * (ANIMATED_TILES, see tools/gen_background.py) and generated next to
+ * the tile set as a TileAnimSet.  Frame 0 of each sequence is the tile's
+ * own art, so the map looks right before the first swap.
+ *
+ * Frame protocol
+ * --------------
+ *   tile_anim_start() : when the tile set is loaded (copies the table)
+ *   tile_anim_commit(): once per frame during VBlank (after vsync()).
+ *                       Advances every timer, then uploads due frames,
+ *                       round-robin, at most TILE_ANIM_BUDGET bytes; a
+ *                       frame over budget waits for the next VBlank.
+ *   tile_anim_stop()  : before the tile range is released
+ * ----------------------------------------------------------------------- */
+
+#define TILE_ANIM_MAX     8U    /* animated tiles per set                  */
+#define TILE_ANIM_BUDGET  64U   /* bytes uploaded per commit (4 tiles)     */
+
+typedef struct {
+    uint8_t tile;           /* tile ID within the set                      */
+    uint8_t first_frame;    /* index of frame 0 in the set's frame data    */
+    uint8_t frame_count;
+    uint8_t speed;          /* frames (1/60 s) each animation frame shows  */
+} TileAnim;
+
+typedef struct {
+    const uint8_t  *frames;   /* 16 bytes per frame, raw 2bpp             */
+    const TileAnim *anims;
+    uint8_t         count;
+} TileAnimSet;
+
+/* -----------------------------------------------------------------------
+ * tile_anim_start
+ * Animate set (in ROM bank rom_bank, 0 = always mapped) for a tile set
+ * loaded at tile_base in VRAM bank vram_bank (vram_tile() / vram_bank()
+ * of its handle).  NULL stops animating.  Sets over TILE_ANIM_MAX are
+ * cut short.
+ * ----------------------------------------------------------------------- */
+void tile_anim_start(uint8_t rom_bank, const TileAnimSet *set,
+                     uint8_t tile_base, uint8_t vram_bank);
+
+void tile_anim_stop(void);
+
+void tile_anim_commit(void);
+
+/* Number of tiles whose new frame is still waiting for an upload */
+uint8_t tile_anim_pending(void);
+
+#endif
@@ -5,8 +5,9 @@
 #include <stdint.h>
 
 /* Draw a null-terminated ASCII string as background tiles at (x, y).
-   tile_offset is the VRAM tile index corresponding to ASCII 32 (space).
+   font is the vram.h handle of the font tiles (first tile = ASCII 32,
+   space), e.g. from FONT_VRAM_LOAD().
    Text tiles are assigned GBC palette 2 (font palette: black text). */
-void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t tile_offset);
+void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t font);
 
 #endif
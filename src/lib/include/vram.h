@@ -0,0 +1,100 @@
+#ifndef VRAM_H
+#define VRAM_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * VRAM tile allocator – BG and OBJ tile ranges in both CGB VRAM banks.
+ *
+ * Tile memory (per VRAM bank, GBDK's default LCDC addressing):
+ *
+ *   0x8000-0x87FF  OBJ tiles   0-127            OBJ only
+ *   0x8800-0x8FFF  OBJ/BG tiles 128-255         shared
+ *   0x9000-0x97FF  BG tiles    0-127            BG only
+ *
+ * CGB has two such banks; BG attribute bit 3 and OBJ attribute bit 3
+ * (VRAM_ATTR_BANK1) pick bank 1.  That is 768 tiles instead of 384.
+ *
+ * A request for count tiles of one kind gets the first free contiguous
+ * range, searching VRAM bank 0 then bank 1 and, within a bank, the
+ * kind's own block before the shared one.  While 8x16 sprites are on
+ * (LCDCF_OBJ16, so set SPRITES_8x16 before loading OBJ tiles) OBJ ranges
+ * start on an even tile, as the hardware ignores bit 0 of an 8x16
+ * sprite's tile index.  Callers keep a one-byte
+ * handle and ask for the tile index and attribute bit with vram_tile() /
+ * vram_attr() instead of computing offsets by hand.
+ *
+ * Sharing
+ * -------
+ *   vram_load() is keyed by the tile data pointer: loading data that is
+ *   already resident (as the same kind) only adds a reference and returns
+ *   the existing handle, so e.g. a pause overlay and the state under it
+ *   share one copy of the font.  Tiles are freed when the last reference
+ *   goes.
+ *
+ * Arenas
+ * ------
+ *   References are recorded in the current arena.  vram_arena_pop()
+ *   drops every reference taken since the matching vram_arena_push().
+ *   The state machine pushes an arena before each state's init() and
+ *   pops it after its cleanup(), so a state's tiles go away with it.
+ *   References taken before the first state (main.c) are permanent.
+ *
+ * Maps
+ * ----
+ *   Generated attr maps never set bit 3; vram_set_bkg_submap() adds the
+ *   handle's first tile to every map entry and its bank bit to every
+ *   attribute on the way to VRAM.
+ * ----------------------------------------------------------------------- */
+
+#define VRAM_BG           0U
+#define VRAM_OBJ          1U
+
+#define VRAM_NONE         0xFFU   /* no handle: out of tiles or entries   */
+#define VRAM_ATTR_BANK1   0x08U   /* BG / OBJ attribute: tiles in bank 1  */
+
+#define VRAM_MAX_ENTRIES  16U     /* distinct resident ranges             */
+#define VRAM_MAX_REFS     32U     /* references held across all arenas    */
+#define VRAM_MAX_ARENAS    6U     /* root + one per stacked state         */
+
+/* Free everything (including permanent references) */
+void vram_init(void);
+
+/* -----------------------------------------------------------------------
+ * vram_load
+ * Reference count tiles of data for kind (VRAM_BG / VRAM_OBJ), loading
+ * them into a new range unless the same data is already resident.
+ * tiles lives in ROM bank rom_bank (0 = bank 0 / always mapped) and is
+ * stored with codec (TILE_CODEC_*).  Returns VRAM_NONE when no range or
+ * entry is free.  Generated assets have <NAME>_VRAM_LOAD() for this.
+ * ----------------------------------------------------------------------- */
+uint8_t vram_load(uint8_t kind, const uint8_t *tiles, uint8_t rom_bank,
+                  uint8_t count, uint8_t codec);
+
+/* Reserve count tiles with no data (e.g. a VWF ring); never shared */
+uint8_t vram_alloc(uint8_t kind, uint8_t count);
+
+/* Drop one reference taken in the current arena; frees at zero */
+void vram_release(uint8_t handle);
+
+uint8_t vram_tile(uint8_t handle);   /* first tile index (BG or OBJ)   */
+uint8_t vram_bank(uint8_t handle);   /* VRAM bank 0 or 1               */
+uint8_t vram_attr(uint8_t handle);   /* VRAM_ATTR_BANK1 or 0           */
+
+void vram_arena_push(void);
+void vram_arena_pop(void);
+
+/* Free tiles a kind can still use, both banks */
+uint16_t vram_free_tiles(uint8_t kind);
+
+/* -----------------------------------------------------------------------
+ * vram_set_bkg_submap
+ * set_bkg_submap() for a map made of the handle's tiles: cells (x, y) ..
+ * (x+w-1, y+h-1) of a map_w wide map and its attr map (may be NULL),
+ * read from the handle's ROM bank, with tile and bank bit applied.
+ * ----------------------------------------------------------------------- */
+void vram_set_bkg_submap(uint8_t handle, uint8_t x, uint8_t y,
+                         uint8_t w, uint8_t h, const uint8_t *map,
+                         const uint8_t *attr_map, uint8_t map_w);
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef VWF_H
+#define VWF_H
+
+#include <stdint.h>
+
+/* -----------------------------------------------------------------------
+ * Variable-width text
+ *
+ * Proportional glyphs are packed side by side into a small ring of
+ * scratch BG tiles, so "Hi!" takes 2 tiles instead of 3 and a line of
+ * dialog about half as many as draw_text().
+ *
+ * Glyphs come pre-shifted from tools/gen_font.py (res/<font>_vwf.c): for
+ * each glyph and each of the 8 pixel offsets inside a tile there is one
+ * byte per row for the tile the pen is in and one for the tile it spills
+ * into.  Drawing a character is therefore two table reads and two ORs
+ * per row into a RAM copy of the tiles - no per-pixel shifting.
+ *
+ * Composed tiles are not written to VRAM straight away: they are queued
+ * and vwf_commit() uploads them (and points the map cells at them) during
+ * VBlank, so text can be typed out one character per frame while the
+ * game runs.
+ *
+ * Tile ring
+ * ---------
+ *   vwf_init() hands the engine tile_count BG tiles from first_tile.
+ *   Each started tile takes the next one; after the last it wraps and
+ *   reuses the first, whose old text then changes.  Size the ring for
+ *   the VWF text that is on screen at once, and vwf_clear() between
+ *   pages of dialog.
+ *
+ * Frame protocol
+ * --------------
+ *   vwf_commit() : call once per frame during VBlank (after vsync()).
+ * ----------------------------------------------------------------------- */
+
+#define VWF_MAX_TILES      32U   /* largest ring vwf_init() accepts        */
+#define VWF_COMMIT_TILES   4U    /* tiles uploaded per vwf_commit() at most */
+#define VWF_ATTR           0x02U /* BG attribute of text cells: font palette */
+
+/* Generated font (see tools/gen_font.py).  Glyph g at pixel offset s is
+ * at glyphs[(g * 8 + s) * height * 2]: height bytes for the pen tile,
+ * then height bytes spilling into the next tile. */
+typedef struct {
+    const uint8_t *widths;   /* advance in pixels, 1-pixel gap included */
+    const uint8_t *glyphs;
+    uint8_t first_char;      /* character code of glyph 0               */
+    uint8_t glyph_count;
+    uint8_t height;          /* rows per glyph (from the top of the tile) */
+} vwf_font_t;
+
+/* -----------------------------------------------------------------------
+ * vwf_init
+ * Use font (stored in ROM bank font_bank, e.g. BANK(font_vwf)) and BG
+ * tiles first_tile .. first_tile + tile_count - 1 (at most VWF_MAX_TILES)
+ * of VRAM bank vram_bank (0 or 1, see vram_alloc()) as the tile ring;
+ * text cells of a bank-1 ring get VWF_ATTR | 0x08.  Clears the ring and
+ * the upload queue.
+ * ----------------------------------------------------------------------- */
+void vwf_init(const vwf_font_t *font, uint8_t font_bank,
+              uint8_t first_tile, uint8_t tile_count, uint8_t vram_bank);
+
+/* Drop all queued uploads and restart the ring at its first tile */
+void vwf_clear(void);
+
+/* Put the pen at the left edge of BG map cell (x, y) */
+void vwf_move_to(uint8_t x, uint8_t y);
+
+/* Draw one character at the pen and advance it.  Codes outside the font
+ * are skipped.  Returns the advance in pixels (0 if skipped). */
+uint8_t vwf_putc(char c);
+
+/* vwf_move_to(x, y) then vwf_putc() every character of str.  str may be
+ * in the caller's ROM bank, bank 0 or RAM (not in the font's bank). */
+void vwf_print(uint8_t x, uint8_t y, const char *str);
+
+/* Width of str in pixels, trailing gap included (for centring); str may
+ * be anywhere vwf_print() accepts */
+uint16_t vwf_text_width(const char *str);
+
+/* Upload up to VWF_COMMIT_TILES queued tiles and their map cells */
+void vwf_commit(void);
+
+/* Number of tiles still waiting for vwf_commit() */
+uint8_t vwf_pending(void);
+
+#endif
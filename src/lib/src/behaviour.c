@@ -0,0 +1,170 @@
+#include <gb/gb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "behaviour.h"
+#include "level.h"
+
+static uint8_t _feet_row(const Sprite *s)
+{
+    return (uint8_t)((uint8_t)(s->world_y + s->height) >> 3);
+}
+
+/* A wall one step ahead, or (on the ground) no ground under the leading
+ * edge after the step */
+static uint8_t _blocked(const Behaviour *b)
+{
+    const Sprite *s = b->sprite;
+    uint16_t      next, lead;
+
+    if (b->dx < 0 && b->x16 == 0U) return 1U;
+    next = (uint16_t)(b->x16 + b->dx);
+    if (level_box_solid(s, next)) return 1U;
+    if (b->airborne) return 0U;
+    lead = (b->dx > 0) ? (uint16_t)(next + s->width - 1U) : next;
+    return !level_ground_span(lead, lead, _feet_row(s));
+}
+
+/* Airborne: move by vy, accelerate, land on the first ground row the
+ * feet cross on the way down */
+static void _fall(Behaviour *b)
+{
+    Sprite  *s    = b->sprite;
+    uint16_t feet = (uint16_t)(s->world_y + s->height);
+    uint16_t next, top;
+
+    if (b->vy < 0) {
+        s->world_y = (s->world_y > (uint8_t)-b->vy) ? (uint8_t)(s->world_y + b->vy) : 0U;
+    } else {
+        next = (uint16_t)(feet + (uint8_t)b->vy);
+        top  = (uint16_t)(next & ~7U);
+        if (top > feet &&
+            level_ground_span(b->x16, (uint16_t)(b->x16 + s->width - 1U), (uint8_t)(top >> 3))) {
+            s->world_y  = (uint8_t)(top - s->height);
+            b->airborne = 0U;
+            b->vy       = 0;
+            return;
+        }
+        if (next >= (uint16_t)((uint16_t)level.height * 8U + s->height)) {
+            b->events |= BHV_EV_FELL;
+            b->script   = NULL;
+            b->airborne = 0U;
+            return;
+        }
+        s->world_y = (uint8_t)(s->world_y + b->vy);
+    }
+    if (b->vy < BHV_FALL_MAX) b->vy++;
+}
+
+void behaviour_start(Behaviour *b, uint8_t rom_bank,
+                     const uint8_t * const *table, uint8_t id,
+                     Sprite *sprite, uint16_t x16)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+
+    SWITCH_ROM(rom_bank);
+    b->script = table[id];
+    SWITCH_ROM(saved_bank);
+
+    b->rom_bank    = rom_bank;
+    b->pc          = 0U;
+    b->wait        = 0U;
+    b->walking     = 0U;
+    b->airborne    = 0U;
+    b->dx          = 1;
+    b->vy          = 0;
+    b->events      = 0U;
+    b->anim_start  = 0U;
+    b->anim_frames = 1U;
+    b->x16         = x16;
+    b->sprite      = sprite;
+    sprite->anim_frame   = 0U;
+    sprite->anim_counter = 0U;
+}
+
+void behaviour_update(Behaviour *b, uint16_t player_x16)
+{
+    uint8_t        saved_bank = CURRENT_BANK;
+    uint8_t        budget     = BHV_BUDGET;
+    uint8_t        op;
+    uint16_t       dist;
+    const uint8_t *p;
+
+    b->events = 0U;
+    if (b->airborne) _fall(b);
+    if (!b->script) return;
+
+    SWITCH_ROM(b->rom_bank);
+    while (budget) {
+        /* A WALK / WAIT in progress takes the whole frame */
+        if (b->wait) {
+            if (b->walking) {
+                if (_blocked(b)) {
+                    b->wait = 0U;       /* go on with the next instruction */
+                    continue;
+                }
+                b->x16 = (uint16_t)(b->x16 + b->dx);
+            }
+            b->wait--;
+            break;
+        }
+
+        budget--;
+        p  = b->script + b->pc;
+        op = p[0];
+        switch (op) {
+        case BHV_OP_WALK:
+        case BHV_OP_WAIT:
+            b->wait    = p[1];
+            b->walking = (uint8_t)(op == BHV_OP_WALK);
+            b->pc      = (uint8_t)(b->pc + 2U);
+            break;
+        case BHV_OP_TURN:
+            b->dx = (int8_t)-b->dx;
+            b->pc++;
+            break;
+        case BHV_OP_TURN_AT_EDGE:
+            if (_blocked(b)) b->dx = (int8_t)-b->dx;
+            b->pc++;
+            break;
+        case BHV_OP_FACE:
+            b->dx = (player_x16 < b->x16) ? -1 : 1;
+            b->pc++;
+            break;
+        case BHV_OP_JUMP:
+            if (!b->airborne) {
+                b->airborne = 1U;
+                b->vy       = (int8_t)-(int8_t)p[1];
+            }
+            b->pc = (uint8_t)(b->pc + 2U);
+            break;
+        case BHV_OP_FIRE:
+            b->events |= BHV_EV_FIRE;
+            b->pc++;
+            break;
+        case BHV_OP_NEAR:
+        case BHV_OP_FAR:
+            dist = (player_x16 < b->x16) ? (uint16_t)(b->x16 - player_x16)
+                                         : (uint16_t)(player_x16 - b->x16);
+            if ((dist < p[1]) == (op == BHV_OP_NEAR)) b->pc = p[2];
+            else                                      b->pc = (uint8_t)(b->pc + 3U);
+            break;
+        case BHV_OP_ANIM:
+            if (b->anim_start != p[1]) {
+                b->anim_start = p[1];
+                b->sprite->anim_frame   = 0U;
+                b->sprite->anim_counter = 0U;
+            }
+            b->anim_frames        = p[2] ? p[2] : 1U;
+            b->sprite->anim_speed = p[3];
+            b->pc = (uint8_t)(b->pc + 4U);
+            break;
+        case BHV_OP_GOTO:
+            b->pc = p[1];
+            break;
+        default:                        /* BHV_OP_END */
+            budget = 0U;
+            break;
+        }
+    }
+    SWITCH_ROM(saved_bank);
+}
@@ -0,0 +1,159 @@
+#include <stdint.h>
+#include "camera.h"
+
+Camera camera;
+
+static uint8_t  _dz_left;
+static uint8_t  _dz_right;
+static uint8_t  _dz_top;
+static uint8_t  _dz_bottom;
+static uint8_t  _look_scale;
+static uint8_t  _look_max;
+static int8_t   _look;         /* current look-ahead offset, pixels */
+static uint8_t  _shift;
+static uint8_t  _max_step;
+static uint16_t _last_fx;      /* focus X last frame, for velocity */
+
+/* Recompute the published tile edges; returns CAMERA_*_CHANGED flags */
+static uint8_t update_edges(void)
+{
+    uint8_t col = (uint8_t)(camera.x >> 3);
+    uint8_t row = (uint8_t)(camera.y >> 3);
+    uint8_t changed = 0U;
+
+    if (col != camera.col_left) changed |= CAMERA_COL_CHANGED;
+    if (row != camera.row_top)  changed |= CAMERA_ROW_CHANGED;
+    camera.col_left   = col;
+    camera.col_right  = (uint8_t)((camera.x + (CAMERA_VIEW_W - 1U)) >> 3);
+    camera.row_top    = row;
+    camera.row_bottom = (uint8_t)((camera.y + (CAMERA_VIEW_H - 1U)) >> 3);
+    return changed;
+}
+
+static uint16_t clamp_pos(int16_t pos, uint16_t lo, uint16_t hi)
+{
+    if (pos < (int16_t)lo) return lo;
+    if (pos > (int16_t)hi) return hi;
+    return (uint16_t)pos;
+}
+
+/* Move pos towards target by the smoothed step */
+static uint16_t step_towards(uint16_t pos, uint16_t target)
+{
+    uint16_t dist;
+
+    if (target == pos) return pos;
+    dist = (target > pos) ? (uint16_t)(target - pos) : (uint16_t)(pos - target);
+    dist >>= _shift;
+    if (dist == 0U) dist = 1U;
+    if (dist > _max_step) dist = _max_step;
+    return (target > pos) ? (uint16_t)(pos + dist) : (uint16_t)(pos - dist);
+}
+
+/* Camera position that puts screen position focus - pos inside [lo, hi] */
+static int16_t deadzone_target(uint16_t pos, int16_t focus,
+                               uint8_t lo, uint8_t hi)
+{
+    int16_t s = (int16_t)(focus - (int16_t)pos);
+
+    if (s > (int16_t)hi) return (int16_t)(focus - hi);
+    if (s < (int16_t)lo) return (int16_t)(focus - lo);
+    return (int16_t)pos;
+}
+
+void camera_init(uint8_t map_w, uint8_t map_h)
+{
+    uint16_t w = (uint16_t)map_w * 8U;
+    uint16_t h = (uint16_t)map_h * 8U;
+
+    camera.x     = 0U;
+    camera.y     = 0U;
+    camera.min_x = 0U;
+    camera.max_x = (w > CAMERA_VIEW_W) ? (uint16_t)(w - CAMERA_VIEW_W) : 0U;
+    if (map_w == 0U) camera.max_x = CAMERA_MAX_X;
+    camera.max_y = (h > CAMERA_VIEW_H) ? (uint16_t)(h - CAMERA_VIEW_H) : 0U;
+
+    _dz_left    = 0U;
+    _dz_right   = CAMERA_VIEW_W - 1U;
+    _dz_top     = 0U;
+    _dz_bottom  = CAMERA_VIEW_H - 1U;
+    _look_scale = 0U;
+    _look_max   = 0U;
+    _look       = 0;
+    _shift      = 0U;
+    _max_step   = 8U;
+    _last_fx    = 0U;
+    update_edges();
+}
+
+void camera_set_deadzone(uint8_t left, uint8_t right,
+                         uint8_t top, uint8_t bottom)
+{
+    _dz_left   = left;
+    _dz_right  = right;
+    _dz_top    = top;
+    _dz_bottom = bottom;
+}
+
+void camera_set_lookahead(uint8_t scale, uint8_t max_px)
+{
+    _look_scale = scale;
+    _look_max   = (max_px > 127U) ? 127U : max_px;
+    _look       = 0;
+}
+
+void camera_set_smoothing(uint8_t shift, uint8_t max_step)
+{
+    _shift    = shift;
+    _max_step = max_step ? max_step : 1U;
+}
+
+void camera_set_min_x(uint16_t min_x)
+{
+    camera.min_x = (min_x > camera.max_x) ? camera.max_x : min_x;
+}
+
+void camera_shift_x(uint16_t dx)
+{
+    camera.x     = (uint16_t)(camera.x - dx);
+    camera.min_x = (camera.min_x > dx) ? (uint16_t)(camera.min_x - dx) : 0U;
+    _last_fx     = (uint16_t)(_last_fx - dx);
+    update_edges();
+}
+
+void camera_snap(uint16_t focus_x, uint16_t focus_y)
+{
+    camera.x = clamp_pos((int16_t)(focus_x - _dz_left), camera.min_x, camera.max_x);
+    camera.y = clamp_pos((int16_t)(focus_y - _dz_top), 0U, camera.max_y);
+    _look    = 0;
+    _last_fx = focus_x;
+    update_edges();
+}
+
+uint8_t camera_update(uint16_t focus_x, uint16_t focus_y)
+{
+    int16_t vx     = (int16_t)(focus_x - _last_fx);
+    int16_t target = 0;
+    int16_t fx;
+
+    _last_fx = focus_x;
+
+    /* Look-ahead eases towards velocity * scale, held while standing */
+    if (_look_max) {
+        if (vx != 0) {
+            target = (int16_t)(vx * (int16_t)_look_scale);
+            if (target >  (int16_t)_look_max) target =  (int16_t)_look_max;
+            if (target < -(int16_t)_look_max) target = -(int16_t)_look_max;
+            if (_look < target) _look++;
+            else if (_look > target) _look--;
+        }
+    }
+    fx = (int16_t)(focus_x + _look);
+
+    target   = deadzone_target(camera.x, fx, _dz_left, _dz_right);
+    camera.x = step_towards(camera.x, clamp_pos(target, camera.min_x, camera.max_x));
+    target   = deadzone_target(camera.y, (int16_t)focus_y, _dz_top, _dz_bottom);
+    camera.y = step_towards(camera.y, clamp_pos(target, 0U, camera.max_y));
+
+    return update_edges();
+}
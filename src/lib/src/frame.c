@@ -0,0 +1,95 @@
+#include <gb/gb.h>
+#include <stdint.h>
+#include "frame.h"
+
+uint8_t frame_scx;
+uint8_t frame_scy;
+
+/* Published by frame_end(), read by the VBL handler */
+static volatile uint8_t _scx;
+static volatile uint8_t _scy;
+static volatile uint8_t _obj_cut;   /* OBJ turned off by frame_lcd() */
+
+static uint8_t  _begin_vbl;   /* sys_time when the tick was opened */
+static uint8_t  _missed;      /* VBlanks that passed during the last ticks */
+static uint16_t _lag;
+
+void frame_init(void)
+{
+    frame_scx = frame_scy = 0U;
+    _scx      = _scy      = 0U;
+    _missed   = 0U;
+    _lag      = 0U;
+    _obj_cut  = 0U;
+    CRITICAL {
+        add_VBL(frame_vbl);
+        add_LCD(frame_lcd);
+    }
+}
+
+void frame_vbl(void)
+{
+    SCX_REG = _scx;
+    SCY_REG = _scy;
+    if (_obj_cut) {
+        LCDC_REG |= LCDCF_OBJON;
+        _obj_cut = 0U;
+    }
+}
+
+void frame_lcd(void)
+{
+    /* LYC is the line before the limit: switch in its HBlank */
+    while (STAT_REG & STATF_BUSY) {}
+    LCDC_REG &= (uint8_t)~LCDCF_OBJON;
+    _obj_cut = 1U;
+}
+
+void frame_set_obj_limit(uint8_t line)
+{
+    CRITICAL {
+        if (line) {
+            LYC_REG   = (uint8_t)(line - 1U);
+            STAT_REG |= STATF_LYC;
+            set_interrupts(IE_REG | LCD_IFLAG);
+        } else {
+            STAT_REG &= (uint8_t)~STATF_LYC;
+            set_interrupts(IE_REG & (uint8_t)~LCD_IFLAG);
+        }
+    }
+}
+
+uint8_t frame_begin(void)
+{
+    uint8_t ticks = 1U;
+
+    vsync();
+    if (_missed && _missed <= FRAME_STALL_VBLS) {
+        _lag += _missed;
+        ticks = (uint8_t)((_missed > FRAME_CATCHUP_MAX) ? FRAME_CATCHUP_MAX + 1U
+                                                        : _missed + 1U);
+    }
+    _begin_vbl = (uint8_t)sys_time;
+    DISABLE_OAM_DMA;
+    return ticks;
+}
+
+void frame_resync(void)
+{
+    _begin_vbl = (uint8_t)sys_time;
+}
+
+void frame_end(void)
+{
+    _missed = (uint8_t)((uint8_t)sys_time - _begin_vbl);
+    CRITICAL {
+        _scx = frame_scx;
+        _scy = frame_scy;
+        ENABLE_OAM_DMA;
+    }
+}
+
+uint16_t frame_lag_count(void)
+{
+    return _lag;
+}
@@ -0,0 +1,115 @@
+#include <gb/gb.h>
+#include <stdint.h>
+#include "input.h"
+#include "replay.h"
+
+/* Written by the VBL handler: buttons held at any VBlank since the
+ * last input_update(), and whether there was such a VBlank */
+static volatile uint8_t _vbl_latch;
+static volatile uint8_t _vbl_seen;
+
+static uint8_t _held;
+static uint8_t _pressed;
+static uint8_t _released;
+static uint8_t _repeat;
+static uint8_t _hold_timer;           /* frames the held set is unchanged */
+static uint8_t _buffered;
+static uint8_t _buf_timer[8];
+
+void input_init(void)
+{
+    CRITICAL {
+        _vbl_latch = 0U;
+        _vbl_seen  = 0U;
+        add_VBL(input_vbl);
+    }
+    _held = 0U;
+    input_flush();
+}
+
+void input_vbl(void)
+{
+    _vbl_latch |= joypad();
+    _vbl_seen   = 1U;
+}
+
+void input_update(void)
+{
+    uint8_t j, prev, bit, i;
+
+    /* A catch-up tick in the same frame keeps holding the same buttons */
+    CRITICAL {
+        j          = _vbl_seen ? _vbl_latch : _held;
+        _vbl_latch = 0U;
+        _vbl_seen  = 0U;
+    }
+    j = replay_input(j);
+
+    prev      = _held;
+    _held     = j;
+    _pressed  = (uint8_t)(j & ~prev);
+    _released = (uint8_t)(prev & ~j);
+
+    /* Auto-repeat: one timer, restarted whenever the held set changes */
+    _repeat = _pressed;
+    if (j != prev) {
+        _hold_timer = 0U;
+    } else if (j) {
+        if (++_hold_timer >= INPUT_REPEAT_DELAY) {
+            _hold_timer = (uint8_t)(INPUT_REPEAT_DELAY - INPUT_REPEAT_RATE);
+            _repeat     = j;
+        }
+    }
+
+    /* Press buffer: one countdown per button */
+    for (i = 0U, bit = 1U; i < 8U; i++, bit <<= 1) {
+        if (_pressed & bit) {
+            _buf_timer[i] = INPUT_BUFFER_FRAMES;
+            _buffered    |= bit;
+        } else if (_buf_timer[i] && --_buf_timer[i] == 0U) {
+            _buffered &= (uint8_t)~bit;
+        }
+    }
+}
+
+uint8_t input_held(void)
+{
+    return _held;
+}
+
+uint8_t input_pressed(void)
+{
+    return _pressed;
+}
+
+uint8_t input_released(void)
+{
+    return _released;
+}
+
+uint8_t input_repeat(void)
+{
+    return _repeat;
+}
+
+uint8_t input_buffered(void)
+{
+    return _buffered;
+}
+
+void input_consume(uint8_t mask)
+{
+    uint8_t i;
+
+    _buffered &= (uint8_t)~mask;
+    for (i = 0U; i < 8U; i++, mask >>= 1) {
+        if (mask & 1U) _buf_timer[i] = 0U;
+    }
+}
+
+void input_flush(void)
+{
+    input_consume(0xFFU);
+    _hold_timer = 0U;
+    _repeat     = 0U;
+}
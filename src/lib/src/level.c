@@ -0,0 +1,319 @@
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stdint.h>
+#include "level.h"
+#include "palette.h"
+#include "sprite_manager.h"
+#include "vram.h"
+
+Level   level;
+uint8_t level_bank;
+uint8_t level_gen_map[LEVEL_GEN_ROWS * LEVEL_GEN_COLS];
+
+static uint8_t  _solid[32];    /* 256-bit tile sets */
+static uint8_t  _ground[32];
+static uint16_t _checkpoints[LEVEL_MAX_CHECKPOINTS];
+static uint8_t  _tiles = VRAM_NONE;   /* handle of the BG tiles */
+
+/* Generated levels: WRAM copies of the LevelGen and its patterns, the
+ * attributes beside level_gen_map and the column held by each cache
+ * column.  Callers pass 8-bit columns that wrap every 256; inside, a
+ * column is the 15-bit one nearest the last streamed column (_head), so
+ * the chunk picks go on past column 255.  Columns probed outside the
+ * ring go to two scratch columns, so collision queries never replace a
+ * column on screen. */
+static LevelGen _gen;
+static uint8_t  _chunks[LEVEL_GEN_MAX_CHUNKS * LEVEL_CHUNK_W];
+static uint8_t  _gen_attr[LEVEL_GEN_ROWS * LEVEL_GEN_COLS];
+static uint16_t _cached[LEVEL_GEN_COLS];
+static uint8_t  _scratch[2][LEVEL_GEN_ROWS];
+static uint16_t _scratch_col[2];
+static uint16_t _head;
+static uint16_t _seed;
+static uint16_t _chunk;        /* chunk of _pattern                 */
+static uint8_t  _pattern;      /* offset of its pattern in _chunks  */
+
+#define IN_SET(set, t)  ((set)[(t) >> 3] & (uint8_t)(1U << ((t) & 7U)))
+#define SLOT(col)       ((uint8_t)((col) & (LEVEL_GEN_COLS - 1U)))
+#define COL_MASK        0x7FFFU   /* generated column space          */
+#define NO_COL          0xFFFFU   /* cache tag: nothing held         */
+
+static void _build_set(uint8_t *set, const uint8_t *ids, uint8_t n)
+{
+    uint8_t i;
+
+    for (i = 0; i < 32U; i++) set[i] = 0U;
+    for (i = 0; i < n; i++) {
+        set[ids[i] >> 3] |= (uint8_t)(1U << (ids[i] & 7U));
+    }
+}
+
+void level_select(const LevelRef *ref)
+{
+    uint8_t      saved_bank = CURRENT_BANK;
+    const Level *desc       = ref->level;   /* ref may be in the caller's bank */
+    uint8_t      i;
+
+    level_bank = ref->bank;
+    SWITCH_ROM(level_bank);
+    level = *desc;
+    if (level.checkpoint_count > LEVEL_MAX_CHECKPOINTS) {
+        level.checkpoint_count = LEVEL_MAX_CHECKPOINTS;
+    }
+    for (i = 0; i < level.checkpoint_count; i++) {
+        _checkpoints[i] = level.checkpoints[i];
+    }
+    _build_set(_solid, level.solid, level.solid_count);
+    _build_set(_ground, level.ground, level.ground_count);
+    if (level.gen) {
+        _gen = *level.gen;
+        if (_gen.chunk_count > LEVEL_GEN_MAX_CHUNKS) {
+            _gen.chunk_count = LEVEL_GEN_MAX_CHUNKS;
+        }
+        for (i = 0; i < (uint8_t)(_gen.chunk_count * LEVEL_CHUNK_W); i++) {
+            _chunks[i] = _gen.chunks[i];
+        }
+        if (level.height > LEVEL_GEN_ROWS) level.height = LEVEL_GEN_ROWS;
+    }
+    SWITCH_ROM(saved_bank);
+    level_set_seed(0U);
+}
+
+void level_set_seed(uint16_t seed)
+{
+    uint8_t i;
+
+    _seed  = seed;
+    _head  = 0U;
+    _chunk = NO_COL;
+    for (i = 0; i < LEVEL_GEN_COLS; i++) _cached[i] = NO_COL;
+    _scratch_col[0] = NO_COL;
+    _scratch_col[1] = NO_COL;
+}
+
+/* Generated column of 8-bit column col: the one within -128..+127 of
+ * the last streamed column */
+static uint16_t _gen_col(uint8_t col)
+{
+    return (uint16_t)(_head + (int8_t)(uint8_t)(col - (uint8_t)_head)) & COL_MASK;
+}
+
+/* Pattern of a chunk: xorshift16 over the seed and the chunk number, so
+ * no chunk depends on the ones before it */
+static uint8_t _pick(uint16_t chunk)
+{
+    uint16_t x;
+
+    if (chunk < _gen.flat_chunks) return 0U;
+    x = (uint16_t)(_seed ^ (uint16_t)(chunk * 0x9E37U));
+    if (!x) x = 0xACE1U;
+    x ^= (uint16_t)(x << 7);
+    x ^= (uint16_t)(x >> 9);
+    x ^= (uint16_t)(x << 8);
+    x ^= (uint16_t)(x << 7);
+    x ^= (uint16_t)(x >> 9);
+    return (uint8_t)(x % _gen.chunk_count);
+}
+
+/* Make generated column col: tiles (and attrs, if not NULL) every
+ * stride bytes */
+static void _make_column(uint16_t col, uint8_t *tiles, uint8_t *attrs,
+                         uint8_t stride)
+{
+    uint8_t  ground = _gen.ground_row;
+    uint16_t chunk  = (uint16_t)(col / LEVEL_CHUNK_W);
+    uint8_t  code, row, kind;
+    uint16_t i;
+
+    if (chunk != _chunk) {
+        _chunk   = chunk;
+        _pattern = (uint8_t)(_pick(chunk) * LEVEL_CHUNK_W);
+    }
+    code = _chunks[_pattern + (uint8_t)(col & (LEVEL_CHUNK_W - 1U))];
+
+    i = 0U;
+    for (row = 0; row < level.height; row++, i += stride) {
+        kind = LEVEL_KIND_SKY;
+        if (row == _gen.ledge_row && (code & LEVEL_GEN_LEDGE)) {
+            kind = LEVEL_KIND_LEDGE;
+        } else if (code & LEVEL_GEN_GROUND) {
+            if (row == ground) {
+                kind = LEVEL_KIND_GRASS;
+            } else if (row > ground) {
+                kind = (row > (uint8_t)(ground + 3U)) ? LEVEL_KIND_DEEP
+                                                      : LEVEL_KIND_SOIL;
+            } else if (row == (uint8_t)(ground - 1U) && (code & LEVEL_GEN_BLOCK)) {
+                kind = LEVEL_KIND_BLOCK;
+            }
+        }
+        tiles[i] = _gen.tiles[kind];
+        if (attrs) attrs[i] = _gen.attrs[kind];
+    }
+}
+
+/* Tile of a generated cell: from the ring when it holds the column,
+ * otherwise from a scratch column (the ring is left alone) */
+static uint8_t _gen_cell(uint8_t col, uint8_t row)
+{
+    uint16_t gcol = _gen_col(col);
+    uint8_t  slot = SLOT(col);
+    uint8_t  s;
+
+    if (_cached[slot] == gcol) {
+        return level_gen_map[(uint16_t)row * LEVEL_GEN_COLS + slot];
+    }
+    s = (uint8_t)(col & 1U);
+    if (_scratch_col[s] != gcol) {
+        _make_column(gcol, _scratch[s], NULL, 1U);
+        _scratch_col[s] = gcol;
+    }
+    return _scratch[s][row];
+}
+
+uint16_t level_checkpoint(uint8_t i)
+{
+    return _checkpoints[i];
+}
+
+uint8_t level_load_tiles(void)
+{
+    _tiles = vram_load(VRAM_BG, level.tiles, level_bank, level.tile_count,
+                       level.tile_codec);
+    return _tiles;
+}
+
+void level_set_palettes(uint8_t first)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+
+    SWITCH_ROM(level_bank);
+    palette_set_bkg(first, level.palette_count, level.palettes);
+    SWITCH_ROM(saved_bank);
+}
+
+void level_set_columns(uint8_t first_col, uint8_t count)
+{
+    uint8_t  slot;
+    uint16_t gcol;
+
+    if (!level.gen) {
+        vram_set_bkg_submap(_tiles, first_col, 0U, count, level.height,
+                            level.map, level.attr_map, level.width);
+        return;
+    }
+    /* The cache column is also the ring column; only streaming fills it.
+     * first_col++ wraps from 255 to 0 and the generated column goes on. */
+    for (; count; count--, first_col++) {
+        slot  = SLOT(first_col);
+        gcol  = _gen_col(first_col);
+        _head = gcol;
+        if (_cached[slot] != gcol) {
+            _make_column(gcol, &level_gen_map[slot], &_gen_attr[slot],
+                         LEVEL_GEN_COLS);
+            _cached[slot] = gcol;
+        }
+        vram_set_bkg_submap(_tiles, slot, 0U, 1U, level.height,
+                            level_gen_map, _gen_attr, LEVEL_GEN_COLS);
+    }
+}
+
+uint8_t level_tile(uint8_t col, uint8_t row)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+    uint8_t t;
+
+    if (row >= level.height) return 0U;
+    if (level.gen) {
+        return _gen_cell(col, row);
+    }
+    if (col >= level.width) return 0U;
+    SWITCH_ROM(level_bank);
+    t = level.map[(uint16_t)row * level.width + col];
+    SWITCH_ROM(saved_bank);
+    return t;
+}
+
+uint8_t level_is_solid(uint8_t tile)
+{
+    return IN_SET(_solid, tile) ? 1U : 0U;
+}
+
+uint8_t level_is_ground(uint8_t tile)
+{
+    return IN_SET(_ground, tile) ? 1U : 0U;
+}
+
+/* level_box_solid() for a generated level: the same cells as
+ * sprite_manager_tile_collision(), read through _gen_cell() (no right
+ * edge; columns wrap with the world X) */
+static uint8_t _gen_box_solid(const Sprite *s, uint16_t world_x16)
+{
+    uint16_t ax16, col, end;
+    uint8_t  ay, aw, ah, r, r_end;
+
+    if (!s || !s->active) return 0U;
+    ax16 = world_x16 + (uint16_t)s->hitbox_x;
+    ay   = (uint8_t)(s->world_y + s->hitbox_y);
+    aw   = s->hitbox_w ? s->hitbox_w : s->width;
+    ah   = s->hitbox_h ? s->hitbox_h : s->height;
+
+    col   = (uint16_t)(ax16 >> 3);
+    end   = (uint16_t)((ax16 + aw - 1U) >> 3);
+    r_end = (uint8_t)((ay + ah - 1U) >> 3);
+    if (r_end >= level.height) r_end = (uint8_t)(level.height - 1U);
+
+    for (; col <= end; col++) {
+        for (r = (uint8_t)(ay >> 3); r <= r_end; r++) {
+            if (IN_SET(_solid, _gen_cell((uint8_t)col, r))) {
+                return 1U;
+            }
+        }
+    }
+    return 0U;
+}
+
+uint8_t level_box_solid(const Sprite *s, uint16_t world_x16)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+    uint8_t hit;
+
+    if (level.gen) return _gen_box_solid(s, world_x16);
+    SWITCH_ROM(level_bank);
+    hit = sprite_manager_tile_collision(s, world_x16, level.map, level.width,
+                                        level.height, level.solid,
+                                        level.solid_count);
+    SWITCH_ROM(saved_bank);
+    return hit;
+}
+
+uint8_t level_ground_span(uint16_t x0, uint16_t x1, uint8_t row)
+{
+    uint8_t        saved_bank = CURRENT_BANK;
+    uint16_t       col = x0 >> 3;
+    uint16_t       end = x1 >> 3;
+    const uint8_t *p;
+    uint8_t        found = 0U;
+
+    if (row >= level.height) return 0U;
+    if (level.gen) {
+        for (; col <= end; col++) {
+            if (IN_SET(_ground, _gen_cell((uint8_t)col, row))) {
+                return 1U;
+            }
+        }
+        return 0U;
+    }
+    if (col >= level.width) return 0U;
+    if (end >= level.width) end = (uint16_t)(level.width - 1U);
+
+    SWITCH_ROM(level_bank);
+    p = &level.map[(uint16_t)row * level.width + col];
+    for (; col <= end; col++, p++) {
+        if (IN_SET(_ground, *p)) {
+            found = 1U;
+            break;
+        }
+    }
+    SWITCH_ROM(saved_bank);
+    return found;
+}
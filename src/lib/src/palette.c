@@ -0,0 +1,386 @@
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "palette.h"
+
+#define PAL_SLOTS        16U
+#define PAL_COLORS       (PAL_SLOTS * 4U)
+#define PAL_NONE         0xFFU
+
+/* -----------------------------------------------------------------------
+ * Channel lookup tables
+ *
+ * fade_*_lut[level][v] : 5-bit channel v faded level/8 of the way towards
+ *                        0 (black) or 31 (white), rounded to nearest.
+ * g_lo / g_hi / b_hi   : a 5-bit channel placed at its RGB555 bit position
+ *                        in the low / high byte of a palette_color_t.
+ *                        (R occupies bits 0-4 of the low byte unchanged.)
+ * -------------------------------------------------------------------- */
+static const uint8_t fade_black_lut[PAL_FADE_STEPS + 1U][32] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 },
+    {  0,  1,  2,  3,  4,  4,  5,  6,  7,  8,  9, 10, 11, 11, 12, 13,
+      14, 15, 16, 17, 18, 18, 19, 20, 21, 22, 23, 24, 25, 25, 26, 27 },
+    {  0,  1,  2,  2,  3,  4,  5,  5,  6,  7,  8,  8,  9, 10, 11, 11,
+      12, 13, 14, 14, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 23, 23 },
+    {  0,  1,  1,  2,  3,  3,  4,  4,  5,  6,  6,  7,  8,  8,  9,  9,
+      10, 11, 11, 12, 13, 13, 14, 14, 15, 16, 16, 17, 18, 18, 19, 19 },
+    {  0,  1,  1,  2,  2,  3,  3,  4,  4,  5,  5,  6,  6,  7,  7,  8,
+       8,  9,  9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16 },
+    {  0,  0,  1,  1,  2,  2,  2,  3,  3,  3,  4,  4,  5,  5,  5,  6,
+       6,  6,  7,  7,  8,  8,  8,  9,  9,  9, 10, 10, 11, 11, 11, 12 },
+    {  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3,  4,  4,
+       4,  4,  5,  5,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7,  8,  8 },
+    {  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  2,  2,  2,  2,
+       2,  2,  2,  2,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  4,  4 },
+    {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+};
+
+static const uint8_t fade_white_lut[PAL_FADE_STEPS + 1U][32] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 },
+    {  4,  5,  6,  7,  7,  8,  9, 10, 11, 12, 13, 14, 14, 15, 16, 17,
+      18, 19, 20, 21, 21, 22, 23, 24, 25, 26, 27, 28, 28, 29, 30, 31 },
+    {  8,  9,  9, 10, 11, 12, 12, 13, 14, 15, 15, 16, 17, 18, 18, 19,
+      20, 21, 21, 22, 23, 24, 24, 25, 26, 27, 27, 28, 29, 30, 30, 31 },
+    { 12, 12, 13, 14, 14, 15, 15, 16, 17, 17, 18, 19, 19, 20, 20, 21,
+      22, 22, 23, 24, 24, 25, 25, 26, 27, 27, 28, 29, 29, 30, 30, 31 },
+    { 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23,
+      24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31 },
+    { 19, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24, 25, 25,
+      25, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 30, 30, 30, 31, 31 },
+    { 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27,
+      27, 28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31 },
+    { 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29,
+      29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31 },
+    { 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+      31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31 }
+};
+
+static const uint8_t g_lo[32] = {
+    0x00U, 0x20U, 0x40U, 0x60U, 0x80U, 0xA0U, 0xC0U, 0xE0U,
+    0x00U, 0x20U, 0x40U, 0x60U, 0x80U, 0xA0U, 0xC0U, 0xE0U,
+    0x00U, 0x20U, 0x40U, 0x60U, 0x80U, 0xA0U, 0xC0U, 0xE0U,
+    0x00U, 0x20U, 0x40U, 0x60U, 0x80U, 0xA0U, 0xC0U, 0xE0U
+};
+
+static const uint8_t g_hi[32] = {
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+    0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U, 0x02U,
+    0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U, 0x03U
+};
+
+static const uint8_t b_hi[32] = {
+    0x00U, 0x04U, 0x08U, 0x0CU, 0x10U, 0x14U, 0x18U, 0x1CU,
+    0x20U, 0x24U, 0x28U, 0x2CU, 0x30U, 0x34U, 0x38U, 0x3CU,
+    0x40U, 0x44U, 0x48U, 0x4CU, 0x50U, 0x54U, 0x58U, 0x5CU,
+    0x60U, 0x64U, 0x68U, 0x6CU, 0x70U, 0x74U, 0x78U, 0x7CU
+};
+
+/* -----------------------------------------------------------------------
+ * Shadow state
+ * -------------------------------------------------------------------- */
+typedef struct {
+    uint8_t slot;      /* palette slot, PAL_NONE = unused */
+    uint8_t first;     /* first colour index rotated      */
+    uint8_t count;     /* colours in the rotation         */
+    uint8_t period;    /* vblanks per rotation step       */
+    uint8_t timer;
+} PalCycle;
+
+typedef struct {
+    uint8_t slot;      /* palette slot, PAL_NONE = unused */
+    uint8_t period;    /* vblanks per on/off toggle       */
+    uint8_t timer;
+    uint8_t remaining; /* vblanks left                    */
+    uint8_t on;        /* 1 = showing the solid colour    */
+    uint8_t r, g, b;   /* solid colour channels           */
+} PalFlash;
+
+static uint8_t          _src_r[PAL_COLORS];   /* source colour channels    */
+static uint8_t          _src_g[PAL_COLORS];
+static uint8_t          _src_b[PAL_COLORS];
+static palette_color_t  _out[PAL_COLORS];     /* visible (faded) colours   */
+static uint8_t          _dirty_bkg;           /* 1 bit per BG palette      */
+static uint8_t          _dirty_obj;           /* 1 bit per OBJ palette     */
+
+static const uint8_t   *_lut;                 /* active fade table row     */
+static uint8_t          _fade_colour;
+static uint8_t          _fade_level;
+static uint8_t          _fade_target;
+static uint8_t          _fade_speed;
+static uint8_t          _fade_timer;
+
+static PalCycle         _cycles[PAL_CYCLE_MAX];
+static PalFlash         _flashes[PAL_FLASH_MAX];
+
+static void _select_lut(void)
+{
+    _lut = (_fade_colour == PAL_FADE_WHITE) ? fade_white_lut[_fade_level]
+                                            : fade_black_lut[_fade_level];
+}
+
+/* -----------------------------------------------------------------------
+ * _build
+ * Recompute the visible colours of one palette slot and flag it for the
+ * next commit only if at least one colour actually changed.
+ * -------------------------------------------------------------------- */
+static void _build(uint8_t slot)
+{
+    const PalFlash *fl = NULL;
+    uint8_t  i, idx, r, g, b, changed = 0U;
+    palette_color_t col;
+
+    for (i = 0U; i < PAL_FLASH_MAX; i++) {
+        if (_flashes[i].slot == slot && _flashes[i].on) {
+            fl = &_flashes[i];
+            break;
+        }
+    }
+
+    idx = (uint8_t)(slot << 2);
+    for (i = 0U; i < 4U; i++, idx++) {
+        if (fl) {
+            r = _lut[fl->r]; g = _lut[fl->g]; b = _lut[fl->b];
+        } else {
+            r = _lut[_src_r[idx]]; g = _lut[_src_g[idx]]; b = _lut[_src_b[idx]];
+        }
+        col = (palette_color_t)((uint8_t)(r | g_lo[g]) |
+                                ((uint16_t)(uint8_t)(g_hi[g] | b_hi[b]) << 8));
+        if (col != _out[idx]) {
+            _out[idx] = col;
+            changed = 1U;
+        }
+    }
+
+    if (changed) {
+        if (slot < 8U) _dirty_bkg |= (uint8_t)(1U << slot);
+        else           _dirty_obj |= (uint8_t)(1U << (slot - 8U));
+    }
+}
+
+static void _build_all(void)
+{
+    uint8_t s;
+    for (s = 0U; s < PAL_SLOTS; s++) _build(s);
+}
+
+static void _split(palette_color_t c, uint8_t *r, uint8_t *g, uint8_t *b)
+{
+    *r = (uint8_t)(c & 0x1FU);
+    *g = (uint8_t)((c >> 5) & 0x1FU);
+    *b = (uint8_t)((c >> 10) & 0x1FU);
+}
+
+static void _load(uint8_t slot, uint8_t nb, const palette_color_t *data)
+{
+    uint8_t i, idx;
+    for (; nb && slot < PAL_SLOTS; nb--, slot++) {
+        idx = (uint8_t)(slot << 2);
+        for (i = 0U; i < 4U; i++, idx++, data++) {
+            _split(*data, &_src_r[idx], &_src_g[idx], &_src_b[idx]);
+        }
+        _build(slot);
+    }
+}
+
+void palette_init(void)
+{
+    uint8_t i;
+    for (i = 0U; i < PAL_COLORS; i++) {
+        _src_r[i] = 0U; _src_g[i] = 0U; _src_b[i] = 0U;
+        _out[i]   = 0U;
+    }
+    for (i = 0U; i < PAL_CYCLE_MAX; i++) _cycles[i].slot  = PAL_NONE;
+    for (i = 0U; i < PAL_FLASH_MAX; i++) _flashes[i].slot = PAL_NONE;
+    _fade_colour = PAL_FADE_BLACK;
+    _fade_level  = 0U;
+    _fade_target = 0U;
+    _fade_speed  = 0U;
+    _fade_timer  = 0U;
+    _select_lut();
+    /* Force a full upload on the first commit */
+    _dirty_bkg = 0xFFU;
+    _dirty_obj = 0xFFU;
+}
+
+void palette_set_bkg(uint8_t first, uint8_t nb, const palette_color_t *data)
+{
+    if (first < 8U) _load(PAL_BKG(first), nb, data);
+}
+
+void palette_set_sprite(uint8_t first, uint8_t nb, const palette_color_t *data)
+{
+    if (first < 8U) _load(PAL_OBJ(first), nb, data);
+}
+
+void palette_fade_out(uint8_t colour, uint8_t speed)
+{
+    if (colour != _fade_colour) {
+        /* Switching colour mid-fade restarts from the source colours */
+        _fade_colour = colour;
+        _fade_level  = 0U;
+        _select_lut();
+        _build_all();
+    }
+    _fade_target = PAL_FADE_STEPS;
+    _fade_speed  = speed ? speed : 1U;
+    _fade_timer  = 0U;
+}
+
+void palette_fade_in(uint8_t speed)
+{
+    _fade_target = 0U;
+    _fade_speed  = speed ? speed : 1U;
+    _fade_timer  = 0U;
+}
+
+void palette_fade_set(uint8_t colour, uint8_t level)
+{
+    if (level > PAL_FADE_STEPS) level = PAL_FADE_STEPS;
+    _fade_colour = colour;
+    _fade_level  = level;
+    _fade_target = level;
+    _select_lut();
+    _build_all();
+}
+
+uint8_t palette_fade_busy(void)
+{
+    return (_fade_level != _fade_target) ? 1U : 0U;
+}
+
+void palette_fade_wait(void)
+{
+    while (_fade_level != _fade_target) {
+        vsync();
+        palette_commit();
+        palette_update();
+    }
+    /* Make sure the final step reaches the hardware before returning */
+    vsync();
+    palette_commit();
+}
+
+uint8_t palette_cycle_start(uint8_t slot, uint8_t first, uint8_t count,
+                            uint8_t period)
+{
+    uint8_t i;
+    if (slot >= PAL_SLOTS || count < 2U || (uint8_t)(first + count) > 4U)
+        return PAL_NONE;
+    for (i = 0U; i < PAL_CYCLE_MAX; i++) {
+        if (_cycles[i].slot == PAL_NONE) {
+            _cycles[i].slot   = slot;
+            _cycles[i].first  = first;
+            _cycles[i].count  = count;
+            _cycles[i].period = period ? period : 1U;
+            _cycles[i].timer  = 0U;
+            return i;
+        }
+    }
+    return PAL_NONE;
+}
+
+void palette_cycle_stop(uint8_t handle)
+{
+    if (handle < PAL_CYCLE_MAX) _cycles[handle].slot = PAL_NONE;
+}
+
+void palette_flash(uint8_t slot, palette_color_t colour,
+                   uint8_t period, uint8_t duration)
+{
+    uint8_t i, free_i = PAL_NONE;
+    if (slot >= PAL_SLOTS) return;
+    for (i = 0U; i < PAL_FLASH_MAX; i++) {
+        if (_flashes[i].slot == slot) { free_i = i; break; }
+        if (_flashes[i].slot == PAL_NONE && free_i == PAL_NONE) free_i = i;
+    }
+    if (free_i == PAL_NONE) return;
+
+    _flashes[free_i].slot      = slot;
+    _flashes[free_i].period    = period ? period : 1U;
+    _flashes[free_i].timer     = 0U;
+    _flashes[free_i].remaining = duration;
+    _flashes[free_i].on        = 1U;
+    _split(colour, &_flashes[free_i].r, &_flashes[free_i].g, &_flashes[free_i].b);
+    _build(slot);
+}
+
+/* Rotate one colour range of a slot by a single step (last -> first) */
+static void _rotate(const PalCycle *c)
+{
+    uint8_t lo = (uint8_t)((c->slot << 2) + c->first);
+    uint8_t hi = (uint8_t)(lo + c->count - 1U);
+    uint8_t i, r = _src_r[hi], g = _src_g[hi], b = _src_b[hi];
+    for (i = hi; i != lo; i--) {
+        _src_r[i] = _src_r[i - 1U];
+        _src_g[i] = _src_g[i - 1U];
+        _src_b[i] = _src_b[i - 1U];
+    }
+    _src_r[lo] = r; _src_g[lo] = g; _src_b[lo] = b;
+}
+
+void palette_update(void)
+{
+    uint8_t i;
+    PalCycle *c;
+    PalFlash *f;
+
+    /* --- Fade: one level per _fade_speed vblanks --- */
+    if (_fade_level != _fade_target) {
+        if (++_fade_timer >= _fade_speed) {
+            _fade_timer = 0U;
+            if (_fade_level < _fade_target) _fade_level++;
+            else                            _fade_level--;
+            _select_lut();
+            _build_all();
+        }
+    }
+
+    /* --- Colour cycles --- */
+    for (i = 0U, c = _cycles; i < PAL_CYCLE_MAX; i++, c++) {
+        if (c->slot == PAL_NONE) continue;
+        if (++c->timer >= c->period) {
+            c->timer = 0U;
+            _rotate(c);
+            _build(c->slot);
+        }
+    }
+
+    /* --- Flashes --- */
+    for (i = 0U, f = _flashes; i < PAL_FLASH_MAX; i++, f++) {
+        if (f->slot == PAL_NONE) continue;
+        if (f->remaining == 0U) {
+            uint8_t slot = f->slot;
+            f->slot = PAL_NONE;
+            _build(slot);
+            continue;
+        }
+        f->remaining--;
+        if (++f->timer >= f->period) {
+            f->timer = 0U;
+            f->on ^= 1U;
+            _build(f->slot);
+        }
+    }
+}
+
+void palette_commit(void)
+{
+    uint8_t i, m;
+    if (_dirty_bkg) {
+        for (i = 0U, m = 1U; i < 8U; i++, m <<= 1) {
+            if (_dirty_bkg & m) set_bkg_palette(i, 1U, &_out[(uint8_t)(i << 2)]);
+        }
+        _dirty_bkg = 0U;
+    }
+    if (_dirty_obj) {
+        for (i = 0U, m = 1U; i < 8U; i++, m <<= 1) {
+            if (_dirty_obj & m) set_sprite_palette(i, 1U, &_out[(uint8_t)((i + 8U) << 2)]);
+        }
+        _dirty_obj = 0U;
+    }
+}
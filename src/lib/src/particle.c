@@ -0,0 +1,163 @@
+#include <gb/gb.h>
+#include <stdint.h>
+#include "particle.h"
+
+#define BANDS  20U   /* 8-line bands covering screen Y 0..159 */
+
+static uint16_t _x[PART_MAX];      /* 12.4 world X       */
+static uint16_t _y[PART_MAX];      /* 12.4 world Y       */
+static int8_t   _vx[PART_MAX];
+static int8_t   _vy[PART_MAX];
+static int8_t   _ay[PART_MAX];
+static uint8_t  _life[PART_MAX];   /* 0 = free / expired */
+static uint8_t  _cap;
+static uint8_t  _tail;             /* oldest particle    */
+static uint8_t  _count;
+static uint8_t  _first_obj;
+static uint8_t  _tile_base;
+static uint16_t _rng = 0xACE1U;
+
+/* xorshift16: cosmetic only, but seeded by particle_seed() so a replay
+ * throws the same particles */
+static uint8_t rnd(void)
+{
+    _rng ^= (uint16_t)(_rng << 7);
+    _rng ^= (uint16_t)(_rng >> 9);
+    _rng ^= (uint16_t)(_rng << 8);
+    return (uint8_t)_rng;
+}
+
+static int8_t spread(uint8_t s)
+{
+    return s ? (int8_t)((int16_t)(rnd() % (uint8_t)(s * 2U + 1U)) - s) : 0;
+}
+
+void particle_init(uint8_t first_obj, uint8_t obj_count, uint8_t prop,
+                   uint8_t tile_base)
+{
+    uint8_t i;
+
+    _first_obj = first_obj;
+    _tile_base = tile_base;
+    _cap       = (obj_count > PART_MAX) ? PART_MAX : obj_count;
+    for (i = 0; i < _cap; i++) {
+        set_sprite_prop((uint8_t)(first_obj + i), prop);
+    }
+    particle_clear();
+}
+
+void particle_seed(uint16_t seed)
+{
+    _rng = seed ? seed : 0xACE1U;   /* xorshift never leaves 0 */
+}
+
+void particle_clear(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < _cap; i++) {
+        _life[i] = 0U;
+        move_sprite((uint8_t)(_first_obj + i), 0U, 0U);
+    }
+    _tail  = 0U;
+    _count = 0U;
+}
+
+void particle_emit(const ParticleKind *kind, uint16_t x, uint8_t y,
+                   uint8_t count)
+{
+    uint8_t i;
+
+    if (!_cap || !kind->life) return;
+    if (count > _cap) count = _cap;
+    for (; count; count--) {
+        if (_count == _cap) {
+            /* Full: the oldest particle makes room */
+            if (++_tail >= _cap) _tail = 0U;
+            _count--;
+        }
+        i = (uint8_t)(_tail + _count);
+        if (i >= _cap) i = (uint8_t)(i - _cap);
+        _count++;
+
+        _x[i]    = (uint16_t)(x << 4);
+        _y[i]    = (uint16_t)((uint16_t)y << 4);
+        _vx[i]   = spread(kind->spread_x);
+        _vy[i]   = (int8_t)(kind->vy_bias + spread(kind->spread_y));
+        _ay[i]   = kind->gravity;
+        _life[i] = kind->life;
+        set_sprite_tile((uint8_t)(_first_obj + i), (uint8_t)(_tile_base + kind->tile));
+    }
+}
+
+void particle_update(uint16_t camera_x)
+{
+    uint8_t  band[BANDS];
+    uint8_t  n, i, b0, b1, sy;
+    uint16_t sx;
+
+    for (n = 0; n < BANDS; n++) band[n] = 0U;
+
+    /* Newest first, so the scanline budget culls the oldest */
+    i = (uint8_t)(_tail + _count);
+    for (n = _count; n; n--) {
+        i = i ? (uint8_t)(i - 1U) : (uint8_t)(_cap - 1U);
+        if (i >= _cap) i = (uint8_t)(i - _cap);
+        if (!_life[i]) continue;
+        if (--_life[i] == 0U) {
+            move_sprite((uint8_t)(_first_obj + i), 0U, 0U);
+            continue;
+        }
+        _vy[i] = (int8_t)(_vy[i] + _ay[i]);
+        _x[i]  = (uint16_t)(_x[i] + _vx[i]);
+        _y[i]  = (uint16_t)(_y[i] + _vy[i]);
+
+        /* Off camera (or fallen below the screen): expire */
+        sx = (uint16_t)((_x[i] >> 4) - camera_x + 8U);
+        if (sx > 176U || _y[i] >= (144U << 4)) {
+            _life[i] = 0U;
+            move_sprite((uint8_t)(_first_obj + i), 0U, 0U);
+            continue;
+        }
+
+        /* An 8x16 OBJ covers lines sy..sy+15 */
+        sy = (uint8_t)(_y[i] >> 4);
+        b0 = (uint8_t)(sy >> 3);
+        b1 = (uint8_t)((uint8_t)(sy + 15U) >> 3);
+        if (band[b0] >= PART_LINE_MAX || band[b0 + 1U] >= PART_LINE_MAX ||
+            band[b1] >= PART_LINE_MAX) {
+            move_sprite((uint8_t)(_first_obj + i), 0U, 0U);
+            continue;
+        }
+        band[b0]++;
+        if (b1 != b0) band[b0 + 1U]++;
+        if (b1 != (uint8_t)(b0 + 1U)) band[b1]++;
+        move_sprite((uint8_t)(_first_obj + i), (uint8_t)sx, (uint8_t)(sy + 16U));
+    }
+
+    /* Release expired particles at the old end of the ring */
+    while (_count && !_life[_tail]) {
+        if (++_tail >= _cap) _tail = 0U;
+        _count--;
+    }
+}
+
+void particle_shift_x(uint16_t dx)
+{
+    uint8_t i;
+
+    for (i = 0; i < _cap; i++) {
+        if (!_life[i]) continue;
+        if ((_x[i] >> 4) < dx) {
+            _life[i] = 0U;
+            move_sprite((uint8_t)(_first_obj + i), 0U, 0U);
+        } else {
+            _x[i] = (uint16_t)(_x[i] - (dx << 4));
+        }
+    }
+}
+
+uint8_t particle_count(void)
+{
+    return _count;
+}
@@ -0,0 +1,67 @@
+#include <gb/gb.h>
+#include <stdint.h>
+#include "pb16.h"
+
+#define CHUNK_TILES  4U   /* tiles decoded per VRAM copy */
+
+/* The two most recent output bytes: a repeat copies _back2 */
+static uint8_t _back2;
+static uint8_t _back1;
+
+/* Decode packets of 8 bytes into dst, continuing the current stream */
+static const uint8_t *unpack_packets(uint8_t *dst, const uint8_t *src,
+                                     uint16_t packets)
+{
+    uint8_t ctrl, n, v;
+    uint8_t b2 = _back2, b1 = _back1;
+
+    for (; packets; packets--) {
+        ctrl = *src++;
+        for (n = 8U; n; n--) {
+            v = (ctrl & 0x80U) ? b2 : *src++;
+            *dst++ = v;
+            b2 = b1;
+            b1 = v;
+            ctrl <<= 1;
+        }
+    }
+    _back2 = b2;
+    _back1 = b1;
+    return src;
+}
+
+const uint8_t *pb16_unpack(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    _back2 = _back1 = 0U;
+    return unpack_packets(dst, src, len >> 3);
+}
+
+void pb16_set_bkg_data(uint8_t first, uint8_t nb, const uint8_t *src)
+{
+    uint8_t buf[CHUNK_TILES * 16U];
+    uint8_t n;
+
+    _back2 = _back1 = 0U;
+    while (nb) {
+        n = (nb < CHUNK_TILES) ? nb : CHUNK_TILES;
+        src = unpack_packets(buf, src, (uint16_t)n * 2U);
+        set_bkg_data(first, n, buf);
+        first += n;
+        nb -= n;
+    }
+}
+
+void pb16_set_sprite_data(uint8_t first, uint8_t nb, const uint8_t *src)
+{
+    uint8_t buf[CHUNK_TILES * 16U];
+    uint8_t n;
+
+    _back2 = _back1 = 0U;
+    while (nb) {
+        n = (nb < CHUNK_TILES) ? nb : CHUNK_TILES;
+        src = unpack_packets(buf, src, (uint16_t)n * 2U);
+        set_sprite_data(first, n, buf);
+        first += n;
+        nb -= n;
+    }
+}
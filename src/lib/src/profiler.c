@@ -0,0 +1,168 @@
+#include <gb/gb.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef DEBUG
+#include <gbdk/emu_debug.h>
+#endif
+#include "profiler.h"
+
+#ifdef PROFILE
+
+#define LINES_PER_FRAME  154U
+#define VBLANK_LINE      144U   /* sys_time ticks when LY reaches this line */
+
+static const char * const *_names;
+static uint8_t  _count;
+
+/* Per-frame accumulation (a phase may be entered several times a frame) */
+static uint8_t  _start_frame[PROFILER_MAX_PHASES];
+static uint8_t  _start_line[PROFILER_MAX_PHASES];
+static uint16_t _frame_lines[PROFILER_MAX_PHASES];
+static uint8_t  _ran_mask;
+
+/* Per-window accumulation */
+static uint8_t  _win_min[PROFILER_MAX_PHASES];
+static uint8_t  _win_max[PROFILER_MAX_PHASES];
+static uint16_t _win_sum[PROFILER_MAX_PHASES];
+static uint8_t  _win_n[PROFILER_MAX_PHASES];
+static uint8_t  _win_frames;
+static uint8_t  _win_lag;
+static uint8_t  _last_vbl;
+
+/* Last completed window */
+static ProfilerStat _stat[PROFILER_MAX_PHASES];
+static uint8_t  _stat_lag;
+static uint8_t  _ready;
+
+/* Current time as (VBlank count, scanlines since VBlank started).  Reads
+ * sys_time on both sides of LY so a VBlank interrupt in between cannot
+ * pair a new line with an old frame number. */
+static uint8_t _now(uint8_t *frame)
+{
+    uint8_t f, ly;
+    do {
+        f  = (uint8_t)sys_time;
+        ly = LY_REG;
+    } while (f != (uint8_t)sys_time);
+    *frame = f;
+    return (ly >= VBLANK_LINE) ? (uint8_t)(ly - VBLANK_LINE)
+                               : (uint8_t)(ly + (LINES_PER_FRAME - VBLANK_LINE));
+}
+
+static void _reset_window(void)
+{
+    uint8_t i;
+    for (i = 0; i < PROFILER_MAX_PHASES; i++) {
+        _win_min[i] = 0xFFU;
+        _win_max[i] = 0U;
+        _win_sum[i] = 0U;
+        _win_n[i]   = 0U;
+    }
+    _win_frames = 0U;
+    _win_lag    = 0U;
+}
+
+void profiler_init(const char * const *names, uint8_t count)
+{
+    uint8_t i;
+    _names = names;
+    _count = (count > PROFILER_MAX_PHASES) ? PROFILER_MAX_PHASES : count;
+    for (i = 0; i < PROFILER_MAX_PHASES; i++) {
+        _frame_lines[i] = 0U;
+        _stat[i].min = 0U;
+        _stat[i].avg = 0U;
+        _stat[i].max = 0U;
+    }
+    _ran_mask = 0U;
+    _stat_lag = 0U;
+    _ready    = 0U;
+    _last_vbl = (uint8_t)sys_time;
+    _reset_window();
+}
+
+void profiler_begin(uint8_t phase)
+{
+    _start_line[phase] = _now(&_start_frame[phase]);
+}
+
+void profiler_end(uint8_t phase)
+{
+    uint8_t frame;
+    uint8_t line   = _now(&frame);
+    uint8_t frames = (uint8_t)(frame - _start_frame[phase]);
+
+    _frame_lines[phase] += (uint16_t)((uint16_t)frames * LINES_PER_FRAME
+                                      + line - _start_line[phase]);
+    _ran_mask |= (uint8_t)(1U << phase);
+}
+
+void profiler_frame(void)
+{
+    uint8_t i, sample;
+    uint8_t now = (uint8_t)sys_time;
+
+    /* More than one VBlank since the last frame: logic overran */
+    if ((uint8_t)(now - _last_vbl) > 1U) {
+        _win_lag++;
+    }
+    _last_vbl = now;
+
+    /* Fold this frame's per-phase totals into the window */
+    for (i = 0; i < _count; i++) {
+        if (!(_ran_mask & (uint8_t)(1U << i))) continue;
+        sample = (_frame_lines[i] > 0xFFU) ? 0xFFU : (uint8_t)_frame_lines[i];
+        if (sample < _win_min[i]) _win_min[i] = sample;
+        if (sample > _win_max[i]) _win_max[i] = sample;
+        _win_sum[i] += sample;
+        _win_n[i]++;
+        _frame_lines[i] = 0U;
+    }
+    _ran_mask = 0U;
+
+    if (++_win_frames < PROFILER_WINDOW) return;
+
+    /* Window complete: publish results */
+    for (i = 0; i < _count; i++) {
+        if (_win_n[i]) {
+            _stat[i].min = _win_min[i];
+            _stat[i].avg = (uint8_t)(_win_sum[i] / _win_n[i]);
+            _stat[i].max = _win_max[i];
+        } else {
+            _stat[i].min = 0U;
+            _stat[i].avg = 0U;
+            _stat[i].max = 0U;
+        }
+#ifdef DEBUG
+        EMU_printf("prof %s: min %u avg %u max %u lines\n",
+                   (_names && _names[i]) ? _names[i] : "?",
+                   (uint16_t)_stat[i].min, (uint16_t)_stat[i].avg,
+                   (uint16_t)_stat[i].max);
+#endif
+    }
+    _stat_lag = _win_lag;
+#ifdef DEBUG
+    EMU_printf("prof lag frames: %u / %u\n",
+               (uint16_t)_stat_lag, (uint16_t)PROFILER_WINDOW);
+#endif
+    _ready = 1U;
+    _reset_window();
+}
+
+uint8_t profiler_window_ready(void)
+{
+    uint8_t r = _ready;
+    _ready = 0U;
+    return r;
+}
+
+const ProfilerStat* profiler_stat(uint8_t phase)
+{
+    return &_stat[phase];
+}
+
+uint8_t profiler_lag_frames(void)
+{
+    return _stat_lag;
+}
+
+#endif
@@ -0,0 +1,214 @@
+#include <gb/gb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "projectile.h"
+
+/* Live projectiles occupy indices 0 .. _count-1 */
+static uint16_t _x[PROJ_MAX];
+static uint8_t  _y[PROJ_MAX];
+static int8_t   _vx[PROJ_MAX];
+static int8_t   _vy[PROJ_MAX];
+static uint8_t  _life[PROJ_MAX];
+static uint8_t  _tile[PROJ_MAX];
+static uint8_t  _prop[PROJ_MAX];
+static uint8_t  _owner[PROJ_MAX];
+static uint8_t  _oam_x[PROJ_MAX];   /* screen X + 8, set by update */
+static uint8_t  _count;
+static uint8_t  _shown;             /* OBJ slots written last draw  */
+static uint8_t  _first_obj;
+static uint8_t  _palette;
+
+/* Collision map (in ROM bank _map_bank) and solid tile IDs as a
+ * 256-bit set */
+static const uint8_t *_map;
+static uint8_t        _map_bank;
+static uint8_t        _map_w;
+static uint8_t        _map_h;
+static ProjTileFn     _tile_at;      /* instead of _map, or NULL   */
+static uint8_t        _solid[32];
+
+/* Remove projectile i by moving the last live one into its place */
+static void kill(uint8_t i)
+{
+    uint8_t last = --_count;
+
+    _x[i]     = _x[last];
+    _y[i]     = _y[last];
+    _vx[i]    = _vx[last];
+    _vy[i]    = _vy[last];
+    _life[i]  = _life[last];
+    _tile[i]  = _tile[last];
+    _prop[i]  = _prop[last];
+    _owner[i] = _owner[last];
+    _oam_x[i] = _oam_x[last];
+}
+
+void projectile_init(uint8_t first_obj, uint8_t palette)
+{
+    _first_obj = first_obj;
+    _palette   = palette;
+    _map       = NULL;
+    _tile_at   = NULL;
+    _shown     = PROJ_MAX;
+    projectile_clear();
+}
+
+void projectile_set_map(uint8_t bank, const uint8_t *tilemap,
+                        uint8_t map_w, uint8_t map_h,
+                        const uint8_t *solid, uint8_t solid_count)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+    uint8_t i;
+
+    _map      = tilemap;
+    _tile_at  = NULL;
+    _map_bank = bank;
+    _map_w    = map_w;
+    _map_h    = map_h;
+    SWITCH_ROM(bank);
+    for (i = 0; i < 32U; i++) _solid[i] = 0U;
+    for (i = 0; i < solid_count; i++) {
+        _solid[solid[i] >> 3] |= (uint8_t)(1U << (solid[i] & 7U));
+    }
+    SWITCH_ROM(saved_bank);
+}
+
+void projectile_set_map_reader(ProjTileFn tile_at, uint8_t bank,
+                               uint8_t map_w, uint8_t map_h,
+                               const uint8_t *solid, uint8_t solid_count)
+{
+    projectile_set_map(bank, NULL, map_w, map_h, solid, solid_count);
+    _tile_at = tile_at;
+}
+
+uint8_t projectile_spawn(uint16_t x, uint8_t y, int8_t vx, int8_t vy,
+                         uint8_t life, uint8_t tile, uint8_t owner)
+{
+    uint8_t i = _count;
+
+    if (i >= PROJ_MAX || life == 0U) return PROJ_NONE;
+    _x[i]     = x;
+    _y[i]     = y;
+    _vx[i]    = vx;
+    _vy[i]    = vy;
+    _life[i]  = life;
+    _tile[i]  = tile;
+    _prop[i]  = (uint8_t)(_palette | ((vx < 0) ? S_FLIPX : 0U));
+    _owner[i] = owner;
+    _oam_x[i] = 0U;
+    _count++;
+    return i;
+}
+
+void projectile_clear(void)
+{
+    _count = 0U;
+    projectile_draw();
+}
+
+void projectile_update(uint16_t camera_x)
+{
+    uint8_t  saved_bank = CURRENT_BANK;
+    uint8_t  i = 0U;
+    uint8_t  col, row, t;
+    uint16_t sx;
+
+    /* One bank switch for the whole batch of map reads */
+    if (_map && _count) SWITCH_ROM(_map_bank);
+    while (i < _count) {
+        if (--_life[i] == 0U) {
+            kill(i);
+            continue;
+        }
+        _x[i] = (uint16_t)(_x[i] + _vx[i]);
+        _y[i] = (uint8_t)(_y[i] + _vy[i]);
+
+        /* Off camera: -8 < screen X < 168, 0 <= Y < 144 (Y wraps up) */
+        sx = (uint16_t)(_x[i] - camera_x + 8U);
+        if (sx > 176U || _y[i] >= 144U) {
+            kill(i);
+            continue;
+        }
+
+        /* Centre of the graphic against the solid tile set */
+        if (_map || _tile_at) {
+            col = (uint8_t)((uint16_t)(_x[i] + 4U) >> 3);
+            row = (uint8_t)((uint8_t)(_y[i] + 4U) >> 3);
+            if ((!_map_w || col < _map_w) && row < _map_h) {
+                t = _tile_at ? _tile_at(col, row)
+                             : _map[(uint16_t)row * _map_w + col];
+                if (_solid[t >> 3] & (uint8_t)(1U << (t & 7U))) {
+                    kill(i);
+                    continue;
+                }
+            }
+        }
+        _oam_x[i] = (uint8_t)sx;
+        i++;
+    }
+    SWITCH_ROM(saved_bank);
+}
+
+void projectile_shift_x(uint16_t dx)
+{
+    uint8_t i = 0U;
+
+    while (i < _count) {
+        if (_x[i] < dx) {
+            kill(i);
+            continue;
+        }
+        _x[i] = (uint16_t)(_x[i] - dx);
+        i++;
+    }
+}
+
+uint8_t projectile_hit(const Sprite *s, uint8_t owner)
+{
+    int16_t x_lo, x_hi, y_lo, y_hi, px, py;
+    uint8_t i = 0U, hits = 0U;
+
+    if (!s || !s->active) return 0U;
+
+    /* Projectile box [p + HIT, p + HIT + SIZE) overlaps the sprite box
+     * [b, b + size) exactly when lo < p < hi.  X is in OAM space. */
+    x_lo = (int16_t)(s->world_x + s->hitbox_x + 8U) - (int16_t)(PROJ_HIT_X + PROJ_HIT_W);
+    x_hi = (int16_t)(s->world_x + s->hitbox_x + 8U
+                     + (s->hitbox_w ? s->hitbox_w : s->width)) - (int16_t)PROJ_HIT_X;
+    y_lo = (int16_t)(s->world_y + s->hitbox_y) - (int16_t)(PROJ_HIT_Y + PROJ_HIT_H);
+    y_hi = (int16_t)(s->world_y + s->hitbox_y
+                     + (s->hitbox_h ? s->hitbox_h : s->height)) - (int16_t)PROJ_HIT_Y;
+
+    while (i < _count) {
+        px = (int16_t)_oam_x[i];
+        py = (int16_t)_y[i];
+        if (_owner[i] == owner && px > x_lo && px < x_hi && py > y_lo && py < y_hi) {
+            kill(i);
+            hits++;
+            continue;
+        }
+        i++;
+    }
+    return hits;
+}
+
+void projectile_draw(void)
+{
+    uint8_t i, obj;
+
+    for (i = 0U; i < _count; i++) {
+        obj = (uint8_t)(_first_obj + i);
+        set_sprite_tile(obj, _tile[i]);
+        set_sprite_prop(obj, _prop[i]);
+        move_sprite(obj, _oam_x[i], (uint8_t)(_y[i] + 16U));
+    }
+    for (; i < _shown; i++) {
+        move_sprite((uint8_t)(_first_obj + i), 0U, 0U);
+    }
+    _shown = _count;
+}
+
+uint8_t projectile_count(void)
+{
+    return _count;
+}
@@ -0,0 +1,167 @@
+#include <gb/gb.h>
+#include <stdint.h>
+#include "replay.h"
+
+/* SRAM window (0xA000-0xBFFF).  The host shim maps it to its own array. */
+#ifndef SRAM_WINDOW
+#define SRAM_WINDOW ((uint8_t *)0xA000U)
+#endif
+
+/* Header layout (8 bytes), followed by (buttons, run) pairs */
+#define HDR_MAGIC0       0U
+#define HDR_MAGIC1       1U
+#define HDR_VERSION      2U
+#define HDR_SEED_LO      4U
+#define HDR_SEED_HI      5U
+#define HDR_PAIRS_LO     6U
+#define HDR_PAIRS_HI     7U
+#define HDR_SIZE         8U
+
+#define REPLAY_MAGIC0    'R'
+#define REPLAY_MAGIC1    'P'
+#define REPLAY_VERSION   1U
+#define REPLAY_MAX_PAIRS ((0x2000U - HDR_SIZE) / 2U)
+
+static uint8_t  _mode;
+static uint16_t _seed;
+static uint16_t _pairs;   /* pairs written (recording) / stored (playback) */
+static uint16_t _pos;     /* next pair to read (playback)                   */
+static uint8_t  _cur;     /* buttons of the current run                     */
+static uint8_t  _run;     /* samples in / left in the current run           */
+
+static uint8_t *_sram_open(void)
+{
+    ENABLE_RAM;
+    SWITCH_RAM(REPLAY_SRAM_BANK);
+    return SRAM_WINDOW;
+}
+
+/* Read and validate the header; returns the pair count or 0 */
+static uint16_t _stored_pairs(uint16_t *seed)
+{
+    uint8_t *s = _sram_open();
+    uint16_t pairs = 0U;
+
+    if (s[HDR_MAGIC0] == REPLAY_MAGIC0 && s[HDR_MAGIC1] == REPLAY_MAGIC1 &&
+        s[HDR_VERSION] == REPLAY_VERSION) {
+        pairs = (uint16_t)(s[HDR_PAIRS_LO] | ((uint16_t)s[HDR_PAIRS_HI] << 8));
+        if (pairs > REPLAY_MAX_PAIRS) pairs = 0U;
+        if (seed) {
+            *seed = (uint16_t)(s[HDR_SEED_LO] | ((uint16_t)s[HDR_SEED_HI] << 8));
+        }
+    }
+    DISABLE_RAM;
+    return pairs;
+}
+
+/* Append the pending run; stops recording when SRAM is full */
+static void _flush_run(void)
+{
+    uint8_t *s;
+
+    if (!_run) return;
+    if (_pairs >= REPLAY_MAX_PAIRS) {
+        _mode = REPLAY_IDLE;
+        return;
+    }
+    s = _sram_open();
+    s[HDR_SIZE + _pairs * 2U]      = _cur;
+    s[HDR_SIZE + _pairs * 2U + 1U] = _run;
+    _pairs++;
+    s[HDR_PAIRS_LO] = (uint8_t)_pairs;
+    s[HDR_PAIRS_HI] = (uint8_t)(_pairs >> 8);
+    DISABLE_RAM;
+    _run = 0U;
+}
+
+void replay_record_start(uint16_t seed)
+{
+    uint8_t *s = _sram_open();
+
+    s[HDR_MAGIC0]   = REPLAY_MAGIC0;
+    s[HDR_MAGIC1]   = REPLAY_MAGIC1;
+    s[HDR_VERSION]  = REPLAY_VERSION;
+    s[3]            = 0U;
+    s[HDR_SEED_LO]  = (uint8_t)seed;
+    s[HDR_SEED_HI]  = (uint8_t)(seed >> 8);
+    s[HDR_PAIRS_LO] = 0U;
+    s[HDR_PAIRS_HI] = 0U;
+    DISABLE_RAM;
+
+    _mode  = REPLAY_RECORDING;
+    _seed  = seed;
+    _pairs = 0U;
+    _run   = 0U;
+}
+
+uint8_t replay_play_start(void)
+{
+    uint16_t seed = 0U;
+    uint16_t pairs = _stored_pairs(&seed);
+
+    if (!pairs) return 0U;
+    _mode  = REPLAY_PLAYING;
+    _seed  = seed;
+    _pairs = pairs;
+    _pos   = 0U;
+    _run   = 0U;
+    return 1U;
+}
+
+void replay_stop(void)
+{
+    if (_mode == REPLAY_RECORDING) {
+        _flush_run();
+    }
+    _mode = REPLAY_IDLE;
+}
+
+uint8_t replay_input(uint8_t live)
+{
+    uint8_t *s;
+
+    if (_mode == REPLAY_RECORDING) {
+        if (_run && (live != _cur || _run == 0xFFU)) {
+            _flush_run();
+        }
+        if (_mode == REPLAY_RECORDING) {
+            _cur = live;
+            _run++;
+        }
+        return live;
+    }
+
+    if (_mode == REPLAY_PLAYING) {
+        if (!_run) {
+            if (_pos >= _pairs) {
+                _mode = REPLAY_IDLE;
+                return live;
+            }
+            s = _sram_open();
+            _cur = s[HDR_SIZE + _pos * 2U];
+            _run = s[HDR_SIZE + _pos * 2U + 1U];
+            DISABLE_RAM;
+            if (!_run) _run = 1U;   /* never written by the recorder */
+            _pos++;
+        }
+        _run--;
+        return _cur;
+    }
+
+    return live;
+}
+
+uint8_t replay_mode(void)
+{
+    return _mode;
+}
+
+uint16_t replay_seed(void)
+{
+    return _seed;
+}
+
+uint8_t replay_available(void)
+{
+    return _stored_pairs(0) ? 1U : 0U;
+}
@@ -0,0 +1,187 @@
+#include <gb/gb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "save.h"
+
+/* SRAM window (0xA000-0xBFFF).  The host shim maps it to its own array. */
+#ifndef SRAM_WINDOW
+#define SRAM_WINDOW ((uint8_t *)0xA000U)
+#endif
+
+/* Slot layout (SLOT_STRIDE bytes each): 8-byte header, then the payload */
+#define SLOT_STRIDE      0x80U
+#define HDR_MAGIC0       0U
+#define HDR_MAGIC1       1U
+#define HDR_VERSION      2U
+#define HDR_SIZE         3U
+#define HDR_CRC_LO       4U
+#define HDR_CRC_HI       5U
+#define HDR_SEQ          6U    /* written last: commits the slot */
+#define HDR_LEN          8U
+
+#define SAVE_MAGIC0      'S'
+#define SAVE_MAGIC1      'V'
+#define SAVE_BLOCKS      ((sizeof(SaveData) + SAVE_BLOCK_SIZE - 1U) / SAVE_BLOCK_SIZE)
+#define NO_SLOT          0xFFU
+
+/* Fails to compile when SaveData outgrows the dirty mask */
+typedef char save_size_check[(sizeof(SaveData) <= SAVE_MAX_SIZE) ? 1 : -1];
+
+SaveData save_data;
+
+/* Until save_load() has run, both slots count as stale */
+static uint8_t _active     = NO_SLOT;          /* slot holding the current save */
+static uint8_t _seq;                           /* sequence number of _active    */
+static uint8_t _pending[2] = { 0xFFU, 0xFFU }; /* blocks changed per slot       */
+
+/* CRC16-CCITT (poly 0x1021, init 0xFFFF), one nibble at a time */
+static const uint16_t crc_nibble[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+};
+
+static uint16_t _crc16(const uint8_t *p, uint8_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    while (len--) {
+        crc = (uint16_t)((crc << 4) ^ crc_nibble[(uint8_t)((crc >> 12) ^ (*p >> 4))]);
+        crc = (uint16_t)((crc << 4) ^ crc_nibble[(uint8_t)((crc >> 12) ^ (*p & 0x0FU))]);
+        p++;
+    }
+    return crc;
+}
+
+/* Store v at *p unless it is already there; returns bytes written */
+static uint8_t _put(uint8_t *p, uint8_t v)
+{
+    if (*p == v) return 0U;
+    *p = v;
+    return 1U;
+}
+
+static void _defaults(void)
+{
+    memset(&save_data, 0, sizeof(save_data));
+}
+
+/* 1 if the slot at s holds an intact save of the current layout */
+static uint8_t _slot_valid(const uint8_t *s)
+{
+    uint16_t crc;
+
+    if (s[HDR_MAGIC0] != SAVE_MAGIC0 || s[HDR_MAGIC1] != SAVE_MAGIC1 ||
+        s[HDR_VERSION] != SAVE_VERSION || s[HDR_SIZE] != sizeof(SaveData)) {
+        return 0U;
+    }
+    crc = _crc16(s + HDR_LEN, sizeof(SaveData));
+    return (s[HDR_CRC_LO] == (uint8_t)crc && s[HDR_CRC_HI] == (uint8_t)(crc >> 8))
+           ? 1U : 0U;
+}
+
+uint8_t save_load(void)
+{
+    uint8_t *s;
+    uint8_t valid0, valid1;
+
+    ENABLE_RAM;
+    SWITCH_RAM(SAVE_SRAM_BANK);
+    s = SRAM_WINDOW;
+
+    valid0 = _slot_valid(s);
+    valid1 = _slot_valid(s + SLOT_STRIDE);
+
+    if (valid0 && valid1) {
+        /* Newest wins; sequence numbers compare modulo 256 */
+        _active = ((int8_t)(uint8_t)(s[SLOT_STRIDE + HDR_SEQ] - s[HDR_SEQ]) > 0)
+                  ? 1U : 0U;
+    } else if (valid0) {
+        _active = 0U;
+    } else if (valid1) {
+        _active = 1U;
+    } else {
+        _active = NO_SLOT;
+    }
+
+    if (_active != NO_SLOT) {
+        s += (uint16_t)_active * SLOT_STRIDE;
+        memcpy(&save_data, s + HDR_LEN, sizeof(SaveData));
+        _seq = s[HDR_SEQ];
+        /* The spare slot's contents are unknown relative to ours */
+        _pending[_active]      = 0U;
+        _pending[_active ^ 1U] = 0xFFU;
+    } else {
+        _defaults();
+        _seq        = 0U;
+        _pending[0] = 0xFFU;
+        _pending[1] = 0xFFU;
+    }
+    DISABLE_RAM;
+
+    return (_active != NO_SLOT) ? 1U : 0U;
+}
+
+void save_mark(uint8_t offset, uint8_t len)
+{
+    uint8_t first, last, bits;
+
+    if (!len) return;
+    first = (uint8_t)(offset / SAVE_BLOCK_SIZE);
+    last  = (uint8_t)((uint8_t)(offset + len - 1U) / SAVE_BLOCK_SIZE);
+    bits  = 0U;
+    while (first <= last) {
+        bits |= (uint8_t)(1U << first);
+        first++;
+    }
+    _pending[0] |= bits;
+    _pending[1] |= bits;
+}
+
+uint8_t save_commit(void)
+{
+    const uint8_t *src = (const uint8_t *)&save_data;
+    uint8_t  target = (_active == NO_SLOT) ? 0U : (uint8_t)(_active ^ 1U);
+    uint8_t  mask   = _pending[target];
+    uint8_t  written = 0U;
+    uint8_t  b, i, end;
+    uint16_t crc;
+    uint8_t *s;
+
+    /* Nothing changed since the current slot was written */
+    if (_active != NO_SLOT && !_pending[_active]) return 0U;
+
+    crc = _crc16(src, sizeof(SaveData));
+
+    ENABLE_RAM;
+    SWITCH_RAM(SAVE_SRAM_BANK);
+    s = SRAM_WINDOW + (uint16_t)target * SLOT_STRIDE;
+
+    /* 1. Payload: dirty blocks only, unchanged bytes skipped */
+    for (b = 0; b < SAVE_BLOCKS; b++) {
+        if (!(mask & (uint8_t)(1U << b))) continue;
+        i   = (uint8_t)(b * SAVE_BLOCK_SIZE);
+        end = (uint8_t)(i + SAVE_BLOCK_SIZE);
+        if (end > sizeof(SaveData)) end = sizeof(SaveData);
+        for (; i < end; i++) {
+            written += _put(&s[HDR_LEN + i], src[i]);
+        }
+    }
+
+    /* 2. Header and CRC: the slot validates only once all of it is in */
+    written += _put(&s[HDR_MAGIC0],  SAVE_MAGIC0);
+    written += _put(&s[HDR_MAGIC1],  SAVE_MAGIC1);
+    written += _put(&s[HDR_VERSION], SAVE_VERSION);
+    written += _put(&s[HDR_SIZE],    (uint8_t)sizeof(SaveData));
+    written += _put(&s[HDR_CRC_LO],  (uint8_t)crc);
+    written += _put(&s[HDR_CRC_HI],  (uint8_t)(crc >> 8));
+
+    /* 3. Sequence number last: from here on this slot is the newest */
+    _seq++;
+    s[HDR_SEQ] = _seq;
+    written++;
+    DISABLE_RAM;
+
+    _pending[target] = 0U;
+    _active = target;
+    return written;
+}
@@ -0,0 +1,163 @@
+#include <gb/gb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sfx.h"
+
+#define SFX_CHANNELS  4U
+#define CH_REG_STRIDE 5U      /* NR10..NR14, NR20..NR24, ... NR40..NR44 */
+#define CH_REG_END    0x24U   /* first register not owned by a channel  */
+
+/* Register low addresses (0xFF00 + reg) */
+#define REG_NR12  0x12U
+#define REG_NR22  0x17U
+#define REG_NR30  0x1AU
+#define REG_NR42  0x21U
+#define REG_NR50  0x24U
+#define REG_NR51  0x25U
+#define REG_NR52  0x26U
+
+typedef struct {
+    const sfx_def_t *def;    /* NULL if idle                           */
+    uint8_t frame_i;         /* next frame to apply                    */
+    uint8_t wait;            /* VBlanks until frame_i is applied       */
+    uint8_t shift;           /* channel register relocation            */
+    sfx_priority_t prio;
+} sfx_slot_t;
+
+static sfx_slot_t _slots[SFX_CHANNELS];
+static uint8_t    _music_mask;
+
+/* Writing 0 to the envelope register turns the channel's DAC off */
+static const uint8_t _mute_reg[SFX_CHANNELS] = {
+    REG_NR12, REG_NR22, REG_NR30, REG_NR42
+};
+
+#ifdef SFX_TEST_MODE
+sfx_write_t sfx_test_log[SFX_TEST_LOG_SIZE];
+uint8_t     sfx_test_log_len;
+
+static void sfx_write(uint8_t reg, uint8_t val)
+{
+    sfx_write_t *w = &sfx_test_log[sfx_test_log_len & (SFX_TEST_LOG_SIZE - 1U)];
+    w->reg = reg;
+    w->val = val;
+    sfx_test_log_len++;
+}
+#else
+static void sfx_write(uint8_t reg, uint8_t val)
+{
+    *(volatile uint8_t *)(0xFF00U | reg) = val;
+}
+#endif
+
+void sfx_init(void)
+{
+    uint8_t i;
+
+    sfx_write(REG_NR52, 0x80U);   /* APU on first: other writes need it */
+    sfx_write(REG_NR50, 0x77U);
+    sfx_write(REG_NR51, 0xFFU);
+    for (i = 0; i < SFX_CHANNELS; i++) {
+        _slots[i].def = NULL;
+    }
+    _music_mask = 0U;
+}
+
+void sfx_update(void)
+{
+    uint8_t i, n;
+    sfx_slot_t *s = _slots;
+    const sfx_frame_t *f;
+    const sfx_write_t *op;
+
+    for (i = 0; i < SFX_CHANNELS; i++, s++) {
+        if (!s->def) continue;
+        if (s->wait > 1U) {
+            s->wait--;
+            continue;
+        }
+
+        f  = &s->def->frames[s->frame_i];
+        op = f->ops;
+        for (n = f->count; n; n--, op++) {
+            sfx_write((op->reg < CH_REG_END) ? (uint8_t)(op->reg + s->shift)
+                                             : op->reg,
+                      op->val);
+        }
+
+        if (++s->frame_i >= s->def->frame_count) {
+            s->def = NULL;
+        } else {
+            s->wait = s->def->frames[s->frame_i].vbls;
+        }
+    }
+}
+
+uint8_t sfx_play(uint8_t id, sfx_priority_t prio)
+{
+    const sfx_def_t *def;
+    uint8_t i, bit, allowed, home;
+    uint8_t pick = 0xFFU;
+
+    if (id >= sfx_defs_count) return 0U;
+    def = &sfx_defs[id];
+    if (prio == SFX_PRIO_DEFAULT) prio = def->priority_hint;
+
+    allowed = (uint8_t)(def->preferred_channel & (uint8_t)~_music_mask);
+    for (i = 0, bit = SFX_CH1; i < SFX_CHANNELS; i++, bit <<= 1) {
+        if (!(allowed & bit)) continue;
+        if (!_slots[i].def) {
+            pick = i;
+            break;
+        }
+        if (pick == 0xFFU &&
+            (_slots[i].prio < prio || _slots[i].def == def)) {
+            pick = i;
+        }
+    }
+    if (pick == 0xFFU) return 0U;
+
+    /* Scripts address the lowest preferred channel; move them over */
+    for (home = 0, bit = SFX_CH1; !(def->preferred_channel & bit); home++) {
+        bit <<= 1;
+    }
+
+    _slots[pick].def     = def;
+    _slots[pick].frame_i = 0U;
+    _slots[pick].wait    = def->frames[0].vbls;
+    _slots[pick].shift   = (uint8_t)((pick - home) * CH_REG_STRIDE);
+    _slots[pick].prio    = prio;
+    return 1U;
+}
+
+uint8_t sfx_is_busy(uint8_t channels)
+{
+    uint8_t i, bit;
+
+    for (i = 0, bit = SFX_CH1; i < SFX_CHANNELS; i++, bit <<= 1) {
+        if ((channels & bit) && _slots[i].def) return 1U;
+    }
+    return 0U;
+}
+
+void sfx_stop_all(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < SFX_CHANNELS; i++) {
+        if (_slots[i].def) {
+            _slots[i].def = NULL;
+            sfx_write(_mute_reg[i], 0x00U);
+        }
+    }
+}
+
+void sfx_set_music_mask(uint8_t mask)
+{
+    uint8_t i, bit;
+
+    _music_mask = mask;
+    for (i = 0, bit = SFX_CH1; i < SFX_CHANNELS; i++, bit <<= 1) {
+        if (mask & bit) _slots[i].def = NULL;
+    }
+}
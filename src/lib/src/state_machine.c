@@ -1,34 +1,137 @@
+#include <gbdk/platform.h>
 #include <stddef.h>
 #include <stdint.h>
+#ifdef DEBUG
+#include <gbdk/emu_debug.h>
+#endif
+#include "frame.h"
 #include "states.h"
-#include "state_win.h"
+#include "vram.h"
 
-static GameStateID current_state_id;
-static const GameState* current_state_ptr = NULL;
+/* -----------------------------------------------------------------------
+ * Bank-aware dispatch
+ *
+ * State files are autobanked (#pragma bank 255), so both the GameState
+ * struct and the callbacks it points to live in a switchable ROM bank.
+ * The table below records that bank next to each state; the dispatcher
+ * (bank 0) maps it in, reads the callback pointer, calls it and maps the
+ * caller's bank back.  A callback may itself call switch_state() /
+ * push_state() / pop_state() – every dispatch restores the bank it found.
+ *
+ * Each stacked state also owns a VRAM arena (vram.h): one is pushed
+ * before its init() and popped after its cleanup(), releasing the tiles
+ * it loaded.
+ *
+ * The overhead per dispatch is saving CURRENT_BANK, two SWITCH_ROM()s,
+ * reading the callback pointer and an indirect call, paid once per frame
+ * by run_current_state.  No SM83 cycle figure is claimed for it: none
+ * has been measured on the target yet.  The only measured number is the
+ * host benchmark (make host-bench, run_current_state), which tracks
+ * changes between commits but does not predict SM83 cycles.  A DEBUG
+ * build measures it in Emulicious: every frame it also dispatches to an
+ * empty callback in a switchable bank and logs "state dispatch cycles:",
+ * which is the overhead alone, next to "state update cycles:" for the
+ * real update.
+ * -------------------------------------------------------------------- */
+
+typedef struct {
+    uint8_t          bank;
+    const GameState *state;
+} StateEntry;
 
 #define STATE_COUNT (sizeof(states)/sizeof(states[0]))
 
-static const GameState* states[] = {
-    &state_title,
-    &state_gameplay,
-    &state_gameover,
-    &state_win
+static const StateEntry states[] = {
+    { BANK(state_title),    &state_title    },
+    { BANK(state_gameplay), &state_gameplay },
+    { BANK(state_gameover), &state_gameover },
+    { BANK(state_win),      &state_win      },
+    { BANK(state_pause),    &state_pause    }
 };
 
+#if VRAM_MAX_ARENAS < STATE_STACK_MAX + 1
+#error "vram.h needs an arena per stacked state plus the root arena"
+#endif
+
+/* state_stack[0] is the base state, state_stack[state_depth-1] the top */
+static const StateEntry* state_stack[STATE_STACK_MAX];
+static uint8_t state_depth = 0;
+
+typedef void (*StateCallback)(void);
+
+#ifdef DEBUG
+/* Dispatch overhead probe: an update that returns at once, dispatched
+ * through a switchable bank like a real state */
+static void probe_update(void) {
+}
+
+static const GameState dispatch_probe = { NULL, probe_update, NULL, NULL, NULL };
+static const StateEntry probe_entry = { BANK(state_title), &dispatch_probe };
+#endif
+
+/* Callback selectors for dispatch(): byte offset into GameState */
+#define CB_INIT     ((uint8_t)offsetof(GameState, init))
+#define CB_UPDATE   ((uint8_t)offsetof(GameState, update))
+#define CB_CLEANUP  ((uint8_t)offsetof(GameState, cleanup))
+#define CB_PAUSE    ((uint8_t)offsetof(GameState, pause))
+#define CB_RESUME   ((uint8_t)offsetof(GameState, resume))
+
+static void dispatch(const StateEntry* entry, uint8_t cb) {
+    uint8_t saved_bank = CURRENT_BANK;
+    StateCallback fn;
+
+    SWITCH_ROM(entry->bank);
+    /* The GameState struct is only readable once its bank is mapped */
+    fn = *(const StateCallback *)((const uint8_t *)entry->state + cb);
+    if (fn) {
+        fn();
+    }
+    SWITCH_ROM(saved_bank);
+}
+
 void switch_state(GameStateID new_state) {
     if ((uint8_t)new_state >= (uint8_t)STATE_COUNT) return;
-    if (current_state_ptr && current_state_ptr->cleanup) {
-        current_state_ptr->cleanup();
+    /* Unwind overlays first, then the base state */
+    while (state_depth) {
+        dispatch(state_stack[--state_depth], CB_CLEANUP);
+        vram_arena_pop();
     }
-    current_state_id = new_state;
-    current_state_ptr = states[new_state];
-    if (current_state_ptr && current_state_ptr->init) {
-        current_state_ptr->init();
+    state_stack[0] = &states[new_state];
+    state_depth = 1;
+    vram_arena_push();
+    dispatch(state_stack[0], CB_INIT);
+    /* Fades and loads around a state change are not lag */
+    frame_resync();
+}
+
+void push_state(GameStateID new_state) {
+    if ((uint8_t)new_state >= (uint8_t)STATE_COUNT) return;
+    if (state_depth >= STATE_STACK_MAX) return;
+    if (state_depth) {
+        dispatch(state_stack[state_depth - 1U], CB_PAUSE);
     }
+    state_stack[state_depth] = &states[new_state];
+    vram_arena_push();
+    dispatch(state_stack[state_depth++], CB_INIT);
+}
+
+void pop_state(void) {
+    if (state_depth < 2U) return;
+    dispatch(state_stack[--state_depth], CB_CLEANUP);
+    vram_arena_pop();
+    dispatch(state_stack[state_depth - 1U], CB_RESUME);
 }
 
 void run_current_state(void) {
-    if (current_state_ptr && current_state_ptr->update) {
-        current_state_ptr->update();
-    }
+    if (state_depth == 0U) return;
+#ifdef DEBUG
+    EMU_PROFILE_BEGIN("state update ");
+#endif
+    dispatch(state_stack[state_depth - 1U], CB_UPDATE);
+#ifdef DEBUG
+    EMU_PROFILE_END("state update cycles:");
+    EMU_PROFILE_BEGIN("state dispatch ");
+    dispatch(&probe_entry, CB_UPDATE);
+    EMU_PROFILE_END("state dispatch cycles:");
+#endif
 }
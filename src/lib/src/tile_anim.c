@@ -0,0 +1,92 @@
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "tile_anim.h"
+
+#define TILE_BYTES  16U
+
+static TileAnim       _anim[TILE_ANIM_MAX];
+static uint8_t        _frame[TILE_ANIM_MAX];
+static uint8_t        _timer[TILE_ANIM_MAX];
+static const uint8_t *_frames;
+static uint8_t        _count;
+static uint8_t        _pending;      /* bit i: anim i needs its upload */
+static uint8_t        _next;         /* round-robin start              */
+static uint8_t        _rom_bank;
+static uint8_t        _tile_base;
+static uint8_t        _vram_bank;
+
+void tile_anim_start(uint8_t rom_bank, const TileAnimSet *set,
+                     uint8_t tile_base, uint8_t vram_bank)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+    uint8_t i;
+
+    tile_anim_stop();
+    if (!set) return;
+
+    if (rom_bank) SWITCH_ROM(rom_bank);
+    _frames = set->frames;
+    _count  = (set->count > TILE_ANIM_MAX) ? TILE_ANIM_MAX : set->count;
+    for (i = 0; i < _count; i++) _anim[i] = set->anims[i];
+    if (rom_bank) SWITCH_ROM(saved_bank);
+
+    for (i = 0; i < _count; i++) {
+        _frame[i] = 0U;
+        _timer[i] = _anim[i].speed;
+    }
+    _rom_bank  = rom_bank;
+    _tile_base = tile_base;
+    _vram_bank = vram_bank;
+}
+
+void tile_anim_stop(void)
+{
+    _count   = 0U;
+    _pending = 0U;
+    _next    = 0U;
+    _frames  = NULL;
+}
+
+void tile_anim_commit(void)
+{
+    uint8_t saved_bank;
+    uint8_t budget = TILE_ANIM_BUDGET;
+    uint8_t i, n;
+
+    for (i = 0; i < _count; i++) {
+        if (_anim[i].frame_count < 2U || --_timer[i]) continue;
+        _timer[i] = _anim[i].speed;
+        if (++_frame[i] >= _anim[i].frame_count) _frame[i] = 0U;
+        _pending |= (uint8_t)(1U << i);
+    }
+    if (!_pending) return;
+
+    saved_bank = CURRENT_BANK;
+    if (_rom_bank) SWITCH_ROM(_rom_bank);
+    VBK_REG = _vram_bank;
+    i = _next;
+    for (n = _count; n && budget >= TILE_BYTES; n--) {
+        if (_pending & (uint8_t)(1U << i)) {
+            set_bkg_data((uint8_t)(_tile_base + _anim[i].tile), 1U,
+                         _frames + (uint16_t)(_anim[i].first_frame + _frame[i]) * TILE_BYTES);
+            _pending &= (uint8_t)~(1U << i);
+            budget    = (uint8_t)(budget - TILE_BYTES);
+        }
+        if (++i >= _count) i = 0U;
+    }
+    _next = i;
+    VBK_REG = 0;
+    if (_rom_bank) SWITCH_ROM(saved_bank);
+}
+
+uint8_t tile_anim_pending(void)
+{
+    uint8_t i, n = 0U;
+
+    for (i = 0; i < _count; i++) {
+        if (_pending & (uint8_t)(1U << i)) n++;
+    }
+    return n;
+}
@@ -2,9 +2,14 @@
 #include <gb/cgb.h>
 #include <stdint.h>
 #include "utils.h"
+#include "vram.h"
 
-void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t tile_offset) {
+void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t font) {
     uint8_t i = 0;
+    uint8_t tile_offset = vram_tile(font);
+    /* GBC background palette slot 2 = font palette (black text), plus the
+     * VRAM bank the font was loaded into */
+    uint8_t attr = (uint8_t)(0x02U | vram_attr(font));
     /* First pass (VBK=0): write tile indices */
     VBK_REG = 0;
     while (str[i]) {
@@ -15,8 +20,7 @@ void draw_text(uint8_t x, uint8_t y, const char* str, uint8_t tile_offset) {
     /* Second pass (VBK=1): write palette attributes for the same span */
     VBK_REG = 1;
     for (uint8_t j = 0; j < i; j++) {
-        /* GBC background palette slot 2 = font palette (black text) */
-        set_bkg_tile_xy((uint8_t)(x + j), y, 0x02U);
+        set_bkg_tile_xy((uint8_t)(x + j), y, attr);
     }
     VBK_REG = 0;
 }
@@ -0,0 +1,267 @@
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef DEBUG
+#include <gbdk/emu_debug.h>
+#endif
+#include "pb16.h"
+#include "vram.h"
+
+/* Tile slots per VRAM bank, in address order: OBJ-only block 0-127,
+ * shared block 128-255, BG-only block 256-383 */
+#define SLOTS       384U
+#define BG_SLOT(t)  (((t) < 128U) ? (uint16_t)((t) + 256U) : (uint16_t)(t))
+
+static uint8_t _used[2][SLOTS / 8U];
+
+/* Resident ranges; _count == 0 marks a free entry */
+static const uint8_t *_key[VRAM_MAX_ENTRIES];
+static uint8_t        _rom_bank[VRAM_MAX_ENTRIES];
+static uint8_t        _first[VRAM_MAX_ENTRIES];
+static uint8_t        _count[VRAM_MAX_ENTRIES];
+static uint8_t        _kind[VRAM_MAX_ENTRIES];
+static uint8_t        _vbank[VRAM_MAX_ENTRIES];
+static uint8_t        _refs[VRAM_MAX_ENTRIES];
+
+/* Reference log: one entry index per reference, newest last.  Arena a
+ * owns _log[_arena_start[a] .. next arena's start - 1]. */
+static uint8_t _log[VRAM_MAX_REFS];
+static uint8_t _log_len;
+static uint8_t _arena_start[VRAM_MAX_ARENAS];
+static uint8_t _arena;
+
+static uint16_t slot_of(uint8_t kind, uint8_t tile)
+{
+    return (kind == VRAM_BG) ? BG_SLOT(tile) : (uint16_t)tile;
+}
+
+static uint8_t slot_used(uint8_t vbank, uint16_t s)
+{
+    return _used[vbank][s >> 3] & (uint8_t)(1U << (s & 7U));
+}
+
+static void mark(uint8_t e, uint8_t used)
+{
+    uint8_t  i;
+    uint16_t s;
+
+    for (i = 0; i < _count[e]; i++) {
+        s = slot_of(_kind[e], (uint8_t)(_first[e] + i));
+        if (used) {
+            _used[_vbank[e]][s >> 3] |= (uint8_t)(1U << (s & 7U));
+        } else {
+            _used[_vbank[e]][s >> 3] &= (uint8_t)~(1U << (s & 7U));
+        }
+    }
+}
+
+/* First fit: bank 0 then bank 1, tile indices 0-255 of the kind (own
+ * block first), OBJ ranges on an even tile in 8x16 mode.  Fills in the
+ * entry's position; 0 when nothing fits. */
+static uint8_t place(uint8_t e)
+{
+    uint8_t  vbank, odd;
+    uint16_t t, run;
+
+    odd = (_kind[e] == VRAM_OBJ && (LCDC_REG & LCDCF_OBJ16)) ? 1U : 0U;
+    for (vbank = 0; vbank < 2U; vbank++) {
+        run = 0U;
+        for (t = 0; t < 256U; t++) {
+            if (slot_used(vbank, slot_of(_kind[e], (uint8_t)t))) {
+                run = 0U;
+                continue;
+            }
+            if (run == 0U && (t & odd)) continue;   /* runs start aligned */
+            if (++run == _count[e]) {
+                _first[e] = (uint8_t)(t + 1U - run);
+                _vbank[e] = vbank;
+                mark(e, 1U);
+                return 1U;
+            }
+        }
+    }
+    return 0U;
+}
+
+static uint8_t new_entry(uint8_t kind, uint8_t count)
+{
+    uint8_t e;
+
+    if (count == 0U || _log_len >= VRAM_MAX_REFS) return VRAM_NONE;
+    for (e = 0; e < VRAM_MAX_ENTRIES; e++) {
+        if (_count[e] == 0U) break;
+    }
+    if (e == VRAM_MAX_ENTRIES) return VRAM_NONE;
+
+    _kind[e]  = kind;
+    _count[e] = count;
+    if (!place(e)) {
+        _count[e] = 0U;
+        return VRAM_NONE;
+    }
+    _key[e]      = NULL;
+    _rom_bank[e] = 0U;
+    _refs[e]     = 0U;
+    return e;
+}
+
+static uint8_t add_ref(uint8_t e)
+{
+    _refs[e]++;
+    _log[_log_len++] = e;
+    return e;
+}
+
+static void drop_ref(uint8_t e)
+{
+    if (--_refs[e] == 0U) {
+        mark(e, 0U);
+        _count[e] = 0U;
+        _key[e]   = NULL;
+    }
+}
+
+void vram_init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < SLOTS / 8U; i++) {
+        _used[0][i] = 0U;
+        _used[1][i] = 0U;
+    }
+    for (i = 0; i < VRAM_MAX_ENTRIES; i++) {
+        _count[i] = 0U;
+        _key[i]   = NULL;
+    }
+    _log_len        = 0U;
+    _arena          = 0U;
+    _arena_start[0] = 0U;
+}
+
+uint8_t vram_load(uint8_t kind, const uint8_t *tiles, uint8_t rom_bank,
+                  uint8_t count, uint8_t codec)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+    uint8_t e;
+
+    if (_log_len >= VRAM_MAX_REFS) return VRAM_NONE;
+    for (e = 0; e < VRAM_MAX_ENTRIES; e++) {
+        if (_count[e] && _key[e] == tiles && _kind[e] == kind) {
+            return add_ref(e);
+        }
+    }
+
+    e = new_entry(kind, count);
+    if (e == VRAM_NONE) return VRAM_NONE;
+    _key[e]      = tiles;
+    _rom_bank[e] = rom_bank;
+
+    if (rom_bank) SWITCH_ROM(rom_bank);
+    VBK_REG = _vbank[e];
+#ifdef DEBUG
+    /* Load time per codec, to calibrate the pb16 model in
+     * tools/gbc_asset_builder.py */
+    EMU_PROFILE_BEGIN("tiles ");
+#endif
+    if (kind == VRAM_BG) {
+        if (codec == TILE_CODEC_PB16) pb16_set_bkg_data(_first[e], count, tiles);
+        else                          set_bkg_data(_first[e], count, tiles);
+    } else {
+        if (codec == TILE_CODEC_PB16) pb16_set_sprite_data(_first[e], count, tiles);
+        else                          set_sprite_data(_first[e], count, tiles);
+    }
+#ifdef DEBUG
+    if (codec == TILE_CODEC_PB16) {
+        EMU_PROFILE_END("tiles pb16 cycles:");
+    } else {
+        EMU_PROFILE_END("tiles raw cycles:");
+    }
+#endif
+    VBK_REG = 0;
+    if (rom_bank) SWITCH_ROM(saved_bank);
+    return add_ref(e);
+}
+
+uint8_t vram_alloc(uint8_t kind, uint8_t count)
+{
+    uint8_t e = new_entry(kind, count);
+
+    return (e == VRAM_NONE) ? VRAM_NONE : add_ref(e);
+}
+
+void vram_release(uint8_t handle)
+{
+    uint8_t i;
+
+    /* Newest reference to handle in the current arena */
+    for (i = _log_len; i > _arena_start[_arena]; i--) {
+        if (_log[i - 1U] == handle) break;
+    }
+    if (i == _arena_start[_arena]) return;
+
+    for (; i < _log_len; i++) _log[i - 1U] = _log[i];
+    _log_len--;
+    drop_ref(handle);
+}
+
+uint8_t vram_tile(uint8_t handle)
+{
+    return _first[handle];
+}
+
+uint8_t vram_bank(uint8_t handle)
+{
+    return _vbank[handle];
+}
+
+uint8_t vram_attr(uint8_t handle)
+{
+    return _vbank[handle] ? VRAM_ATTR_BANK1 : 0U;
+}
+
+void vram_arena_push(void)
+{
+    if (_arena + 1U >= VRAM_MAX_ARENAS) return;
+    _arena_start[++_arena] = _log_len;
+}
+
+void vram_arena_pop(void)
+{
+    if (_arena == 0U) return;
+    while (_log_len > _arena_start[_arena]) {
+        drop_ref(_log[--_log_len]);
+    }
+    _arena--;
+}
+
+uint16_t vram_free_tiles(uint8_t kind)
+{
+    uint8_t  vbank;
+    uint16_t t, n = 0U;
+
+    for (vbank = 0; vbank < 2U; vbank++) {
+        for (t = 0; t < 256U; t++) {
+            if (!slot_used(vbank, slot_of(kind, (uint8_t)t))) n++;
+        }
+    }
+    return n;
+}
+
+void vram_set_bkg_submap(uint8_t handle, uint8_t x, uint8_t y,
+                         uint8_t w, uint8_t h, const uint8_t *map,
+                         const uint8_t *attr_map, uint8_t map_w)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+    uint8_t rom_bank   = _rom_bank[handle];
+
+    if (rom_bank) SWITCH_ROM(rom_bank);
+    VBK_REG = 0;
+    set_bkg_based_submap(x, y, w, h, map, map_w, _first[handle]);
+    if (attr_map) {
+        VBK_REG = 1;
+        set_bkg_based_submap(x, y, w, h, attr_map, map_w, vram_attr(handle));
+        VBK_REG = 0;
+    }
+    if (rom_bank) SWITCH_ROM(saved_bank);
+}
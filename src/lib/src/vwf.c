@@ -0,0 +1,186 @@
+#include <gb/gb.h>
+#include <gbdk/platform.h>
+#include <stdint.h>
+#include "vwf.h"
+
+#define RING_MASK  (VWF_MAX_TILES - 1U)   /* VWF_MAX_TILES is a power of 2 */
+
+static vwf_font_t _font;       /* RAM copy: the descriptor lives in _bank */
+static uint8_t    _bank;
+static uint8_t    _first_tile;
+static uint8_t    _vram_bank;  /* VRAM bank of the ring tiles           */
+static uint8_t    _tile_count;
+static uint8_t    _next;       /* ring slot the next started tile takes */
+
+/* Composed text, 1 bit per pixel (text = colour 1), and its map cell */
+static uint8_t _buf[VWF_MAX_TILES][8];
+static uint8_t _cell_x[VWF_MAX_TILES];
+static uint8_t _cell_y[VWF_MAX_TILES];
+
+/* Upload FIFO: each slot is queued at most once */
+static uint8_t _queue[VWF_MAX_TILES];
+static uint8_t _queued[VWF_MAX_TILES];
+static uint8_t _q_head;
+static uint8_t _q_len;
+
+/* Pen: map cell, pixel offset inside it and the slot it is drawing in */
+static uint8_t _pen_x;
+static uint8_t _pen_y;
+static uint8_t _pen_px;
+static uint8_t _pen_slot;
+static uint8_t _pen_open;      /* 0 until the pen's cell has a tile */
+
+static void queue_slot(uint8_t slot)
+{
+    if (_queued[slot]) return;
+    _queued[slot] = 1U;
+    _queue[(uint8_t)(_q_head + _q_len) & RING_MASK] = slot;
+    _q_len++;
+}
+
+/* Give the pen's cell the next ring tile, blank */
+static void open_tile(void)
+{
+    uint8_t *dst;
+    uint8_t  r;
+
+    _pen_slot = _next;
+    if (++_next >= _tile_count) _next = 0U;
+    dst = _buf[_pen_slot];
+    for (r = 0; r < 8U; r++) dst[r] = 0U;
+    _cell_x[_pen_slot] = _pen_x;
+    _cell_y[_pen_slot] = _pen_y;
+    _pen_open = 1U;
+    queue_slot(_pen_slot);
+}
+
+void vwf_init(const vwf_font_t *font, uint8_t font_bank,
+              uint8_t first_tile, uint8_t tile_count, uint8_t vram_bank)
+{
+    uint8_t saved_bank = CURRENT_BANK;
+
+    SWITCH_ROM(font_bank);
+    _font = *font;
+    SWITCH_ROM(saved_bank);
+
+    _bank       = font_bank;
+    _first_tile = first_tile;
+    _vram_bank  = vram_bank ? 1U : 0U;
+    _tile_count = (tile_count > VWF_MAX_TILES) ? VWF_MAX_TILES : tile_count;
+    vwf_clear();
+}
+
+void vwf_clear(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < VWF_MAX_TILES; i++) _queued[i] = 0U;
+    _q_head   = 0U;
+    _q_len    = 0U;
+    _next     = 0U;
+    _pen_px   = 0U;
+    _pen_open = 0U;
+}
+
+void vwf_move_to(uint8_t x, uint8_t y)
+{
+    _pen_x    = x;
+    _pen_y    = y;
+    _pen_px   = 0U;
+    _pen_open = 0U;
+}
+
+uint8_t vwf_putc(char c)
+{
+    uint8_t        g = (uint8_t)((uint8_t)c - _font.first_char);
+    uint8_t        h = _font.height;
+    uint8_t        saved_bank, w, r, spill;
+    const uint8_t *src;
+    uint8_t       *dst;
+
+    if ((uint8_t)c < _font.first_char || g >= _font.glyph_count) return 0U;
+
+    saved_bank = CURRENT_BANK;
+    SWITCH_ROM(_bank);
+
+    w   = _font.widths[g];
+    src = _font.glyphs + ((uint16_t)((uint16_t)g * 8U + _pen_px) * (uint8_t)(h * 2U));
+
+    if (!_pen_open) open_tile();
+    dst = _buf[_pen_slot];
+    for (r = 0; r < h; r++) dst[r] |= src[r];
+    queue_slot(_pen_slot);
+
+    _pen_px += w;
+    if (_pen_px >= 8U) {
+        _pen_px -= 8U;
+        _pen_x++;
+        _pen_open = 0U;
+        src += h;
+        for (r = 0, spill = 0U; r < h; r++) spill |= src[r];
+        if (spill) {
+            open_tile();
+            dst = _buf[_pen_slot];
+            for (r = 0; r < h; r++) dst[r] |= src[r];
+        }
+    }
+
+    SWITCH_ROM(saved_bank);
+    return w;
+}
+
+/* str is read with the caller's bank mapped (it may live there); the font
+ * bank is only mapped for each glyph lookup */
+void vwf_print(uint8_t x, uint8_t y, const char *str)
+{
+    vwf_move_to(x, y);
+    while (*str) vwf_putc(*str++);
+}
+
+uint16_t vwf_text_width(const char *str)
+{
+    uint8_t  saved_bank = CURRENT_BANK;
+    uint16_t width = 0U;
+    uint8_t  c, g;
+
+    while ((c = (uint8_t)*str++) != 0U) {
+        g = (uint8_t)(c - _font.first_char);
+        if (c < _font.first_char || g >= _font.glyph_count) continue;
+        SWITCH_ROM(_bank);
+        width += _font.widths[g];
+        SWITCH_ROM(saved_bank);
+    }
+    return width;
+}
+
+void vwf_commit(void)
+{
+    uint8_t tile[16];
+    uint8_t n, r, slot, *src;
+
+    for (n = VWF_COMMIT_TILES; n && _q_len; n--) {
+        slot = _queue[_q_head];
+        _q_head = (uint8_t)(_q_head + 1U) & RING_MASK;
+        _q_len--;
+        _queued[slot] = 0U;
+
+        src = _buf[slot];
+        for (r = 0; r < 8U; r++) {
+            tile[r * 2U]      = src[r];
+            tile[r * 2U + 1U] = 0U;
+        }
+        VBK_REG = _vram_bank;
+        set_bkg_data((uint8_t)(_first_tile + slot), 1U, tile);
+        VBK_REG = 0;
+        set_bkg_tile_xy(_cell_x[slot], _cell_y[slot], (uint8_t)(_first_tile + slot));
+        VBK_REG = 1;
+        set_bkg_tile_xy(_cell_x[slot], _cell_y[slot],
+                        (uint8_t)(VWF_ATTR | (_vram_bank << 3)));
+        VBK_REG = 0;
+    }
+}
+
+uint8_t vwf_pending(void)
+{
+    return _q_len;
+}
@@ -0,0 +1,183 @@
+/* Host throughput benchmarks: make host-bench
+ *
+ * Host timings do not predict SM83 cycle counts, but they track relative
+ * changes in the algorithms (e.g. a faster tile-collision loop) between
+ * commits without needing an emulator. */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "pb16.h"
+#include "projectile.h"
+#include "sprite.h"
+#include "sprite_manager.h"
+#include "states.h"
+#include "fake_states.h"
+#include "gbdk_shim.h"
+
+#define MAP_W  48U
+#define MAP_H  18U
+
+static uint8_t level[MAP_W * MAP_H];
+static const uint8_t solid[] = { 12, 13, 14, 15, 18 };
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, unsigned long ops, double secs,
+                   unsigned long sink)
+{
+    printf("%-28s %10.1f ns/op  (%lu ops, sink %lu)\n",
+           name, secs * 1e9 / (double)ops, ops, sink);
+}
+
+/* Ground rows like the gameplay level, with gaps and a few blocks */
+static void build_level(void)
+{
+    unsigned r, c;
+    for (r = 0; r < MAP_H; r++) {
+        for (c = 0; c < MAP_W; c++) {
+            uint8_t t = 0;
+            if (r >= 10U && (c % 12U) > 2U) t = (r == 10U) ? 12U : 13U;
+            if (r == 9U && (c % 7U) == 0U) t = 15U;
+            level[r * MAP_W + c] = t;
+        }
+    }
+}
+
+static void bench_tile_collision(void)
+{
+    Sprite *s;
+    unsigned long i, ops = 4000000UL, sink = 0;
+    double t0;
+
+    sprite_manager_init();
+    s = sprite_manager_alloc(0U, 2U, 16U, 16U, 0U, 2U);
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) {
+        s->world_y = (uint8_t)(60U + (i & 31U));
+        sink += sprite_manager_tile_collision(s, (uint16_t)(i % 368U),
+                                              level, MAP_W, MAP_H,
+                                              solid, sizeof(solid));
+    }
+    report("sprite_manager_tile_collision", ops, now_sec() - t0, sink);
+}
+
+static void bench_sprites_collide(void)
+{
+    Sprite a, b;
+    unsigned long i, ops = 20000000UL, sink = 0;
+    double t0;
+
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    a.active = b.active = 1U;
+    a.width = a.height = 16U;
+    b.width = b.height = 8U;
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) {
+        a.world_x = (uint8_t)i;
+        b.world_x = (uint8_t)(i >> 3);
+        sink += sprites_collide(&a, &b);
+    }
+    report("sprites_collide", ops, now_sec() - t0, sink);
+}
+
+static void bench_update_hw(void)
+{
+    Sprite *s;
+    unsigned long i, ops = 20000000UL;
+    double t0;
+
+    sprite_manager_init();
+    s = sprite_manager_alloc(0U, 2U, 16U, 16U, 0U, 2U);
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) {
+        s->world_x = (uint8_t)i;
+        sprite_manager_update_hw(s, (uint8_t)(i >> 4), 0U);
+    }
+    report("sprite_manager_update_hw", ops, now_sec() - t0, shim_oam[0].x);
+}
+
+static void bench_state_dispatch(void)
+{
+    unsigned long i, ops = 20000000UL;
+    double t0;
+
+    switch_state(STATE_GAMEPLAY);
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) {
+        if ((i & 63U) == 0U) fake_log_clear();
+        run_current_state();
+    }
+    report("run_current_state", ops, now_sec() - t0, shim_bank_switches);
+}
+
+/* A font-sized tile set (101 tiles) loaded raw vs. PB16 worst case
+ * (every byte a literal): the difference is the decode overhead. */
+static void bench_pb16(void)
+{
+    static uint8_t raw[101U * 16U], packed[101U * 18U];
+    unsigned long i, ops = 20000UL;
+    unsigned n;
+    double t0;
+
+    for (n = 0; n < sizeof(raw); n++) raw[n] = (uint8_t)(n * 7U);
+    for (n = 0; n < sizeof(raw) / 8U; n++) {
+        packed[n * 9U] = 0x00U;
+        memcpy(&packed[n * 9U + 1U], &raw[n * 8U], 8U);
+    }
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) set_bkg_data(0U, 101U, raw);
+    report("set_bkg_data (101 tiles)", ops, now_sec() - t0, shim_vram_writes);
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) pb16_set_bkg_data(0U, 101U, packed);
+    report("pb16_set_bkg_data (101 tiles)", ops, now_sec() - t0, shim_vram_writes);
+}
+
+/* One gameplay frame of projectile work with the pool kept full: update
+ * against the level, batched hits on two sprites, OBJ writes. */
+static void bench_projectiles(void)
+{
+    Sprite *a, *b;
+    unsigned long i, ops = 200000UL, sink = 0;
+    double t0;
+
+    sprite_manager_init();
+    a = sprite_manager_alloc(0U, 2U, 16U, 16U, 0U, 2U);
+    b = sprite_manager_alloc(2U, 1U, 8U, 8U, 0U, 2U);
+    a->world_x = 40U;  a->world_y = 60U;
+    b->world_x = 120U; b->world_y = 72U;
+    projectile_init(3U, 2U);
+    projectile_set_map(1U, level, MAP_W, MAP_H, solid, sizeof(solid));
+    t0 = now_sec();
+    for (i = 0; i < ops; i++) {
+        while (projectile_count() < PROJ_MAX) {
+            projectile_spawn((uint16_t)(20U + (i * 37U + projectile_count() * 13U) % 120U),
+                             (uint8_t)(20U + (i * 11U + projectile_count() * 5U) % 60U),
+                             (int8_t)((i & 1U) ? 3 : -3), 0, 40U, 10U,
+                             (uint8_t)(projectile_count() & 1U));
+        }
+        projectile_update(0U);
+        sink += projectile_hit(a, PROJ_OWNER_ENEMY);
+        sink += projectile_hit(b, PROJ_OWNER_PLAYER);
+        projectile_draw();
+    }
+    report("projectiles (24 live/frame)", ops, now_sec() - t0, sink);
+}
+
+int main(void)
+{
+    shim_reset();
+    build_level();
+    bench_tile_collision();
+    bench_sprites_collide();
+    bench_update_hw();
+    bench_state_dispatch();
+    bench_pb16();
+    bench_projectiles();
+    return 0;
+}
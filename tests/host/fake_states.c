@@ -0,0 +1,56 @@
+/* Stand-in GameState tables for the host build of state_machine.c.
+ * Each callback appends "<state><event>" to fake_log and records the ROM
+ * bank it ran in, so tests can check call order and bank switching. */
+#include <stddef.h>
+#include <string.h>
+#include "states.h"
+#include "fake_states.h"
+
+char    fake_log[256];
+uint8_t fake_bank_seen;
+void  (*fake_update_hook)(char state);
+
+static void _log(char state, char event)
+{
+    size_t n = strlen(fake_log);
+    if (n + 2U < sizeof(fake_log)) {
+        fake_log[n]      = state;
+        fake_log[n + 1U] = event;
+        fake_log[n + 2U] = '\0';
+    }
+    fake_bank_seen = CURRENT_BANK;
+}
+
+void fake_log_clear(void) { fake_log[0] = '\0'; }
+
+#define FAKE_STATE(var, ch)                                                  \
+    static void var##_init(void)    { _log(ch, 'i'); }                       \
+    static void var##_update(void)  {                                        \
+        _log(ch, 'u');                                                       \
+        if (fake_update_hook) fake_update_hook(ch);                          \
+    }                                                                        \
+    static void var##_cleanup(void) { _log(ch, 'c'); }                       \
+    static void var##_pause(void)   { _log(ch, 'p'); }                       \
+    static void var##_resume(void)  { _log(ch, 'r'); }                       \
+    BANKREF(var)                                                             \
+    const GameState var = {                                                  \
+        var##_init, var##_update, var##_cleanup, var##_pause, var##_resume   \
+    };
+
+FAKE_STATE(state_title,    'T')
+FAKE_STATE(state_gameplay, 'G')
+FAKE_STATE(state_gameover, 'O')
+FAKE_STATE(state_win,      'W')
+
+/* The pause overlay has no pause/resume of its own */
+static void state_pause_init(void)    { _log('P', 'i'); }
+static void state_pause_update(void)
+{
+    _log('P', 'u');
+    if (fake_update_hook) fake_update_hook('P');
+}
+static void state_pause_cleanup(void) { _log('P', 'c'); }
+BANKREF(state_pause)
+const GameState state_pause = {
+    state_pause_init, state_pause_update, state_pause_cleanup, NULL, NULL
+};
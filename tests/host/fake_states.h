@@ -0,0 +1,15 @@
+#ifndef FAKE_STATES_H
+#define FAKE_STATES_H
+
+#include <stdint.h>
+
+/* Callback trace, e.g. "TiTuTcGi" = title init, update, cleanup, gameplay init */
+extern char    fake_log[256];
+/* CURRENT_BANK observed inside the most recent callback */
+extern uint8_t fake_bank_seen;
+/* Optional hook run from every update() (to switch/push/pop from inside) */
+extern void  (*fake_update_hook)(char state);
+
+void fake_log_clear(void);
+
+#endif
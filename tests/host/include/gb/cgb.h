@@ -0,0 +1,16 @@
+/* Host shim for <gb/cgb.h> – CGB palette API */
+#ifndef SHIM_CGB_H
+#define SHIM_CGB_H
+
+#include <stdint.h>
+
+typedef uint16_t palette_color_t;
+
+#define RGB(r, g, b)  ((palette_color_t)((r) | ((g) << 5) | ((b) << 10)))
+#define RGB8(r, g, b) ((palette_color_t)(((r) >> 3) | (((g) >> 3) << 5) | \
+                                         (((b) >> 3) << 10)))
+
+void set_bkg_palette(uint8_t first, uint8_t nb, const palette_color_t *data);
+void set_sprite_palette(uint8_t first, uint8_t nb, const palette_color_t *data);
+
+#endif
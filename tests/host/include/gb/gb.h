@@ -0,0 +1,127 @@
+/* Host shim for <gb/gb.h> – just enough of the GBDK-2020 API to build
+ * src/lib with the host compiler.  Hardware writes land in the arrays
+ * declared in gbdk_shim.h so tests can inspect them. */
+#ifndef SHIM_GB_H
+#define SHIM_GB_H
+
+#include <stdint.h>
+
+/* Banking: autobank pragmas and calling conventions vanish on the host.
+ * Every BANK() reports the same bank; the dispatcher still switches to it
+ * and back, which is what the tests check. */
+#define BANKED
+#define NONBANKED
+#define CRITICAL
+#define INTERRUPT
+#define BANKREF(x)         const uint8_t __bank_##x = 1U;
+#define BANKREF_EXTERN(x)  extern const uint8_t __bank_##x;
+#define BANK(x)            ((uint8_t)1U)
+#define CURRENT_BANK       _current_bank
+#define SWITCH_ROM(b)      shim_switch_rom(b)
+#define SWITCH_RAM(b)      shim_switch_ram(b)
+#define ENABLE_RAM         shim_enable_ram(1U)
+#define DISABLE_RAM        shim_enable_ram(0U)
+
+extern uint8_t _current_bank;
+void shim_switch_rom(uint8_t bank);
+
+/* Cartridge RAM: the 8 KB window at 0xA000 maps to the selected bank of
+ * shim_sram.  Library code addresses SRAM through SRAM_WINDOW. */
+extern uint8_t shim_sram[16][0x2000];
+extern uint8_t shim_ram_bank;
+#define SRAM_WINDOW        (shim_sram[shim_ram_bank])
+void shim_switch_ram(uint8_t bank);
+void shim_enable_ram(uint8_t on);
+
+/* Hardware registers are plain variables */
+extern volatile uint8_t VBK_REG, SCX_REG, SCY_REG, WX_REG, WY_REG;
+extern volatile uint8_t LY_REG, LYC_REG, STAT_REG, LCDC_REG, IE_REG, IF_REG;
+extern volatile uint8_t DIV_REG, TIMA_REG, TMA_REG, TAC_REG, KEY1_REG;
+extern volatile uint16_t sys_time;
+
+#define LCDCF_OBJON   0x02U
+#define LCDCF_OBJ16   0x04U
+#define LCDCF_WINON   0x20U
+#define STATF_LYC     0x40U
+#define STATF_BUSY    0x02U
+#define VBL_IFLAG     0x01U
+#define LCD_IFLAG     0x02U
+#define TIM_IFLAG     0x04U
+#define JOY_IFLAG     0x10U
+
+#define DISPLAY_ON    (LCDC_REG |= 0x80U)
+#define DISPLAY_OFF   (LCDC_REG &= (uint8_t)~0x80U)
+#define SHOW_BKG      (LCDC_REG |= 0x01U)
+#define HIDE_BKG      (LCDC_REG &= (uint8_t)~0x01U)
+#define SHOW_SPRITES  (LCDC_REG |= LCDCF_OBJON)
+#define HIDE_SPRITES  (LCDC_REG &= (uint8_t)~LCDCF_OBJON)
+#define SHOW_WIN      (LCDC_REG |= LCDCF_WINON)
+#define HIDE_WIN      (LCDC_REG &= (uint8_t)~LCDCF_WINON)
+#define SPRITES_8x16  (LCDC_REG |= LCDCF_OBJ16)
+#define SPRITES_8x8   (LCDC_REG &= (uint8_t)~0x04U)
+
+/* Joypad */
+#define J_RIGHT   0x01U
+#define J_LEFT    0x02U
+#define J_UP      0x04U
+#define J_DOWN    0x08U
+#define J_A       0x10U
+#define J_B       0x20U
+#define J_SELECT  0x40U
+#define J_START   0x80U
+uint8_t joypad(void);
+
+/* Frame sync: each call counts as one VBlank (sys_time++) */
+void vsync(void);
+void wait_vbl_done(void);
+
+/* Interrupts */
+void add_VBL(void (*h)(void));
+void add_LCD(void (*h)(void));
+void add_TIM(void (*h)(void));
+void set_interrupts(uint8_t flags);
+void enable_interrupts(void);
+void disable_interrupts(void);
+
+/* OAM DMA in the VBlank interrupt: high byte of the shadow OAM address,
+ * 0 = off.  The shim has no DMA; tests read the variable. */
+extern volatile uint8_t _shadow_OAM_base;
+#define DISABLE_OAM_DMA  (_shadow_OAM_base = 0U)
+#define ENABLE_OAM_DMA   (_shadow_OAM_base = 0xC0U)
+
+/* OAM */
+#define S_FLIPX     0x20U
+#define S_FLIPY     0x40U
+#define S_PRIORITY  0x80U
+void    move_sprite(uint8_t nb, uint8_t x, uint8_t y);
+void    set_sprite_tile(uint8_t nb, uint8_t tile);
+uint8_t get_sprite_tile(uint8_t nb);
+void    set_sprite_prop(uint8_t nb, uint8_t prop);
+uint8_t get_sprite_prop(uint8_t nb);
+void    hide_sprite(uint8_t nb);
+
+/* VRAM: tile data and maps (VBK_REG selects tile-index or attribute map) */
+void    set_bkg_data(uint8_t first, uint8_t nb, const uint8_t *data);
+void    set_bkg_1bpp_data(uint8_t first, uint8_t nb, const uint8_t *data);
+void    set_sprite_data(uint8_t first, uint8_t nb, const uint8_t *data);
+void    set_bkg_tile_xy(uint8_t x, uint8_t y, uint8_t t);
+uint8_t get_bkg_tile_xy(uint8_t x, uint8_t y);
+void    set_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      const uint8_t *tiles);
+void    set_bkg_based_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                            const uint8_t *tiles, uint8_t base);
+void    set_bkg_submap(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                       const uint8_t *map, uint8_t map_w);
+void    set_bkg_based_submap(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                             const uint8_t *map, uint8_t map_w, uint8_t base);
+void    get_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      uint8_t *tiles);
+void    set_win_tile_xy(uint8_t x, uint8_t y, uint8_t t);
+void    set_win_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      const uint8_t *tiles);
+void    get_win_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      uint8_t *tiles);
+void    move_win(uint8_t x, uint8_t y);
+void    move_bkg(uint8_t x, uint8_t y);
+
+#endif
@@ -0,0 +1,11 @@
+/* Host shim for <gbdk/emu_debug.h>: EMU_printf goes to stdout */
+#ifndef SHIM_EMU_DEBUG_H
+#define SHIM_EMU_DEBUG_H
+
+#include <stdio.h>
+
+#define EMU_printf(...)          printf(__VA_ARGS__)
+#define EMU_PROFILE_BEGIN(msg)
+#define EMU_PROFILE_END(msg)
+
+#endif
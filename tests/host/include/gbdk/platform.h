@@ -0,0 +1,8 @@
+/* Host shim for <gbdk/platform.h> */
+#ifndef SHIM_PLATFORM_H
+#define SHIM_PLATFORM_H
+
+#include <gb/gb.h>
+#include <gb/cgb.h>
+
+#endif
@@ -0,0 +1,41 @@
+/* Recorded hardware state of the host GBDK shim (tests/host/shim.c) */
+#ifndef GBDK_SHIM_H
+#define GBDK_SHIM_H
+
+#include <stdint.h>
+#include <gb/gb.h>
+#include <gb/cgb.h>
+
+typedef struct {
+    uint8_t y, x, tile, prop;
+} ShimOAM;
+
+extern ShimOAM         shim_oam[40];
+extern uint8_t         shim_bkg_map[2][32][32];   /* [VBK][row][col] */
+extern uint8_t         shim_win_map[2][32][32];
+extern uint8_t         shim_bkg_tile_data[2][256 * 16];  /* [VBK][tile*16] */
+extern uint8_t         shim_obj_tile_data[2][256 * 16];  /* [VBK][tile*16] */
+extern palette_color_t shim_bkg_pal[32];
+extern palette_color_t shim_obj_pal[32];
+extern uint8_t         shim_sram[16][0x2000];     /* 16 x 8 KB RAM banks */
+extern uint8_t         shim_ram_bank;
+extern uint8_t         shim_ram_enabled;
+
+/* Write counters since the last shim_reset() */
+extern uint32_t shim_oam_writes;
+extern uint32_t shim_vram_writes;      /* map + tile data bytes */
+extern uint32_t shim_pal_writes;       /* palette colours */
+extern uint32_t shim_bank_switches;
+extern uint32_t shim_ram_enables;
+
+/* Value returned by joypad() */
+extern uint8_t shim_joypad;
+
+/* Clear all recorded state and counters */
+void shim_reset(void);
+
+/* Raise the LCD STAT interrupt as on line LY_REG: runs the add_LCD()
+ * handler if LCD_IFLAG is enabled and the LYC source matches */
+void shim_lcd_interrupt(void);
+
+#endif
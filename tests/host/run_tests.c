@@ -0,0 +1,56 @@
+/* Host test runner: make host-test */
+#include <stdio.h>
+#include <stdlib.h>
+#include "test.h"
+#include "gbdk_shim.h"
+
+unsigned test_checks;
+unsigned test_failures;
+unsigned test_rng_state = 0x2545F491U;
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} Suite;
+
+static const Suite suites[] = {
+    { "sprite",         test_sprite         },
+    { "sprite_manager", test_sprite_manager },
+    { "state_machine",  test_state_machine  },
+    { "tile_collision", test_tile_collision },
+    { "replay",         test_replay         },
+    { "save",           test_save           },
+    { "sfx",            test_sfx            },
+    { "vwf",            test_vwf            },
+    { "pb16",           test_pb16           },
+    { "camera",         test_camera         },
+    { "projectile",     test_projectile     },
+    { "particle",       test_particle       },
+    { "input",          test_input          },
+    { "frame",          test_frame          },
+    { "level",          test_level          },
+    { "vram",           test_vram           },
+    { "tile_anim",      test_tile_anim      },
+    { "behaviour",      test_behaviour      },
+};
+
+int main(int argc, char **argv)
+{
+    unsigned i;
+
+    /* Optional seed for the randomized tests: host_test <seed> */
+    if (argc > 1) {
+        test_rng_state = (unsigned)strtoul(argv[1], NULL, 0);
+        if (test_rng_state == 0U) test_rng_state = 1U;
+    }
+
+    for (i = 0; i < sizeof(suites) / sizeof(suites[0]); i++) {
+        unsigned before = test_failures;
+        shim_reset();
+        suites[i].run();
+        printf("%-16s %s\n", suites[i].name,
+               (test_failures == before) ? "ok" : "FAILED");
+    }
+    printf("%u checks, %u failures\n", test_checks, test_failures);
+    return test_failures ? 1 : 0;
+}
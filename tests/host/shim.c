@@ -0,0 +1,290 @@
+/* Host implementation of the GBDK subset declared in include/gb/gb.h and
+ * include/gb/cgb.h.
+ * Hardware writes are recorded into plain arrays (see gbdk_shim.h). */
+#include <string.h>
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include "gbdk_shim.h"
+
+volatile uint8_t VBK_REG, SCX_REG, SCY_REG, WX_REG, WY_REG;
+volatile uint8_t LY_REG, LYC_REG, STAT_REG, LCDC_REG, IE_REG, IF_REG;
+volatile uint8_t DIV_REG, TIMA_REG, TMA_REG, TAC_REG, KEY1_REG;
+volatile uint16_t sys_time;
+uint8_t _current_bank = 1U;
+
+ShimOAM         shim_oam[40];
+uint8_t         shim_bkg_map[2][32][32];
+uint8_t         shim_win_map[2][32][32];
+uint8_t         shim_bkg_tile_data[2][256 * 16];
+uint8_t         shim_obj_tile_data[2][256 * 16];
+palette_color_t shim_bkg_pal[32];
+palette_color_t shim_obj_pal[32];
+uint8_t         shim_sram[16][0x2000];
+uint8_t         shim_ram_bank;
+uint8_t         shim_ram_enabled;
+
+uint32_t shim_oam_writes;
+uint32_t shim_vram_writes;
+uint32_t shim_pal_writes;
+uint32_t shim_bank_switches;
+uint32_t shim_ram_enables;
+
+uint8_t shim_joypad;
+
+volatile uint8_t _shadow_OAM_base;
+
+/* Up to four VBL handlers, run in the order they were added (like GBDK) */
+static void (*_vbl_handler[4])(void);
+static void (*_lcd_handler)(void);
+
+void shim_reset(void)
+{
+    memset(shim_oam, 0, sizeof(shim_oam));
+    memset(shim_bkg_map, 0, sizeof(shim_bkg_map));
+    memset(shim_win_map, 0, sizeof(shim_win_map));
+    memset(shim_bkg_tile_data, 0, sizeof(shim_bkg_tile_data));
+    memset(shim_obj_tile_data, 0, sizeof(shim_obj_tile_data));
+    memset(shim_bkg_pal, 0, sizeof(shim_bkg_pal));
+    memset(shim_obj_pal, 0, sizeof(shim_obj_pal));
+    memset(shim_sram, 0, sizeof(shim_sram));
+    shim_ram_bank = 0U;
+    shim_ram_enabled = 0U;
+    shim_oam_writes = shim_vram_writes = shim_pal_writes = 0U;
+    shim_bank_switches = shim_ram_enables = 0U;
+    shim_joypad = 0U;
+    _current_bank = 1U;
+    VBK_REG = SCX_REG = SCY_REG = WX_REG = WY_REG = 0U;
+    LY_REG = LYC_REG = STAT_REG = LCDC_REG = IE_REG = IF_REG = 0U;
+    DIV_REG = TIMA_REG = TMA_REG = TAC_REG = KEY1_REG = 0U;
+    sys_time = 0U;
+    memset(_vbl_handler, 0, sizeof(_vbl_handler));
+    _shadow_OAM_base = 0xC0U;
+    _lcd_handler = NULL;
+}
+
+/* --- Banking --- */
+void shim_switch_rom(uint8_t bank)
+{
+    _current_bank = bank;
+    shim_bank_switches++;
+}
+
+void shim_switch_ram(uint8_t bank)
+{
+    shim_ram_bank = (uint8_t)(bank & 0x0FU);
+}
+
+void shim_enable_ram(uint8_t on)
+{
+    shim_ram_enabled = on;
+    if (on) shim_ram_enables++;
+}
+
+/* --- Frame sync / interrupts --- */
+uint8_t joypad(void) { return shim_joypad; }
+
+void vsync(void)
+{
+    uint8_t i;
+
+    sys_time++;
+    for (i = 0; i < 4U && _vbl_handler[i]; i++) _vbl_handler[i]();
+}
+
+void wait_vbl_done(void) { vsync(); }
+
+void add_VBL(void (*h)(void))
+{
+    uint8_t i;
+
+    for (i = 0; i < 4U; i++) {
+        if (_vbl_handler[i] == h) return;
+        if (!_vbl_handler[i]) {
+            _vbl_handler[i] = h;
+            return;
+        }
+    }
+}
+void add_LCD(void (*h)(void)) { _lcd_handler = h; }
+
+void shim_lcd_interrupt(void)
+{
+    if (_lcd_handler && (IE_REG & LCD_IFLAG) &&
+        (STAT_REG & STATF_LYC) && LY_REG == LYC_REG) {
+        _lcd_handler();
+    }
+}
+void add_TIM(void (*h)(void)) { (void)h; }
+void set_interrupts(uint8_t flags) { IE_REG = flags; }
+void enable_interrupts(void) {}
+void disable_interrupts(void) {}
+
+/* --- OAM --- */
+void move_sprite(uint8_t nb, uint8_t x, uint8_t y)
+{
+    shim_oam[nb % 40U].x = x;
+    shim_oam[nb % 40U].y = y;
+    shim_oam_writes++;
+}
+
+void set_sprite_tile(uint8_t nb, uint8_t tile)
+{
+    shim_oam[nb % 40U].tile = tile;
+    shim_oam_writes++;
+}
+
+uint8_t get_sprite_tile(uint8_t nb) { return shim_oam[nb % 40U].tile; }
+
+void set_sprite_prop(uint8_t nb, uint8_t prop)
+{
+    shim_oam[nb % 40U].prop = prop;
+    shim_oam_writes++;
+}
+
+uint8_t get_sprite_prop(uint8_t nb) { return shim_oam[nb % 40U].prop; }
+
+void hide_sprite(uint8_t nb) { move_sprite(nb, 0U, 0U); }
+
+/* --- VRAM --- */
+static uint8_t _vbk(void) { return (uint8_t)(VBK_REG & 1U); }
+
+void set_bkg_data(uint8_t first, uint8_t nb, const uint8_t *data)
+{
+    uint16_t n = nb ? (uint16_t)nb : 256U;
+    uint16_t i;
+    for (i = 0; i < n * 16U; i++) {
+        shim_bkg_tile_data[_vbk()][((uint16_t)first * 16U + i) & 0x0FFFU] = data[i];
+    }
+    shim_vram_writes += n * 16U;
+}
+
+void set_bkg_1bpp_data(uint8_t first, uint8_t nb, const uint8_t *data)
+{
+    uint16_t n = nb ? (uint16_t)nb : 256U;
+    uint16_t i;
+    for (i = 0; i < n * 8U; i++) {
+        uint16_t at = ((uint16_t)first * 16U + i * 2U) & 0x0FFFU;
+        shim_bkg_tile_data[_vbk()][at]      = data[i];
+        shim_bkg_tile_data[_vbk()][at + 1U] = 0U;
+    }
+    shim_vram_writes += n * 16U;
+}
+
+void set_sprite_data(uint8_t first, uint8_t nb, const uint8_t *data)
+{
+    uint16_t n = nb ? (uint16_t)nb : 256U;
+    uint16_t i;
+    for (i = 0; i < n * 16U; i++) {
+        shim_obj_tile_data[_vbk()][((uint16_t)first * 16U + i) & 0x0FFFU] = data[i];
+    }
+    shim_vram_writes += n * 16U;
+}
+
+void set_bkg_tile_xy(uint8_t x, uint8_t y, uint8_t t)
+{
+    shim_bkg_map[_vbk()][y & 31U][x & 31U] = t;
+    shim_vram_writes++;
+}
+
+uint8_t get_bkg_tile_xy(uint8_t x, uint8_t y)
+{
+    return shim_bkg_map[_vbk()][y & 31U][x & 31U];
+}
+
+void set_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                   const uint8_t *tiles)
+{
+    set_bkg_based_tiles(x, y, w, h, tiles, 0U);
+}
+
+void set_bkg_based_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                         const uint8_t *tiles, uint8_t base)
+{
+    uint8_t r, c;
+    for (r = 0; r < h; r++) {
+        for (c = 0; c < w; c++) {
+            set_bkg_tile_xy((uint8_t)(x + c), (uint8_t)(y + r),
+                            (uint8_t)(tiles[(uint16_t)r * w + c] + base));
+        }
+    }
+}
+
+void set_bkg_submap(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                    const uint8_t *map, uint8_t map_w)
+{
+    set_bkg_based_submap(x, y, w, h, map, map_w, 0U);
+}
+
+void set_bkg_based_submap(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                          const uint8_t *map, uint8_t map_w, uint8_t base)
+{
+    uint8_t r, c;
+    for (r = 0; r < h; r++) {
+        for (c = 0; c < w; c++) {
+            uint8_t mx = (uint8_t)(x + c), my = (uint8_t)(y + r);
+            set_bkg_tile_xy(mx, my, (uint8_t)(map[(uint16_t)my * map_w + mx] + base));
+        }
+    }
+}
+
+void get_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *tiles)
+{
+    uint8_t r, c;
+    for (r = 0; r < h; r++) {
+        for (c = 0; c < w; c++) {
+            tiles[(uint16_t)r * w + c] =
+                get_bkg_tile_xy((uint8_t)(x + c), (uint8_t)(y + r));
+        }
+    }
+}
+
+void set_win_tile_xy(uint8_t x, uint8_t y, uint8_t t)
+{
+    shim_win_map[_vbk()][y & 31U][x & 31U] = t;
+    shim_vram_writes++;
+}
+
+void set_win_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                   const uint8_t *tiles)
+{
+    uint8_t r, c;
+    for (r = 0; r < h; r++) {
+        for (c = 0; c < w; c++) {
+            set_win_tile_xy((uint8_t)(x + c), (uint8_t)(y + r),
+                            tiles[(uint16_t)r * w + c]);
+        }
+    }
+}
+
+void get_win_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *tiles)
+{
+    uint8_t r, c;
+    for (r = 0; r < h; r++) {
+        for (c = 0; c < w; c++) {
+            tiles[(uint16_t)r * w + c] =
+                shim_win_map[_vbk()][(y + r) & 31U][(x + c) & 31U];
+        }
+    }
+}
+
+void move_win(uint8_t x, uint8_t y) { WX_REG = x; WY_REG = y; }
+void move_bkg(uint8_t x, uint8_t y) { SCX_REG = x; SCY_REG = y; }
+
+/* --- CGB palettes --- */
+void set_bkg_palette(uint8_t first, uint8_t nb, const palette_color_t *data)
+{
+    uint8_t i;
+    for (i = 0; i < (uint8_t)(nb * 4U); i++) {
+        shim_bkg_pal[((uint8_t)(first * 4U) + i) & 31U] = data[i];
+    }
+    shim_pal_writes += (uint32_t)nb * 4U;
+}
+
+void set_sprite_palette(uint8_t first, uint8_t nb, const palette_color_t *data)
+{
+    uint8_t i;
+    for (i = 0; i < (uint8_t)(nb * 4U); i++) {
+        shim_obj_pal[((uint8_t)(first * 4U) + i) & 31U] = data[i];
+    }
+    shim_pal_writes += (uint32_t)nb * 4U;
+}
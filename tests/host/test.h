@@ -0,0 +1,59 @@
+/* Minimal host test harness: CHECK macros and suite declarations */
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+extern unsigned test_checks;
+extern unsigned test_failures;
+
+#define CHECK(cond) do {                                                   \
+        test_checks++;                                                     \
+        if (!(cond)) {                                                     \
+            test_failures++;                                               \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);       \
+        }                                                                  \
+    } while (0)
+
+#define CHECK_EQ(a, b) do {                                                \
+        long _a = (long)(a), _b = (long)(b);                               \
+        test_checks++;                                                     \
+        if (_a != _b) {                                                    \
+            test_failures++;                                               \
+            printf("  FAIL %s:%d: %s == %s (%ld != %ld)\n",                \
+                   __FILE__, __LINE__, #a, #b, _a, _b);                    \
+        }                                                                  \
+    } while (0)
+
+/* Deterministic PRNG for randomized tests (xorshift32) */
+extern unsigned test_rng_state;
+static inline unsigned test_rand(void)
+{
+    unsigned x = test_rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return test_rng_state = x;
+}
+
+/* Suites (one per test_*.c file) */
+void test_sprite(void);
+void test_sprite_manager(void);
+void test_state_machine(void);
+void test_tile_collision(void);
+void test_replay(void);
+void test_save(void);
+void test_sfx(void);
+void test_vwf(void);
+void test_pb16(void);
+void test_camera(void);
+void test_projectile(void);
+void test_particle(void);
+void test_input(void);
+void test_frame(void);
+void test_level(void);
+void test_vram(void);
+void test_tile_anim(void);
+void test_behaviour(void);
+
+#endif
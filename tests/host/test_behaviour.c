@@ -0,0 +1,204 @@
+/* behaviour scripts: walking to walls and pit edges, turning, the
+ * per-frame instruction budget, waits, distance branches, jumps that land
+ * or fall out of the level, animations, and the caller's bank restored */
+#include <string.h>
+#include "behaviour.h"
+#include "level.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define LEVEL_BANK   7U
+#define SCRIPT_BANK  5U
+#define CALLER_BANK  3U
+#define W           32U
+#define H            8U
+#define GROUND       5U
+#define WALL         9U
+#define FEET_Y      40U     /* an 8x8 box standing on row 6 */
+
+static uint8_t map[W * H];
+static const uint8_t solid[]  = { WALL };
+static const uint8_t ground[] = { GROUND, WALL };
+static Level desc;
+
+static const uint8_t s_patrol[] = {
+    BHV_OP_WALK, 255U, BHV_OP_TURN_AT_EDGE, BHV_OP_GOTO, 0U
+};
+static const uint8_t s_spin[] = {
+    BHV_OP_TURN, BHV_OP_TURN, BHV_OP_TURN, BHV_OP_TURN, BHV_OP_TURN,
+    BHV_OP_TURN, BHV_OP_TURN, BHV_OP_TURN, BHV_OP_TURN, BHV_OP_GOTO, 0U
+};
+static const uint8_t s_shoot[] = {
+    BHV_OP_WAIT, 3U, BHV_OP_FIRE, BHV_OP_END
+};
+static const uint8_t s_near[] = {
+    BHV_OP_NEAR, 16U, 5U, BHV_OP_GOTO, 0U,
+    BHV_OP_FACE, BHV_OP_FIRE, BHV_OP_FAR, 16U, 0U, BHV_OP_WAIT, 1U, BHV_OP_GOTO, 5U
+};
+static const uint8_t s_jump[] = {
+    BHV_OP_JUMP, 4U, BHV_OP_END
+};
+static const uint8_t s_anim[] = {
+    BHV_OP_ANIM, 4U, 2U, 10U, BHV_OP_WAIT, 1U,
+    BHV_OP_ANIM, 4U, 2U, 12U, BHV_OP_WAIT, 1U,
+    BHV_OP_ANIM, 0U, 0U, 16U, BHV_OP_END
+};
+static const uint8_t * const scripts[] = {
+    s_patrol, s_spin, s_shoot, s_near, s_jump, s_anim
+};
+
+/* Ground on row 6 except a pit at columns 15..17; a wall at column 8 */
+static void build_level(void)
+{
+    uint8_t c, r;
+
+    for (r = 0; r < H; r++) {
+        for (c = 0; c < W; c++) {
+            map[r * W + c] = (r == 6U && (c < 15U || c > 17U)) ? GROUND : 1U;
+        }
+    }
+    map[5 * W + 8] = WALL;
+
+    memset(&desc, 0, sizeof(desc));
+    desc.map          = map;
+    desc.solid        = solid;
+    desc.ground       = ground;
+    desc.width        = W;
+    desc.height       = H;
+    desc.solid_count  = sizeof(solid);
+    desc.ground_count = sizeof(ground);
+}
+
+static void start(Behaviour *b, Sprite *s, uint8_t id, uint16_t x16)
+{
+    memset(s, 0, sizeof(*s));
+    s->active  = 1U;
+    s->width   = 8U;
+    s->height  = 8U;
+    s->world_y = FEET_Y;
+    behaviour_start(b, SCRIPT_BANK, scripts, id, s, x16);
+}
+
+void test_behaviour(void)
+{
+    LevelRef  ref = { LEVEL_BANK, &desc };
+    Behaviour b;
+    Sprite    s;
+    unsigned  i;
+    uint8_t   min_y, fire, fell;
+    uint16_t  max_x;
+
+    build_level();
+    shim_reset();
+    CURRENT_BANK = CALLER_BANK;
+    level_select(&ref);
+
+    /* Walks right up to the wall (box ends at x 63), turns, walks back */
+    start(&b, &s, 0U, 24U);
+    CHECK(b.script == s_patrol);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    max_x = 0U;
+    for (i = 0; i < 40U; i++) {
+        behaviour_update(&b, 0U);
+        if (b.x16 > max_x) max_x = b.x16;
+        CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    }
+    CHECK_EQ(max_x, 56);
+    CHECK_EQ(b.dx, -1);
+    CHECK_EQ(b.x16, 56U - (40U - 32U));   /* the blocked frame turns and steps */
+
+    /* ... and the other way to the left end of the level */
+    for (i = 0; i < 50U; i++) behaviour_update(&b, 0U);
+    CHECK_EQ(b.dx, 1);
+    CHECK_EQ(b.x16, 2);
+
+    /* Stops with its leading edge on the last ground column before the pit */
+    start(&b, &s, 0U, 100U);
+    max_x = 0U;
+    for (i = 0; i < 30U; i++) {
+        behaviour_update(&b, 0U);
+        if (b.x16 > max_x) max_x = b.x16;
+    }
+    CHECK_EQ(max_x, 112);
+    CHECK_EQ(b.dx, -1);
+    CHECK_EQ(s.world_y, FEET_Y);
+
+    /* A loop that never waits runs BHV_BUDGET instructions a frame */
+    start(&b, &s, 1U, 24U);
+    behaviour_update(&b, 0U);
+    CHECK_EQ(b.pc, BHV_BUDGET);
+    CHECK_EQ(b.dx, 1);
+    behaviour_update(&b, 0U);
+    CHECK_EQ(b.pc, 6);                 /* turn, goto, 6 turns */
+    CHECK_EQ(b.dx, -1);
+    CHECK_EQ(b.x16, 24);
+
+    /* WAIT n takes n frames; events last one update */
+    start(&b, &s, 2U, 24U);
+    for (i = 0; i < 3U; i++) {
+        behaviour_update(&b, 0U);
+        CHECK_EQ(b.events, 0);
+    }
+    behaviour_update(&b, 0U);
+    CHECK_EQ(b.events, BHV_EV_FIRE);
+    behaviour_update(&b, 0U);
+    CHECK_EQ(b.events, 0);
+    CHECK_EQ(b.pc, 3);
+
+    /* Distance branches and facing the player */
+    start(&b, &s, 3U, 100U);
+    fire = 0U;
+    for (i = 0; i < 10U; i++) {
+        behaviour_update(&b, 160U);
+        fire |= b.events;
+    }
+    CHECK_EQ(fire, 0);
+    behaviour_update(&b, 90U);
+    CHECK_EQ(b.events, BHV_EV_FIRE);
+    CHECK_EQ(b.dx, -1);
+    behaviour_update(&b, 110U);
+    CHECK_EQ(b.events, BHV_EV_FIRE);
+    CHECK_EQ(b.dx, 1);
+    behaviour_update(&b, 10U);          /* fires, then FAR leaves the loop */
+    behaviour_update(&b, 10U);
+    CHECK_EQ(b.events, 0);
+    CHECK_EQ(b.pc, 0);
+
+    /* A jump rises 4+3+2+1 px and lands back on the ground */
+    start(&b, &s, 4U, 24U);
+    min_y = FEET_Y;
+    for (i = 0; i < 20U; i++) {
+        behaviour_update(&b, 0U);
+        if (s.world_y < min_y) min_y = s.world_y;
+    }
+    CHECK_EQ(min_y, FEET_Y - 10U);
+    CHECK_EQ(s.world_y, FEET_Y);
+    CHECK(!b.airborne);
+    CHECK_EQ(b.vy, 0);
+
+    /* Over the pit it falls out of the level and the script stops */
+    start(&b, &s, 4U, 124U);
+    fell = 0U;
+    for (i = 0; i < 20U; i++) {
+        behaviour_update(&b, 0U);
+        fell |= b.events;
+    }
+    CHECK_EQ(fell, BHV_EV_FELL);
+    CHECK(b.script == NULL);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+
+    /* ANIM restarts the frames only when the animation changes */
+    start(&b, &s, 5U, 24U);
+    behaviour_update(&b, 0U);
+    CHECK_EQ(b.anim_start, 4);
+    CHECK_EQ(b.anim_frames, 2);
+    CHECK_EQ(s.anim_speed, 10);
+    s.anim_frame = 1U;
+    behaviour_update(&b, 0U);
+    CHECK_EQ(s.anim_speed, 12);
+    CHECK_EQ(s.anim_frame, 1);
+    behaviour_update(&b, 0U);
+    CHECK_EQ(b.anim_start, 0);
+    CHECK_EQ(b.anim_frames, 1);        /* 0 frames means 1 */
+    CHECK_EQ(s.anim_frame, 0);
+}
@@ -0,0 +1,151 @@
+/* camera: dead-zone follow against the old one-pixel player scroll,
+ * map bounds, look-ahead, smoothing limits and published tile edges */
+#include "camera.h"
+#include "test.h"
+
+/* 48x18 gameplay level */
+#define MAP_W  48U
+#define MAP_H  18U
+
+static void check_edges(void)
+{
+    CHECK_EQ(camera.col_left, camera.x >> 3);
+    CHECK_EQ(camera.col_right, (camera.x + 159U) >> 3);
+    CHECK_EQ(camera.row_top, camera.y >> 3);
+    CHECK_EQ(camera.row_bottom, (camera.y + 143U) >> 3);
+}
+
+/* Edges of a view past column 255 (8-bit, wrapped) */
+static void check_edges_wrapped(void)
+{
+    CHECK_EQ(camera.col_left, (uint8_t)(camera.x >> 3));
+    CHECK_EQ(camera.col_right, (uint8_t)((camera.x + 159U) >> 3));
+}
+
+void test_camera(void)
+{
+    uint16_t px, prev_x, ref_x;
+    uint8_t  screen_x, flags, prev_col;
+    unsigned n;
+
+    /* Bounds derived from the map size */
+    camera_init(MAP_W, MAP_H);
+    CHECK_EQ(camera.max_x, 224);
+    CHECK_EQ(camera.max_y, 0);
+    CHECK_EQ(camera.x, 0);
+    check_edges();
+    camera_init(20U, 18U);
+    CHECK_EQ(camera.max_x, 0);
+    camera_init(255U, 64U);
+    CHECK_EQ(camera.max_x, 255U * 8U - 160U);
+    CHECK_EQ(camera.max_y, 64U * 8U - 144U);
+
+    /* Dead-zone 60..100, one pixel per frame, no look-ahead: identical to
+     * the scroll that used to live in player_update() */
+    camera_init(MAP_W, MAP_H);
+    camera_set_deadzone(60U, 100U, 0U, 143U);
+    camera_set_smoothing(0U, 1U);
+    camera_snap(20U, 64U);
+    px = 20U;
+    ref_x = camera.x;
+    for (n = 0; n < 2000U; n++) {
+        if ((test_rand() % 3U) == 0U) {
+            if (px > 8U) px--;
+        } else if (px < 376U) {
+            px++;
+        }
+        camera_update(px, 64U);
+        screen_x = (uint8_t)(px - ref_x);
+        if (screen_x > 100U && ref_x < 224U)  ref_x++;
+        else if (screen_x < 60U && ref_x > 0U) ref_x--;
+        CHECK_EQ(camera.x, ref_x);
+        CHECK_EQ(camera.y, 0);
+    }
+    CHECK(camera.x <= 224U);
+
+    /* Snap puts the focus at the left dead-zone edge, clamped */
+    camera_snap(200U, 0U);
+    CHECK_EQ(camera.x, 140);
+    camera_snap(30U, 0U);
+    CHECK_EQ(camera.x, 0);
+    camera_snap(1000U, 0U);
+    CHECK_EQ(camera.x, 224);
+    check_edges();
+
+    /* Look-ahead: walking right the view leads the player by look_max */
+    camera_init(255U, MAP_H);
+    camera_set_deadzone(60U, 100U, 0U, 143U);
+    camera_set_lookahead(16U, 16U);
+    camera_set_smoothing(2U, 2U);
+    px = 60U;
+    camera_snap(px, 0U);
+    for (n = 0; n < 300U; n++) camera_update(++px, 0U);
+    CHECK_EQ((uint16_t)(px - camera.x), 100U - 16U);
+    /* Standing still keeps the look-ahead */
+    for (n = 0; n < 50U; n++) camera_update(px, 0U);
+    CHECK_EQ((uint16_t)(px - camera.x), 100U - 16U);
+    /* Turning around swings it to the other side */
+    for (n = 0; n < 150U; n++) camera_update(--px, 0U);
+    CHECK((uint16_t)(px - camera.x) < 60U + 16U);   /* smoothing lag */
+    for (n = 0; n < 50U; n++) camera_update(px, 0U);
+    CHECK_EQ((uint16_t)(px - camera.x), 60U + 16U);
+
+    /* Whatever the focus does, the camera moves at most max_step per
+     * frame, stays in bounds, and gains at most one column per frame */
+    camera_set_min_x(0U);
+    camera_snap(500U, 0U);
+    prev_col = camera.col_right;
+    for (n = 0; n < 3000U; n++) {
+        px = (uint16_t)(test_rand() % (255U * 8U));
+        prev_x = camera.x;
+        flags = camera_update(px, 0U);
+        CHECK((uint16_t)(camera.x - prev_x) <= 2U || (uint16_t)(prev_x - camera.x) <= 2U);
+        CHECK(camera.x <= camera.max_x);
+        CHECK((uint8_t)(camera.col_right - prev_col) <= 1U ||
+              (uint8_t)(prev_col - camera.col_right) <= 1U);
+        CHECK_EQ((flags & CAMERA_COL_CHANGED) != 0U,
+                 (prev_x >> 3) != (camera.x >> 3));
+        check_edges();
+        prev_col = camera.col_right;
+    }
+
+    /* Raised lower bound (ring buffer): the camera never goes left of it */
+    camera_snap(800U, 0U);
+    camera_set_min_x(700U);
+    for (n = 0; n < 500U; n++) {
+        camera_update(0U, 0U);
+        CHECK(camera.x >= 700U);
+    }
+    CHECK_EQ(camera.x, 700);
+    camera_set_min_x(5000U);
+    CHECK_EQ(camera.min_x, camera.max_x);
+
+    /* Endless map (width 0): a far right bound, and moving the world back
+     * 2048 px keeps the view, the 8-bit edges and the follow state */
+    camera_init(0U, MAP_H);
+    CHECK_EQ(camera.max_x, CAMERA_MAX_X);
+    camera_set_deadzone(60U, 100U, 0U, 143U);
+    camera_set_smoothing(0U, 1U);
+    camera_snap(3000U, 0U);
+    camera_set_min_x(2900U);
+    prev_x   = camera.x;
+    prev_col = camera.col_left;
+    camera_shift_x(2048U);
+    CHECK_EQ(camera.x, prev_x - 2048U);
+    CHECK_EQ(camera.min_x, 2900U - 2048U);
+    CHECK_EQ(camera.col_left, prev_col);
+    check_edges_wrapped();
+    camera_update(3000U - 2048U, 0U);
+    CHECK_EQ(camera.x, prev_x - 2048U);
+    camera_shift_x(2048U);
+    CHECK_EQ(camera.min_x, 0);
+
+    /* Vertical follow on a tall map */
+    camera_init(20U, 64U);
+    camera_set_deadzone(60U, 100U, 40U, 100U);
+    camera_snap(80U, 40U);
+    CHECK_EQ(camera.y, 0);
+    for (px = 40U; px < 400U; px++) camera_update(80U, px);
+    CHECK_EQ(camera.y, 399U - 100U);
+    check_edges();
+}
@@ -0,0 +1,106 @@
+/* frame pacing: scroll committed in VBlank only for finished frames, OAM
+ * DMA held off during a tick, lag counting, stalls and resyncs after
+ * deliberate waits, and the OBJ limit line */
+#include "frame.h"
+#include "input.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+void test_frame(void)
+{
+    unsigned i;
+
+    frame_init();
+    CHECK_EQ(frame_begin(), 1);
+    CHECK_EQ(_shadow_OAM_base, 0);      /* no DMA while the tick runs */
+    frame_scx = 5U;
+    frame_scy = 3U;
+    frame_end();
+    CHECK(_shadow_OAM_base != 0U);
+    CHECK_EQ(SCX_REG, 0);               /* nothing reaches the LCD mid-frame */
+
+    CHECK_EQ(frame_begin(), 1);
+    CHECK_EQ(SCX_REG, 5);
+    CHECK_EQ(SCY_REG, 3);
+    frame_end();
+    CHECK_EQ(frame_lag_count(), 0);
+
+    /* Overrun: the VBlank inside the tick keeps showing the last frame */
+    frame_begin();
+    frame_scx = 9U;
+    vsync();
+    CHECK_EQ(SCX_REG, 5);
+    CHECK_EQ(_shadow_OAM_base, 0);
+    frame_end();
+    CHECK_EQ(frame_begin(), 1 + FRAME_CATCHUP_MAX);
+    CHECK_EQ(frame_lag_count(), 1);
+    CHECK_EQ(SCX_REG, 9);
+    frame_end();
+
+    /* Two VBlanks late: catch-up is capped, both frames count as lag */
+    frame_begin();
+    vsync();
+    vsync();
+    frame_end();
+    CHECK_EQ(frame_begin(), 1 + (FRAME_CATCHUP_MAX < 2U ? FRAME_CATCHUP_MAX : 2U));
+    CHECK_EQ(frame_lag_count(), 3);
+    frame_end();
+
+    /* A blocking wait (state fade) is a stall, not lag */
+    frame_begin();
+    for (i = 0; i < FRAME_STALL_VBLS + 1U; i++) vsync();
+    frame_end();
+    CHECK_EQ(frame_begin(), 1);
+    CHECK_EQ(frame_lag_count(), 3);
+    frame_end();
+
+    /* ... and so is a short one the tick declares with frame_resync() */
+    frame_begin();
+    vsync();
+    vsync();
+    frame_resync();
+    frame_end();
+    CHECK_EQ(frame_begin(), 1);
+    CHECK_EQ(frame_lag_count(), 3);
+    frame_end();
+
+    /* Input runs from its own VBL handler next to the frame's */
+    input_init();
+    shim_joypad = J_A;
+    frame_begin();
+    input_update();
+    CHECK_EQ(input_pressed(), J_A);
+    /* A catch-up tick in the same frame: still held, not pressed again */
+    input_update();
+    CHECK_EQ(input_held(), J_A);
+    CHECK_EQ(input_pressed(), 0);
+    frame_end();
+
+    /* OBJ limit: off from the LYC line on, back on at VBlank */
+    SHOW_SPRITES;
+    frame_set_obj_limit(112U);
+    CHECK_EQ(LYC_REG, 111);
+    CHECK(IE_REG & LCD_IFLAG);
+    LY_REG = 50U;
+    shim_lcd_interrupt();
+    CHECK(LCDC_REG & LCDCF_OBJON);
+    LY_REG = 111U;
+    shim_lcd_interrupt();
+    CHECK(!(LCDC_REG & LCDCF_OBJON));
+    frame_begin();
+    CHECK(LCDC_REG & LCDCF_OBJON);
+    frame_end();
+
+    /* The VBL handler leaves OBJ alone when the limit did not hide them */
+    HIDE_SPRITES;
+    vsync();
+    CHECK(!(LCDC_REG & LCDCF_OBJON));
+    SHOW_SPRITES;
+
+    /* Limit off: the interrupt is no longer taken */
+    frame_set_obj_limit(0U);
+    CHECK(!(IE_REG & LCD_IFLAG));
+    CHECK(!(STAT_REG & STATF_LYC));
+    shim_lcd_interrupt();
+    CHECK(LCDC_REG & LCDCF_OBJON);
+}
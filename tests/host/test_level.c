@@ -0,0 +1,354 @@
+/* level descriptors: selection from any bank, one bank switch per batch
+ * with the caller's bank restored, tile sets, ground spans at the map
+ * edges, tiles through the VRAM allocator, column copies into the BG
+ * ring and checkpoints; generated levels: seeded chunk picks, flat start,
+ * no right edge, cache misses, streaming, collision, probes that leave
+ * the streamed ring alone and streaming on across column 255 -> 0 */
+#include <string.h>
+#include "level.h"
+#include "vram.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define LEVEL_BANK  7U
+#define CALLER_BANK 3U
+#define W          40U
+#define H           4U
+#define GROUND      5U
+#define WALL        9U
+
+static uint8_t  map[W * H];
+static uint8_t  attr[W * H];
+static uint8_t  tiles[3 * 16];
+static const palette_color_t pals[4] = { 1U, 2U, 3U, 4U };
+static const uint8_t  solid[]  = { WALL, 200U };
+static const uint8_t  ground[] = { GROUND, WALL };
+static const uint16_t checkpoints[] = { 64U, 128U, 200U };
+static const uint16_t many_checkpoints[LEVEL_MAX_CHECKPOINTS + 2U] = { 8U, 16U };
+
+static Level desc;
+
+/* Generated level: pattern 1 has a pit, a ledge and a block; GEN_W
+ * columns (10 chunks) are probed, 2 of them flat */
+#define GEN_W      80U
+#define GEN_PROBE  72U     /* a column well outside the first 32 */
+#define G          LEVEL_GEN_GROUND
+#define SKY        1U
+#define SOIL      20U
+#define DEEP      21U
+#define LEDGE     30U
+static const uint8_t gen_chunks[2 * LEVEL_CHUNK_W] = {
+    G, G, G, G, G, G, G, G,
+    G, 0, 0, LEVEL_GEN_LEDGE, LEVEL_GEN_LEDGE, 0, G | LEVEL_GEN_BLOCK, G
+};
+static const LevelGen gen = {
+    gen_chunks, 2U, 2U, 10U, 6U,
+    { SKY, GROUND, SOIL, DEEP, WALL, LEDGE },
+    { 0U, 1U, 1U, 1U, 1U, 2U }
+};
+static Level gen_desc;
+
+static uint8_t has_pit(uint8_t chunk)
+{
+    return level_tile((uint8_t)(chunk * LEVEL_CHUNK_W + 1U), 10U) != GROUND;
+}
+
+static void test_generated(void)
+{
+    LevelRef ref = { LEVEL_BANK, &gen_desc };
+    Sprite   box;
+    uint8_t  row10[GEN_W];
+    uint8_t  ring[sizeof(level_gen_map)];
+    uint8_t  c, k, pits, h, slot, differ;
+
+    gen_desc              = desc;
+    gen_desc.map          = NULL;
+    gen_desc.attr_map     = NULL;
+    gen_desc.gen          = &gen;
+    gen_desc.width        = 0U;
+    gen_desc.height       = 16U;
+    gen_desc.goal_x16     = 0U;
+    gen_desc.checkpoint_count = 0U;
+
+    CURRENT_BANK = CALLER_BANK;
+    level_select(&ref);
+    level_set_seed(0x1234U);
+
+    /* Cells come from the WRAM cache: no bank switching */
+    shim_bank_switches = 0U;
+    CHECK_EQ(level_tile(3U, 9U), SKY);
+    CHECK_EQ(level_tile(3U, 10U), GROUND);
+    CHECK_EQ(level_tile(3U, 13U), SOIL);
+    CHECK_EQ(level_tile(3U, 14U), DEEP);
+    CHECK_EQ(level_tile(3U, 16U), 0);            /* below the level */
+    CHECK(level_tile(255U, 10U) != 0);          /* no right edge   */
+    CHECK_EQ(shim_bank_switches, 0);
+
+    /* Flat start */
+    CHECK(!has_pit(0U));
+    CHECK(!has_pit(1U));
+
+    /* Each chunk after it is one whole pattern, and both occur */
+    pits = 0U;
+    for (k = 2U; k < GEN_W / LEVEL_CHUNK_W; k++) {
+        c = (uint8_t)(k * LEVEL_CHUNK_W);
+        if (!has_pit(k)) {
+            CHECK_EQ(level_tile((uint8_t)(c + 3U), 6U), SKY);
+            CHECK_EQ(level_tile((uint8_t)(c + 6U), 9U), SKY);
+            continue;
+        }
+        pits++;
+        CHECK_EQ(level_tile((uint8_t)(c + 2U), 10U), SKY);
+        CHECK_EQ(level_tile((uint8_t)(c + 3U), 6U), LEDGE);
+        CHECK_EQ(level_tile((uint8_t)(c + 6U), 9U), WALL);
+        CHECK_EQ(level_tile((uint8_t)(c + 6U), 10U), GROUND);
+
+        /* Collision reads the same cells */
+        memset(&box, 0, sizeof(box));
+        box.active  = 1U;
+        box.width   = 8U;
+        box.height  = 8U;
+        box.world_y = 72U;
+        CHECK(level_box_solid(&box, (uint16_t)(c + 6U) * 8U));
+        CHECK(!level_box_solid(&box, (uint16_t)(c + 2U) * 8U));
+        CHECK(!level_ground_span((uint16_t)(c + 1U) * 8U, (uint16_t)(c + 5U) * 8U + 7U, 10U));
+        CHECK(level_ground_span((uint16_t)(c + 1U) * 8U, (uint16_t)(c + 6U) * 8U, 10U));
+    }
+    CHECK(pits > 0U && pits < 8U);
+    CHECK_EQ(shim_bank_switches, 0);
+
+    /* Columns evicted from the cache are made again the same way, and
+     * so is the whole level from the same seed */
+    for (c = 0; c < GEN_W; c++) row10[c] = level_tile(c, 10U);
+    for (c = GEN_W; c; c--) CHECK_EQ(level_tile((uint8_t)(c - 1U), 10U), row10[c - 1U]);
+    level_set_seed(0x1234U);
+    for (c = GEN_W; c; c -= 5U) CHECK_EQ(level_tile((uint8_t)(c - 1U), 10U), row10[c - 1U]);
+    level_set_seed(0x4321U);
+    differ = 0U;
+    for (c = 0; c < GEN_W; c++) differ |= (uint8_t)(level_tile(c, 10U) != row10[c]);
+    CHECK(differ);
+
+    /* Streaming: cache column = ring column, tiles offset, attributes */
+    vram_init();
+    vram_alloc(VRAM_BG, 4U);
+    h = level_load_tiles();
+    level_set_seed(0x1234U);
+    memset(shim_bkg_map, 0xEE, sizeof(shim_bkg_map));
+    level_set_columns(6U, 4U);
+    CHECK_EQ(shim_bkg_map[0][10][8], GROUND + 4U);
+    CHECK_EQ(shim_bkg_map[1][10][8], 1);
+    CHECK_EQ(shim_bkg_map[0][13][9], SOIL + 4U);
+    CHECK_EQ(shim_bkg_map[0][0][6], SKY + 4U);
+    CHECK_EQ(shim_bkg_map[1][0][6], 0);
+    CHECK_EQ(shim_bkg_map[0][10][10], 0xEE);
+    CHECK_EQ(shim_bkg_map[0][16][8], 0xEE);     /* below the level */
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK_EQ(VBK_REG, 0);
+
+    /* Probes outside the streamed columns leave the ring (and the BG map
+     * built from it) alone */
+    level_set_columns(0U, LEVEL_GEN_COLS);
+    memcpy(ring, level_gen_map, sizeof(ring));
+    CHECK_EQ(level_tile(GEN_PROBE, 10U), row10[GEN_PROBE]);
+    CHECK_EQ(level_tile(GEN_PROBE + 1U, 10U), row10[GEN_PROBE + 1U]);
+    CHECK_EQ(level_ground_span(GEN_PROBE * 8U, GEN_PROBE * 8U + 15U, 10U),
+             (uint8_t)(row10[GEN_PROBE] == GROUND || row10[GEN_PROBE + 1U] == GROUND));
+    memset(&box, 0, sizeof(box));
+    box.active  = 1U;
+    box.width   = 8U;
+    box.height  = 8U;
+    box.world_y = 72U;
+    (void)level_box_solid(&box, GEN_PROBE * 8U + 4U);
+    CHECK(!memcmp(ring, level_gen_map, sizeof(ring)));
+    slot = GEN_PROBE % 32U;                       /* column 8 is still cached */
+    level_gen_map[9U * LEVEL_GEN_COLS + slot] = 0x77U;
+    CHECK_EQ(level_tile(slot, 9U), 0x77);
+    level_gen_map[9U * LEVEL_GEN_COLS + slot] = ring[9U * LEVEL_GEN_COLS + slot];
+    vram_release(h);
+}
+
+/* Streaming an endless level one column at a time, as the game does,
+ * across the 8-bit column wrap: no transition, new chunks after column
+ * 255, probes behind the streamed column still see the earlier lap, and
+ * world X may move back by 2048 px without changing the level */
+static void test_generated_wrap(void)
+{
+    static uint8_t lap[2][256];
+    LevelRef ref = { LEVEL_BANK, &gen_desc };
+    uint16_t i;
+    uint8_t  c, h, differ;
+
+    CURRENT_BANK = CALLER_BANK;
+    level_select(&ref);
+    level_set_seed(0x1234U);
+    vram_init();
+    vram_alloc(VRAM_BG, 4U);
+    h = level_load_tiles();
+
+    differ = 0U;
+    for (i = 0; i < 512U; i++) {
+        c = (uint8_t)i;
+        level_set_columns(c, 1U);
+        lap[i >> 8][c] = level_tile(c, 10U);
+        CHECK_EQ(shim_bkg_map[0][10][c % 32U], lap[i >> 8][c] + 4U);
+        CHECK(lap[i >> 8][c] == GROUND || lap[i >> 8][c] == SKY);
+        if (c % LEVEL_CHUNK_W == 0U) CHECK_EQ(lap[i >> 8][c], GROUND);
+        if (i >= 256U) differ |= (uint8_t)(lap[1][c] != lap[0][c]);
+
+        /* 50 columns behind the stream head: still the earlier lap */
+        if (i == 300U) {
+            CHECK_EQ(level_tile(250U, 10U), lap[0][250]);
+            CHECK_EQ(level_tile(40U, 10U), lap[1][40]);
+        }
+    }
+    CHECK(differ);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+
+    /* Same cells at world X and world X - 2048 */
+    CHECK_EQ(level_ground_span(4000U, 4007U, 10U),
+             level_ground_span(4000U - 2048U, 4007U - 2048U, 10U));
+    CHECK_EQ(level_ground_span(4000U, 4007U, 10U),
+             (uint8_t)(lap[1][(uint8_t)(4000U >> 3)] == GROUND));
+
+    /* The same seed streams the same two laps again */
+    level_set_seed(0x1234U);
+    for (i = 0; i < 512U; i++) {
+        c = (uint8_t)i;
+        level_set_columns(c, 1U);
+        CHECK_EQ(level_tile(c, 10U), lap[i >> 8][c]);
+    }
+    vram_release(h);
+}
+
+/* Ground on row 3 except a pit at columns 10..12; a wall at column 20 */
+static void build_level(void)
+{
+    uint8_t c, r;
+
+    for (r = 0; r < H; r++) {
+        for (c = 0; c < W; c++) {
+            map[r * W + c]  = (r == 3U && (c < 10U || c > 12U)) ? GROUND : 1U;
+            attr[r * W + c] = (uint8_t)(r == 3U ? 1U : 0U);
+        }
+    }
+    map[2 * W + 20] = WALL;
+    for (c = 0; c < sizeof(tiles); c++) tiles[c] = (uint8_t)(c + 1U);
+
+    memset(&desc, 0, sizeof(desc));
+    desc.tiles            = tiles;
+    desc.palettes         = pals;
+    desc.map              = map;
+    desc.attr_map         = attr;
+    desc.solid            = solid;
+    desc.ground           = ground;
+    desc.checkpoints      = checkpoints;
+    desc.goal_x16         = 300U;
+    desc.width            = W;
+    desc.height           = H;
+    desc.tile_count       = 3U;
+    desc.tile_codec       = TILE_CODEC_RAW;
+    desc.palette_count    = 1U;
+    desc.solid_count      = sizeof(solid);
+    desc.ground_count     = sizeof(ground);
+    desc.checkpoint_count = 3U;
+    desc.player_x         = 20U;
+    desc.player_y         = 8U;
+}
+
+void test_level(void)
+{
+    LevelRef ref = { LEVEL_BANK, &desc };
+    Sprite   box;
+    unsigned i;
+    uint8_t  h;
+
+    build_level();
+    shim_reset();
+    vram_init();
+    CURRENT_BANK = CALLER_BANK;
+
+    /* Selection copies the descriptor and switches to the level's bank once */
+    level_select(&ref);
+    CHECK_EQ(shim_bank_switches, 2);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK_EQ(level_bank, LEVEL_BANK);
+    CHECK_EQ(level.width, W);
+    CHECK_EQ(level.goal_x16, 300);
+    CHECK_EQ(level.player_x, 20);
+    CHECK_EQ(level.checkpoint_count, 3);
+    CHECK_EQ(level_checkpoint(0), 64);
+    CHECK_EQ(level_checkpoint(2), 200);
+
+    /* Tile classes from the WRAM sets */
+    CHECK(level_is_solid(WALL));
+    CHECK(level_is_solid(200U));
+    CHECK(!level_is_solid(GROUND));
+    CHECK(level_is_ground(GROUND));
+    CHECK(level_is_ground(WALL));
+    CHECK(!level_is_ground(1U));
+
+    /* Cell reads, and nothing outside the map */
+    CHECK_EQ(level_tile(20U, 2U), WALL);
+    CHECK_EQ(level_tile(0U, 3U), GROUND);
+    CHECK_EQ(level_tile(W, 3U), 0);
+    CHECK_EQ(level_tile(0U, H), 0);
+
+    /* Ground spans: a batch of cells costs one switch there and back */
+    shim_bank_switches = 0U;
+    CHECK(level_ground_span(0U, 79U, 3U));
+    CHECK_EQ(shim_bank_switches, 2);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK(!level_ground_span(80U, 103U, 3U));        /* over the pit      */
+    CHECK(level_ground_span(80U, 104U, 3U));         /* one pixel of edge */
+    CHECK(level_ground_span(79U, 79U, 3U));
+    CHECK(!level_ground_span(0U, 100U, 2U));         /* no ground in row  */
+    CHECK(level_ground_span(304U, 400U, 3U));        /* clipped at the edge */
+    shim_bank_switches = 0U;
+    CHECK(!level_ground_span(W * 8U, W * 8U + 15U, 3U));  /* right of map */
+    CHECK(!level_ground_span(0U, 8U, H));
+    CHECK_EQ(shim_bank_switches, 0);
+
+    /* Sprite box against the solid set */
+    memset(&box, 0, sizeof(box));
+    box.active = 1U;
+    box.width  = 8U;
+    box.height = 8U;
+    box.world_y = 16U;
+    CHECK(!level_box_solid(&box, 150U));
+    CHECK(level_box_solid(&box, 155U));
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+
+    /* Tiles are read in the level's bank and go where the allocator says */
+    vram_alloc(VRAM_BG, 4U);
+    h = level_load_tiles();
+    CHECK_EQ(vram_tile(h), 4);
+    for (i = 0; i < sizeof(tiles); i++) {
+        CHECK_EQ(shim_bkg_tile_data[0][4U * 16U + i], tiles[i]);
+    }
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+
+    /* Columns land in the ring at column % 32, tiles (offset to the
+     * loaded range) and attributes */
+    memset(shim_bkg_map, 0xEE, sizeof(shim_bkg_map));
+    level_set_columns(30U, 4U);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK_EQ(VBK_REG, 0);
+    CHECK_EQ(shim_bkg_map[0][3][30], GROUND + 4U);
+    CHECK_EQ(shim_bkg_map[0][3][1], GROUND + 4U);
+    CHECK_EQ(shim_bkg_map[0][2][1], 1 + 4U);
+    CHECK_EQ(shim_bkg_map[1][3][0], 1);
+    CHECK_EQ(shim_bkg_map[1][0][0], 0);
+    CHECK_EQ(shim_bkg_map[0][3][2], 0xEE);      /* column 34 not loaded */
+    CHECK_EQ(shim_bkg_map[0][H][30], 0xEE);     /* below the map        */
+    vram_release(h);
+
+    /* Too many checkpoints are clamped to the WRAM copy */
+    desc.checkpoints      = many_checkpoints;
+    desc.checkpoint_count = LEVEL_MAX_CHECKPOINTS + 2U;
+    level_select(&ref);
+    CHECK_EQ(level.checkpoint_count, LEVEL_MAX_CHECKPOINTS);
+    CHECK_EQ(level_checkpoint(1), 16);
+
+    test_generated();
+    test_generated_wrap();
+}
@@ -0,0 +1,140 @@
+/* particle ring: OBJ slot and tile mapping, motion, expiry, drop-oldest when full,
+ * the per-band scanline budget and seeded spread */
+#include <string.h>
+#include "particle.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define FIRST_OBJ  27U
+#define OBJS       12U
+#define PAL        3U
+#define TILE_BASE  40U   /* kind tiles 0..2 -> OBJ tiles 40..42 */
+
+/* Particles drawn per 8-line band must stay within PART_LINE_MAX */
+static void check_budget(void)
+{
+    unsigned band[32], i, b, y;
+
+    memset(band, 0, sizeof(band));
+    for (i = 0; i < OBJS; i++) {
+        y = shim_oam[FIRST_OBJ + i].y;
+        if (y == 0U) continue;
+        y -= 16U;
+        for (b = y >> 3; b <= (y + 15U) >> 3; b++) band[b]++;
+    }
+    for (b = 0; b < 32U; b++) CHECK(band[b] <= PART_LINE_MAX);
+}
+
+void test_particle(void)
+{
+    static const ParticleKind still = { 0U, 5U, 0U, 0U, 0, 0 };
+    static const ParticleKind fall  = { 1U, 200U, 0U, 0U, 16, 0 };
+    static const ParticleKind spray = { 2U, 30U, 24U, 24U, -8, 2 };
+    unsigned i, step, shown;
+    uint8_t  obj;
+    uint8_t  oam[OBJS * sizeof(shim_oam[0])];
+
+    particle_init(FIRST_OBJ, OBJS, PAL, TILE_BASE);
+    CHECK_EQ(particle_count(), 0);
+    CHECK_EQ(shim_oam[FIRST_OBJ].prop, PAL);
+    CHECK_EQ(shim_oam[FIRST_OBJ + OBJS - 1U].prop, PAL);
+    CHECK_EQ(shim_oam[FIRST_OBJ + OBJS].prop, 0);   /* next slot untouched */
+
+    /* A still particle is drawn at its world position, camera relative */
+    particle_emit(&still, 130U, 50U, 1U);
+    CHECK_EQ(particle_count(), 1);
+    particle_update(100U);
+    CHECK_EQ(shim_oam[FIRST_OBJ].x, 30 + 8);
+    CHECK_EQ(shim_oam[FIRST_OBJ].y, 50 + 16);
+    CHECK_EQ(shim_oam[FIRST_OBJ].tile, 40);
+
+    /* ... and hidden and released once its life runs out */
+    for (i = 0; i < 3U; i++) particle_update(100U);
+    CHECK_EQ(particle_count(), 1);
+    particle_update(100U);
+    CHECK_EQ(particle_count(), 0);
+    CHECK_EQ(shim_oam[FIRST_OBJ].y, 0);
+
+    /* 12.4 motion: vy_bias 16 moves one pixel per frame */
+    particle_clear();
+    particle_emit(&fall, 20U, 10U, 1U);
+    for (i = 0; i < 10U; i++) particle_update(0U);
+    CHECK_EQ(shim_oam[FIRST_OBJ].y, 20 + 16);
+    /* Falling below the screen expires it */
+    for (i = 0; i < 140U; i++) particle_update(0U);
+    CHECK_EQ(particle_count(), 0);
+
+    /* Moving the world back keeps the screen position; particles left of
+     * dx expire */
+    particle_clear();
+    particle_emit(&still, 2100U, 50U, 1U);
+    particle_emit(&still, 2000U, 60U, 1U);
+    particle_shift_x(2048U);
+    particle_update(0U);
+    CHECK_EQ(shim_oam[FIRST_OBJ].x, 52 + 8);
+    CHECK_EQ(shim_oam[FIRST_OBJ + 1U].y, 0);
+    particle_clear();
+
+    /* Leaving the camera view expires it */
+    particle_emit(&still, 10U, 50U, 1U);
+    particle_update(40U);
+    CHECK_EQ(particle_count(), 0);
+
+    /* A full ring drops the oldest particles */
+    particle_clear();
+    particle_emit(&fall, 10U, 0U, (uint8_t)OBJS);
+    CHECK_EQ(particle_count(), OBJS);
+    particle_emit(&still, 100U, 100U, 3U);
+    CHECK_EQ(particle_count(), OBJS);
+    particle_update(0U);
+    /* Ring slots 0..2 (the oldest) now hold the new particles */
+    for (i = 0; i < 3U; i++) CHECK_EQ(shim_oam[FIRST_OBJ + i].tile, 40);
+    for (; i < OBJS; i++) CHECK_EQ(shim_oam[FIRST_OBJ + i].tile, 41);
+    /* count is clamped to the ring */
+    particle_emit(&still, 100U, 100U, 200U);
+    CHECK_EQ(particle_count(), OBJS);
+
+    /* Stacked on one line: only PART_LINE_MAX are shown, newest first */
+    particle_clear();
+    particle_emit(&fall, 60U, 40U, (uint8_t)OBJS);
+    particle_update(0U);
+    check_budget();
+    shown = 0;
+    for (i = 0; i < OBJS; i++) shown += shim_oam[FIRST_OBJ + i].y != 0U;
+    CHECK_EQ(shown, PART_LINE_MAX);
+    CHECK(shim_oam[FIRST_OBJ + OBJS - 1U].y != 0U);
+    CHECK_EQ(shim_oam[FIRST_OBJ].y, 0);
+
+    /* Random bursts: bounded count, budget always respected, and every
+     * slot is either hidden or inside the ring's OBJ block */
+    particle_clear();
+    for (step = 0; step < 2000U; step++) {
+        if ((test_rand() % 3U) == 0U) {
+            particle_emit(&spray, (uint16_t)(test_rand() % 160U),
+                          (uint8_t)(8U + test_rand() % 120U),
+                          (uint8_t)(1U + test_rand() % 8U));
+        }
+        particle_update(0U);
+        CHECK(particle_count() <= OBJS);
+        check_budget();
+        for (i = 0; i < OBJS; i++) {
+            obj = (uint8_t)(FIRST_OBJ + i);
+            if (shim_oam[obj].y) CHECK_EQ(shim_oam[obj].tile, 42);
+        }
+    }
+    particle_clear();
+    CHECK_EQ(particle_count(), 0);
+    for (i = 0; i < OBJS; i++) CHECK_EQ(shim_oam[FIRST_OBJ + i].y, 0);
+
+    /* The same seed throws the same spray */
+    particle_seed(0x2024U);
+    particle_emit(&spray, 80U, 60U, 6U);
+    for (step = 0; step < 8U; step++) particle_update(0U);
+    memcpy(oam, &shim_oam[FIRST_OBJ], sizeof(oam));
+    particle_clear();
+    particle_seed(0x2024U);
+    particle_emit(&spray, 80U, 60U, 6U);
+    for (step = 0; step < 8U; step++) particle_update(0U);
+    CHECK(!memcmp(oam, &shim_oam[FIRST_OBJ], sizeof(oam)));
+    particle_clear();
+}
@@ -0,0 +1,80 @@
+/* pb16: golden stream from the asset builder, then random tile sets
+ * round-tripped through a reference encoder into BG and OBJ VRAM */
+#include <string.h>
+#include "pb16.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define MAX_TILES  64U
+
+/* Same packing as pb16_compress() in tools/gbc_asset_builder.py */
+static unsigned encode(uint8_t *out, const uint8_t *in, unsigned len)
+{
+    unsigned i, j, n = 0, ctrl_at;
+    uint8_t  back2 = 0U, back1 = 0U;
+
+    for (i = 0; i < len; i += 8U) {
+        ctrl_at = n++;
+        out[ctrl_at] = 0U;
+        for (j = 0; j < 8U; j++) {
+            uint8_t v = in[i + j];
+            out[ctrl_at] = (uint8_t)(out[ctrl_at] << 1);
+            if (v == back2) out[ctrl_at] |= 1U;
+            else            out[n++] = v;
+            back2 = back1;
+            back1 = v;
+        }
+    }
+    return n;
+}
+
+/* 2bpp tiles with the row-to-row coherence of real art */
+static void random_tiles(uint8_t *d, unsigned len)
+{
+    unsigned i;
+    for (i = 0; i < len; i++) {
+        if (i >= 2U && (test_rand() % 4U) != 0U) d[i] = d[i - 2U];
+        else d[i] = (uint8_t)test_rand();
+    }
+}
+
+void test_pb16(void)
+{
+    static const uint8_t raw[16] = {
+        0x3C, 0x3C, 0x42, 0x7E, 0x42, 0x7E, 0x42, 0x7E,
+        0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    static const uint8_t golden[] = {
+        0x0F, 0x3C, 0x3C, 0x42, 0x7E, 0x4F, 0x7E, 0x00, 0x00
+    };
+    static uint8_t tiles[MAX_TILES * 16U], packed[MAX_TILES * 18U];
+    uint8_t  ram[16];
+    unsigned n, nb, len, first;
+    const uint8_t *end;
+
+    /* Format matches the generator byte for byte */
+    CHECK_EQ(encode(packed, raw, 16U), sizeof(golden));
+    CHECK(memcmp(packed, golden, sizeof(golden)) == 0);
+    end = pb16_unpack(ram, golden, 16U);
+    CHECK(memcmp(ram, raw, 16U) == 0);
+    CHECK(end == golden + sizeof(golden));
+
+    /* Random tile sets, odd counts crossing the 4-tile chunks */
+    for (n = 0; n < 200U; n++) {
+        nb    = 1U + test_rand() % MAX_TILES;
+        first = test_rand() % (256U - nb);
+        random_tiles(tiles, nb * 16U);
+        len = encode(packed, tiles, nb * 16U);
+        CHECK(len <= nb * 18U);
+
+        pb16_set_bkg_data((uint8_t)first, (uint8_t)nb, packed);
+        CHECK(memcmp(&shim_bkg_tile_data[0][first * 16U], tiles, nb * 16U) == 0);
+
+        pb16_set_sprite_data((uint8_t)first, (uint8_t)nb, packed);
+        CHECK(memcmp(&shim_obj_tile_data[0][first * 16U], tiles, nb * 16U) == 0);
+    }
+
+    /* A blank tile set is all repeats: one control byte per 8 bytes */
+    memset(tiles, 0, 32U);
+    CHECK_EQ(encode(packed, tiles, 32U), 4);
+}
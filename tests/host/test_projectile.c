@@ -0,0 +1,244 @@
+/* projectile pool: movement, expiry, camera and wall despawn (map read in
+ * its own bank, or through a tile reader), batched sprite hits, OBJ slots,
+ * and a random run against a naive model */
+#include <string.h>
+#include "projectile.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define FIRST_OBJ  3U
+#define PAL        2U
+#define WALL       7U
+#define MAP_BANK   5U
+
+/* 32x4 map with a wall column at x = 20 */
+static uint8_t map[4 * 32];
+static const uint8_t solid[] = { 9U, WALL, 200U };
+
+static void build_map(void)
+{
+    uint8_t r;
+    memset(map, 1, sizeof(map));
+    for (r = 0; r < 4U; r++) map[r * 32U + 20U] = WALL;
+}
+
+static unsigned reader_calls;
+
+static uint8_t reader_tile(uint8_t col, uint8_t row)
+{
+    (void)row;
+    reader_calls++;
+    return (col == 52U) ? WALL : 1U;
+}
+
+/* Naive model: fixed slots with an active flag */
+typedef struct {
+    uint16_t x;
+    uint8_t  y, life, owner, active;
+    int8_t   vx, vy;
+} Ref;
+
+static Ref ref[PROJ_MAX];
+
+static unsigned ref_live(void)
+{
+    unsigned i, n = 0;
+    for (i = 0; i < PROJ_MAX; i++) n += ref[i].active;
+    return n;
+}
+
+static void ref_update(uint16_t cam)
+{
+    unsigned i;
+    uint16_t sx;
+    uint8_t  col, row;
+    for (i = 0; i < PROJ_MAX; i++) {
+        Ref *p = &ref[i];
+        if (!p->active) continue;
+        if (--p->life == 0U) { p->active = 0; continue; }
+        p->x = (uint16_t)(p->x + p->vx);
+        p->y = (uint8_t)(p->y + p->vy);
+        sx = (uint16_t)(p->x - cam + 8U);
+        if (sx > 176U || p->y >= 144U) { p->active = 0; continue; }
+        col = (uint8_t)((p->x + 4U) >> 3);
+        row = (uint8_t)((uint8_t)(p->y + 4U) >> 3);
+        if (col < 32U && row < 4U && map[row * 32U + col] == WALL) p->active = 0;
+    }
+}
+
+/* Every live model projectile is drawn at one of the pool's OBJ slots */
+static void check_against_ref(uint16_t cam)
+{
+    unsigned i, j, n = projectile_count(), found;
+    uint8_t  used[PROJ_MAX] = { 0 };
+
+    CHECK_EQ(n, ref_live());
+    for (i = 0; i < PROJ_MAX; i++) {
+        if (!ref[i].active) continue;
+        found = 0;
+        for (j = 0; j < n; j++) {
+            if (!used[j] &&
+                shim_oam[FIRST_OBJ + j].x == (uint8_t)(ref[i].x - cam + 8U) &&
+                shim_oam[FIRST_OBJ + j].y == (uint8_t)(ref[i].y + 16U) &&
+                shim_oam[FIRST_OBJ + j].tile == (uint8_t)(10U + ref[i].owner)) {
+                used[j] = 1;
+                found = 1;
+                break;
+            }
+        }
+        CHECK(found);
+    }
+    for (j = n; j < PROJ_MAX; j++) CHECK_EQ(shim_oam[FIRST_OBJ + j].y, 0);
+}
+
+void test_projectile(void)
+{
+    Sprite   target;
+    unsigned i, n, step;
+    uint16_t cam;
+
+    build_map();
+    projectile_init(FIRST_OBJ, PAL);
+    CHECK_EQ(projectile_count(), 0);
+
+    /* Movement, prop and OBJ placement */
+    CHECK_EQ(projectile_spawn(40U, 30U, 3, -1, 10U, 10U, PROJ_OWNER_PLAYER), 0);
+    CHECK_EQ(projectile_spawn(60U, 30U, -2, 0, 10U, 11U, PROJ_OWNER_ENEMY), 1);
+    projectile_update(0U);
+    projectile_draw();
+    CHECK_EQ(shim_oam[FIRST_OBJ].x, 43 + 8);
+    CHECK_EQ(shim_oam[FIRST_OBJ].y, 29 + 16);
+    CHECK_EQ(shim_oam[FIRST_OBJ].tile, 10);
+    CHECK_EQ(shim_oam[FIRST_OBJ].prop, PAL);
+    CHECK_EQ(shim_oam[FIRST_OBJ + 1].x, 58 + 8);
+    CHECK_EQ(shim_oam[FIRST_OBJ + 1].prop, PAL | S_FLIPX);
+
+    /* Expiry after life frames, freed OBJ slots hidden */
+    for (i = 0; i < 8U; i++) projectile_update(0U);
+    CHECK_EQ(projectile_count(), 2);
+    projectile_update(0U);
+    projectile_draw();
+    CHECK_EQ(projectile_count(), 0);
+    CHECK_EQ(shim_oam[FIRST_OBJ].y, 0);
+    CHECK_EQ(shim_oam[FIRST_OBJ + 1].y, 0);
+
+    /* Leaving the camera view on either side, or off the top */
+    projectile_spawn(300U, 30U, 4, 0, 255U, 10U, 0U);   /* right of view  */
+    projectile_spawn(95U, 30U, -4, 0, 255U, 10U, 0U);   /* left of view   */
+    projectile_spawn(150U, 2U, 0, -4, 255U, 10U, 0U);   /* wraps off top  */
+    projectile_update(100U);
+    CHECK_EQ(projectile_count(), 0);
+
+    /* Wall tile (solid list via lookup table) stops a shot */
+    CURRENT_BANK = 1U;
+    projectile_set_map(MAP_BANK, map, 32U, 4U, solid, sizeof(solid));
+    CHECK_EQ(CURRENT_BANK, 1);
+    projectile_spawn(140U, 10U, 2, 0, 255U, 10U, 0U);
+    for (i = 0; i < 7U; i++) projectile_update(0U);
+    CHECK_EQ(projectile_count(), 1);   /* centre at 154 + 4: column 19 */
+    shim_bank_switches = 0U;
+    projectile_update(0U);
+    CHECK_EQ(projectile_count(), 0);   /* centre at 156 + 4: column 20 */
+    /* One switch to the map's bank per update, then back to the caller's */
+    CHECK_EQ(shim_bank_switches, 2);
+    CHECK_EQ(CURRENT_BANK, 1);
+    /* ... but passes below the map */
+    projectile_spawn(140U, 40U, 2, 0, 255U, 10U, 0U);
+    for (i = 0; i < 10U; i++) projectile_update(0U);
+    CHECK_EQ(projectile_count(), 1);
+    projectile_clear();
+    CHECK_EQ(projectile_count(), 0);
+
+    /* Through a tile reader (a 100-column map with a wall at column 52) */
+    projectile_set_map_reader(reader_tile, MAP_BANK, 100U, 4U, solid, sizeof(solid));
+    reader_calls = 0U;
+    projectile_spawn(396U, 10U, 2, 0, 255U, 10U, 0U);
+    for (i = 0; i < 7U; i++) projectile_update(300U);
+    CHECK_EQ(projectile_count(), 1);   /* centre at 414: column 51 */
+    CHECK_EQ(reader_calls, 7);
+    projectile_update(300U);
+    CHECK_EQ(projectile_count(), 0);   /* centre at 416: column 52 */
+
+    /* Width 0: no right edge, columns wrap (column 52 again at 2464) */
+    projectile_set_map_reader(reader_tile, MAP_BANK, 0U, 4U, solid, sizeof(solid));
+    projectile_spawn(2444U, 10U, 2, 0, 255U, 10U, 0U);
+    for (i = 0; i < 7U; i++) projectile_update(2400U);
+    CHECK_EQ(projectile_count(), 1);
+    projectile_update(2400U);
+    CHECK_EQ(projectile_count(), 0);
+
+    /* Moving the world back: shots left of dx are dropped */
+    projectile_spawn(2450U, 10U, 0, 0, 255U, 10U, 0U);
+    projectile_spawn(2000U, 10U, 0, 0, 255U, 10U, 0U);
+    projectile_shift_x(2048U);
+    CHECK_EQ(projectile_count(), 1);
+    projectile_update(300U);
+    projectile_draw();
+    CHECK_EQ(shim_oam[FIRST_OBJ].x, 2450 - 2048 - 300 + 8);
+    projectile_clear();
+    projectile_set_map(MAP_BANK, map, 32U, 4U, solid, sizeof(solid));
+
+    /* Pool capacity */
+    for (i = 0; i < PROJ_MAX; i++) {
+        CHECK(projectile_spawn(10U, 10U, 0, 0, 5U, 10U, 0U) != PROJ_NONE);
+    }
+    CHECK_EQ(projectile_spawn(10U, 10U, 0, 0, 5U, 10U, 0U), PROJ_NONE);
+    CHECK_EQ(projectile_count(), PROJ_MAX);
+    projectile_clear();
+    CHECK_EQ(projectile_spawn(10U, 10U, 0, 0, 0U, 10U, 0U), PROJ_NONE);
+
+    /* Batched hits: only the given owner, only overlapping boxes */
+    memset(&target, 0, sizeof(target));
+    target.active   = 1U;
+    target.world_x  = 50U;   /* screen-relative, camera 100 */
+    target.world_y  = 40U;
+    target.width    = 16U;
+    target.height   = 16U;
+    projectile_spawn(100U + 50U - 6U, 40U, 0, 0, 99U, 10U, PROJ_OWNER_PLAYER); /* box ends at 50: miss */
+    projectile_spawn(100U + 50U - 5U, 40U, 0, 0, 99U, 10U, PROJ_OWNER_PLAYER); /* 1 px overlap: hit */
+    projectile_spawn(100U + 60U, 52U, 0, 0, 99U, 10U, PROJ_OWNER_PLAYER);      /* hit  */
+    projectile_spawn(100U + 60U, 54U, 0, 0, 99U, 10U, PROJ_OWNER_PLAYER);      /* below: miss */
+    projectile_spawn(100U + 60U, 45U, 0, 0, 99U, 11U, PROJ_OWNER_ENEMY);       /* other owner */
+    projectile_update(100U);
+    CHECK_EQ(projectile_hit(&target, PROJ_OWNER_PLAYER), 2);
+    CHECK_EQ(projectile_count(), 3);
+    CHECK_EQ(projectile_hit(&target, PROJ_OWNER_PLAYER), 0);
+    target.active = 0U;
+    CHECK_EQ(projectile_hit(&target, PROJ_OWNER_ENEMY), 0);
+    target.active = 1U;
+    CHECK_EQ(projectile_hit(&target, PROJ_OWNER_ENEMY), 1);
+    CHECK_EQ(projectile_hit(NULL, PROJ_OWNER_ENEMY), 0);
+    projectile_clear();
+
+    /* Random run against the model (swap-remove keeps everything) */
+    memset(ref, 0, sizeof(ref));
+    cam = 0U;
+    for (step = 0; step < 3000U; step++) {
+        n = test_rand() % 3U;
+        while (n--) {
+            uint16_t x  = (uint16_t)(cam + test_rand() % 160U);
+            uint8_t  y  = (uint8_t)(test_rand() % 140U);
+            int8_t   vx = (int8_t)((int)(test_rand() % 9U) - 4);
+            int8_t   vy = (int8_t)((int)(test_rand() % 5U) - 2);
+            uint8_t  life  = (uint8_t)(1U + test_rand() % 90U);
+            uint8_t  owner = (uint8_t)(test_rand() & 1U);
+            uint8_t  idx = projectile_spawn(x, y, vx, vy, life, (uint8_t)(10U + owner), owner);
+            if (idx == PROJ_NONE) {
+                CHECK_EQ(ref_live(), PROJ_MAX);
+                break;
+            }
+            for (i = 0; i < PROJ_MAX; i++) {
+                if (!ref[i].active) {
+                    ref[i].x = x; ref[i].y = y; ref[i].vx = vx; ref[i].vy = vy;
+                    ref[i].life = life; ref[i].owner = owner; ref[i].active = 1;
+                    break;
+                }
+            }
+        }
+        if ((test_rand() % 4U) == 0U && cam < 90U) cam++;
+        projectile_update(cam);
+        ref_update(cam);
+        projectile_draw();
+        check_against_ref(cam);
+    }
+}
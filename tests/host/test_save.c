@@ -0,0 +1,93 @@
+/* save: double-buffered CRC slots, dirty-block commits, torn writes */
+#include <string.h>
+#include "save.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define SLOT(n)     (&shim_sram[SAVE_SRAM_BANK][(n) * 0x80U])
+#define SEQ(n)      (SLOT(n)[6])
+
+void test_save(void)
+{
+    uint8_t before[0x100];
+    unsigned i, changed;
+
+    /* Blank SRAM: defaults, nothing to load */
+    save_data.high_score = 1234U;
+    CHECK_EQ(save_load(), 0);
+    CHECK_EQ(save_data.high_score, 0);
+    CHECK_EQ(shim_ram_enabled, 0);
+
+    /* First commit writes a complete slot 0 */
+    SAVE_SET(high_score, 500U);
+    CHECK(save_commit() > 0);
+    CHECK_EQ(shim_ram_enabled, 0);
+    CHECK_EQ(SLOT(0)[0], 'S');
+    CHECK_EQ(save_commit(), 0);               /* nothing new to write */
+
+    /* Reload after a "power cycle" */
+    memset(&save_data, 0, sizeof(save_data));
+    CHECK_EQ(save_load(), 1);
+    CHECK_EQ(save_data.high_score, 500);
+
+    /* Commits alternate slots; newest sequence number wins */
+    SAVE_SET(best_checkpoint, 2U);
+    CHECK(save_commit() > 0);
+    CHECK_EQ((uint8_t)(SEQ(1) - SEQ(0)), 1);
+    SAVE_SET(options, SAVE_OPT_SOUND_OFF);
+    save_commit();
+    CHECK_EQ((uint8_t)(SEQ(0) - SEQ(1)), 1);
+    memset(&save_data, 0, sizeof(save_data));
+    CHECK_EQ(save_load(), 1);
+    CHECK_EQ(save_data.high_score, 500);
+    CHECK_EQ(save_data.best_checkpoint, 2);
+    CHECK_EQ(save_data.options, SAVE_OPT_SOUND_OFF);
+
+    /* Spare slot is rewritten in full once, then only the dirty bytes */
+    SAVE_SET(high_score, 501U);
+    save_commit();
+    SAVE_SET(high_score, 502U);
+    memcpy(before, shim_sram[SAVE_SRAM_BANK], sizeof(before));
+    save_commit();
+    for (i = 0, changed = 0; i < sizeof(before); i++) {
+        if (before[i] != shim_sram[SAVE_SRAM_BANK][i]) changed++;
+    }
+    /* low byte of the score, CRC (<= 2) and the sequence number */
+    CHECK(changed >= 2U && changed <= 4U);
+
+    /* Marking without changing anything still commits, writing no payload */
+    save_mark(0U, sizeof(SaveData));
+    CHECK(save_commit() >= 1U);
+
+    /* Power lost mid-write: torn payload in the newest slot */
+    SAVE_SET(high_score, 999U);
+    save_commit();
+    {
+        uint8_t newest = (uint8_t)((int8_t)(uint8_t)(SEQ(1) - SEQ(0)) > 0);
+        SLOT(newest)[8] ^= 0x5AU;
+    }
+    memset(&save_data, 0, sizeof(save_data));
+    CHECK_EQ(save_load(), 1);
+    CHECK_EQ(save_data.high_score, 502);      /* previous commit survives */
+
+    /* Sequence numbers wrap */
+    for (i = 0; i < 300U; i++) {
+        SAVE_SET(best_time, (uint16_t)i);
+        save_commit();
+    }
+    memset(&save_data, 0, sizeof(save_data));
+    CHECK_EQ(save_load(), 1);
+    CHECK_EQ(save_data.best_time, 299);
+
+    /* Layout change: an old version loads as defaults */
+    SLOT(0)[2] = (uint8_t)(SAVE_VERSION + 1U);
+    SLOT(1)[2] = (uint8_t)(SAVE_VERSION + 1U);
+    CHECK_EQ(save_load(), 0);
+    CHECK_EQ(save_data.best_time, 0);
+
+    /* Save data never spills into the replay bank */
+    for (i = 0, changed = 0; i < 0x2000U; i++) {
+        if (shim_sram[1][i]) changed++;
+    }
+    CHECK_EQ(changed, 0);
+}
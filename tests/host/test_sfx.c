@@ -0,0 +1,152 @@
+/* sfx: per-frame register writes of every preset, channel choice,
+ * priority preemption and the music mask (built with SFX_TEST_MODE) */
+#include "sfx.h"
+#include "sfx_defs.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+typedef struct {
+    uint8_t tick;   /* sfx_update() call (1 = first after sfx_play) */
+    uint8_t reg;
+    uint8_t val;
+} Expect;
+
+#define END  { 0U, 0U, 0U }
+
+/* Golden write sequences from res/sfx/default/definition.py */
+static const Expect jump_seq[] = {
+    { 1, 0x10, 0x16 }, { 1, 0x11, 0x80 }, { 1, 0x12, 0xA2 },
+    { 1, 0x13, 0xB2 }, { 1, 0x14, 0x86 }, END
+};
+static const Expect fall_seq[] = {
+    { 1, 0x10, 0x2B }, { 1, 0x11, 0x40 }, { 1, 0x12, 0xF5 },
+    { 1, 0x13, 0x6B }, { 1, 0x14, 0x87 }, END
+};
+static const Expect hit_seq[] = {
+    { 1, 0x20, 0x00 }, { 1, 0x21, 0xF2 }, { 1, 0x22, 0x55 },
+    { 1, 0x23, 0x80 }, { 5, 0x22, 0x67 }, END
+};
+static const Expect checkpoint_seq[] = {
+    { 1, 0x16, 0x80 }, { 1, 0x17, 0xC3 }, { 1, 0x18, 0x39 },
+    { 1, 0x19, 0x87 }, { 7, 0x17, 0xC4 }, { 7, 0x18, 0x7B },
+    { 7, 0x19, 0x87 }, END
+};
+static const Expect blip_seq[] = {
+    { 1, 0x16, 0x40 }, { 1, 0x17, 0x81 }, { 1, 0x18, 0x83 },
+    { 1, 0x19, 0x87 }, END
+};
+static const Expect laser_seq[] = {
+    { 1, 0x10, 0x00 }, { 1, 0x11, 0xC0 }, { 1, 0x12, 0xD1 },
+    { 1, 0x13, 0xB6 }, { 1, 0x14, 0x87 }, { 3, 0x13, 0x9D },
+    { 3, 0x14, 0x87 }, { 5, 0x13, 0x7B }, { 5, 0x14, 0x87 },
+    { 7, 0x13, 0x4F }, { 7, 0x14, 0x87 }, END
+};
+
+typedef struct {
+    uint8_t       id;
+    uint8_t       channel;    /* SFX_CHn it should land on when all idle */
+    uint8_t       last_tick;  /* tick of the final frame (then idle)     */
+    const Expect *seq;
+} Preset;
+
+static const Preset presets[] = {
+    { SFX_JUMP,       SFX_CH1, 13, jump_seq       },
+    { SFX_FALL,       SFX_CH1, 41, fall_seq       },
+    { SFX_HIT,        SFX_CH4, 17, hit_seq        },
+    { SFX_CHECKPOINT, SFX_CH2, 25, checkpoint_seq },
+    { SFX_BLIP,       SFX_CH2,  5, blip_seq       },
+    { SFX_LASER,      SFX_CH1, 13, laser_seq      },
+};
+
+static void check_preset(const Preset *p)
+{
+    const Expect *e = p->seq;
+    uint8_t tick, start, n;
+
+    sfx_init();
+    sfx_test_log_len = 0U;
+    CHECK_EQ(sfx_play(p->id, SFX_PRIO_DEFAULT), 1);
+    CHECK_EQ(sfx_is_busy(p->channel), 1);
+    CHECK_EQ(sfx_test_log_len, 0);           /* nothing before the VBlank */
+
+    for (tick = 1; tick <= p->last_tick + 2U; tick++) {
+        start = sfx_test_log_len;
+        sfx_update();
+        for (n = start; n != sfx_test_log_len; n++, e++) {
+            const sfx_write_t *w = &sfx_test_log[n & (SFX_TEST_LOG_SIZE - 1U)];
+            CHECK_EQ(e->tick, tick);
+            CHECK_EQ(w->reg, e->reg);
+            CHECK_EQ(w->val, e->val);
+        }
+        CHECK_EQ(sfx_is_busy(p->channel), tick < p->last_tick);
+    }
+    CHECK_EQ(e->tick, 0);                    /* every expected write seen */
+}
+
+void test_sfx(void)
+{
+    unsigned i;
+    uint8_t before;
+
+    CHECK_EQ(sizeof(presets) / sizeof(presets[0]), SFX_COUNT);
+    for (i = 0; i < SFX_COUNT; i++) {
+        check_preset(&presets[i]);
+    }
+
+    /* Init powers the APU on before anything else */
+    sfx_test_log_len = 0U;
+    sfx_init();
+    CHECK_EQ(sfx_test_log[0].reg, 0x26);
+    CHECK_EQ(sfx_test_log[0].val, 0x80);
+    CHECK_EQ(sfx_test_log_len, 3);
+
+    /* Idle: no writes at all */
+    before = sfx_test_log_len;
+    for (i = 0; i < 100U; i++) sfx_update();
+    CHECK_EQ(sfx_test_log_len, before);
+    CHECK_EQ(sfx_play(SFX_COUNT, SFX_PRIO_HIGH), 0);
+
+    /* A second jump takes the idle CH2, registers moved by 5 */
+    CHECK_EQ(sfx_play(SFX_JUMP, SFX_PRIO_DEFAULT), 1);
+    CHECK_EQ(sfx_play(SFX_JUMP, SFX_PRIO_DEFAULT), 1);
+    CHECK_EQ(sfx_is_busy(SFX_CH1 | SFX_CH2), 1);
+    before = sfx_test_log_len;
+    sfx_update();
+    CHECK_EQ((uint8_t)(sfx_test_log_len - before), 10);
+    CHECK_EQ(sfx_test_log[(uint8_t)(before + 5U) & (SFX_TEST_LOG_SIZE - 1U)].reg, 0x15);
+    CHECK_EQ(sfx_test_log[(uint8_t)(before + 9U) & (SFX_TEST_LOG_SIZE - 1U)].reg, 0x19);
+
+    /* Both busy with equal priority: a third jump restarts one of them */
+    CHECK_EQ(sfx_play(SFX_JUMP, SFX_PRIO_DEFAULT), 1);
+
+    /* Priority: low blip loses to the chime, forced-high blip wins */
+    sfx_stop_all();
+    CHECK_EQ(sfx_play(SFX_BLIP, SFX_PRIO_DEFAULT), 1);
+    CHECK_EQ(sfx_play(SFX_CHECKPOINT, SFX_PRIO_DEFAULT), 1);
+    CHECK_EQ(sfx_play(SFX_BLIP, SFX_PRIO_DEFAULT), 0);
+    CHECK_EQ(sfx_play(SFX_BLIP, SFX_PRIO_HIGH), 1);
+    CHECK_EQ(sfx_play(SFX_CHECKPOINT, SFX_PRIO_DEFAULT), 0);
+
+    /* Stop silences only the channels in use (CH2 envelope) */
+    before = sfx_test_log_len;
+    sfx_stop_all();
+    CHECK_EQ((uint8_t)(sfx_test_log_len - before), 1);
+    CHECK_EQ(sfx_test_log[before & (SFX_TEST_LOG_SIZE - 1U)].reg, 0x17);
+    CHECK_EQ(sfx_test_log[before & (SFX_TEST_LOG_SIZE - 1U)].val, 0x00);
+    CHECK_EQ(sfx_is_busy(SFX_CH1 | SFX_CH2 | SFX_CH3 | SFX_CH4), 0);
+
+    /* Music mask: reserved channels are never used or written */
+    CHECK_EQ(sfx_play(SFX_LASER, SFX_PRIO_DEFAULT), 1);
+    sfx_set_music_mask(SFX_CH1 | SFX_CH2 | SFX_CH3);
+    CHECK_EQ(sfx_is_busy(SFX_CH1), 0);       /* dropped, no writes */
+    CHECK_EQ(sfx_play(SFX_JUMP, SFX_PRIO_HIGH), 0);
+    CHECK_EQ(sfx_play(SFX_HIT, SFX_PRIO_DEFAULT), 1);
+    before = sfx_test_log_len;
+    for (i = 0; i < 40U; i++) sfx_update();
+    CHECK_EQ((uint8_t)(sfx_test_log_len - before), 5);
+    before = sfx_test_log_len;
+    sfx_stop_all();
+    CHECK_EQ(sfx_test_log_len, before);
+    sfx_set_music_mask(0U);
+    CHECK_EQ(sfx_play(SFX_JUMP, SFX_PRIO_DEFAULT), 1);
+}
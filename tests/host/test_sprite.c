@@ -0,0 +1,58 @@
+/* sprites_collide() */
+#include <string.h>
+#include "sprite.h"
+#include "test.h"
+
+static Sprite make(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+    Sprite s;
+    memset(&s, 0, sizeof(s));
+    s.world_x = x;
+    s.world_y = y;
+    s.width   = w;
+    s.height  = h;
+    s.active  = 1U;
+    return s;
+}
+
+void test_sprite(void)
+{
+    Sprite a = make(10, 10, 8, 8);
+    Sprite b = make(17, 17, 8, 8);
+
+    /* Overlap by one pixel on both axes */
+    CHECK_EQ(sprites_collide(&a, &b), 1);
+    CHECK_EQ(sprites_collide(&b, &a), 1);
+
+    /* Touching edges do not collide */
+    b.world_x = 18;
+    CHECK_EQ(sprites_collide(&a, &b), 0);
+    b.world_x = 17;
+    b.world_y = 18;
+    CHECK_EQ(sprites_collide(&a, &b), 0);
+
+    /* Inactive sprites never collide */
+    b.world_y = 12;
+    CHECK_EQ(sprites_collide(&a, &b), 1);
+    b.active = 0U;
+    CHECK_EQ(sprites_collide(&a, &b), 0);
+    b.active = 1U;
+
+    /* Hitbox inset replaces the full bounds */
+    a = make(0, 0, 16, 16);
+    b = make(14, 0, 8, 8);
+    CHECK_EQ(sprites_collide(&a, &b), 1);
+    a.hitbox_x = 2;
+    a.hitbox_w = 12;            /* covers x 2..13 */
+    CHECK_EQ(sprites_collide(&a, &b), 0);
+    b.world_x = 13;
+    CHECK_EQ(sprites_collide(&a, &b), 1);
+
+    /* Zero hitbox size falls back to width/height */
+    a = make(0, 0, 8, 8);
+    a.hitbox_x = 4;             /* box 4..11 */
+    b = make(11, 0, 1, 1);
+    CHECK_EQ(sprites_collide(&a, &b), 1);
+    b.world_x = 12;
+    CHECK_EQ(sprites_collide(&a, &b), 0);
+}
@@ -0,0 +1,104 @@
+/* sprite_manager pool, OAM placement and tile lookups */
+#include <stddef.h>
+#include "sprite.h"
+#include "sprite_manager.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+static void test_pool(void)
+{
+    Sprite *s[SPRITE_MANAGER_MAX];
+    Sprite *extra;
+    uint8_t i;
+
+    sprite_manager_init();
+    for (i = 0; i < SPRITE_MANAGER_MAX; i++) {
+        s[i] = sprite_manager_alloc(i, 1U, 8U, 8U, 0U, 1U);
+        CHECK(s[i] != NULL);
+    }
+    /* Pool exhausted */
+    extra = sprite_manager_alloc(0U, 1U, 8U, 8U, 0U, 1U);
+    CHECK(extra == NULL);
+
+    /* Freeing returns the slot and hides its OBJ */
+    s[3]->world_x = 40;
+    s[3]->world_y = 40;
+    sprite_manager_update_hw(s[3], 0U, 0U);
+    CHECK_EQ(shim_oam[3].x, 48);
+    sprite_manager_free(s[3]);
+    CHECK_EQ(shim_oam[3].x, 0);
+    CHECK_EQ(shim_oam[3].y, 0);
+    extra = sprite_manager_alloc(7U, 2U, 16U, 16U, 4U, 2U);
+    CHECK(extra == s[3]);
+    CHECK_EQ(extra->obj_id, 7);
+    CHECK_EQ(extra->hitbox_w, 0);
+    CHECK_EQ(extra->anim_frame, 0);
+    CHECK_EQ(extra->active, 1);
+
+    sprite_manager_free(NULL);   /* no-op */
+}
+
+static void test_update_hw(void)
+{
+    Sprite *s;
+    uint32_t writes;
+
+    sprite_manager_init();
+    s = sprite_manager_alloc(4U, 2U, 16U, 16U, 0U, 2U);
+    s->world_x = 100;
+    s->world_y = 50;
+
+    writes = shim_oam_writes;
+    sprite_manager_update_hw(s, 20U, 10U);
+    CHECK_EQ(shim_oam_writes - writes, 2);
+    CHECK_EQ(shim_oam[4].x, 100 - 20 + 8);
+    CHECK_EQ(shim_oam[4].y, 50 - 10 + 16);
+    CHECK_EQ(shim_oam[5].x, 100 - 20 + 16);
+    CHECK_EQ(shim_oam[5].y, 50 - 10 + 16);
+
+    /* Inactive sprites are not drawn */
+    s->active = 0U;
+    writes = shim_oam_writes;
+    sprite_manager_update_hw(s, 0U, 0U);
+    CHECK_EQ(shim_oam_writes, writes);
+}
+
+static void test_first_collision(void)
+{
+    Sprite *a, *b, *c;
+
+    sprite_manager_init();
+    a = sprite_manager_alloc(0U, 1U, 8U, 8U, 0U, 1U);
+    b = sprite_manager_alloc(1U, 1U, 8U, 8U, 0U, 1U);
+    c = sprite_manager_alloc(2U, 1U, 8U, 8U, 0U, 1U);
+    a->world_x = 0;   a->world_y = 0;
+    b->world_x = 100; b->world_y = 100;
+    c->world_x = 4;   c->world_y = 4;
+    CHECK(sprite_manager_first_collision(a) == c);
+    CHECK(sprite_manager_first_collision(b) == NULL);
+    c->active = 0U;
+    CHECK(sprite_manager_first_collision(a) == NULL);
+}
+
+static void test_tile_at(void)
+{
+    static const uint8_t map[3 * 4] = {
+        1, 2, 3, 4,
+        5, 6, 7, 8,
+        9, 10, 11, 12
+    };
+    CHECK_EQ(sprite_manager_tile_at(0U, 0U, map, 4U), 1);
+    CHECK_EQ(sprite_manager_tile_at(15U, 1U, map, 4U), 6);
+    CHECK_EQ(sprite_manager_tile_at(16U, 1U, map, 4U), 7);
+    CHECK_EQ(sprite_manager_tile_at(31U, 2U, map, 4U), 12);
+    CHECK_EQ(sprite_manager_tile_at(32U, 2U, map, 4U), 0);  /* past right edge */
+    CHECK_EQ(sprite_manager_tile_at(0U, 0U, NULL, 4U), 0);
+}
+
+void test_sprite_manager(void)
+{
+    test_pool();
+    test_update_hw();
+    test_first_collision();
+    test_tile_at();
+}
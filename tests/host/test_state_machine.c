@@ -0,0 +1,96 @@
+/* state_machine: switch/push/pop ordering and bank restore */
+#include <string.h>
+#include "states.h"
+#include "fake_states.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+static void switch_to_win(char state)
+{
+    if (state == 'G') switch_state(STATE_WIN);
+}
+
+static void pop_overlay(char state)
+{
+    if (state == 'P') pop_state();
+}
+
+void test_state_machine(void)
+{
+    uint8_t i;
+
+    fake_update_hook = NULL;
+
+    /* Plain switch: cleanup of the old state, then init of the new one */
+    switch_state(STATE_TITLE_SCREEN);
+    fake_log_clear();
+    run_current_state();
+    switch_state(STATE_GAMEPLAY);
+    CHECK(strcmp(fake_log, "TuTcGi") == 0);
+
+    /* Push pauses the base state, only the top state updates */
+    fake_log_clear();
+    push_state(STATE_PAUSE);
+    run_current_state();
+    CHECK(strcmp(fake_log, "GpPiPu") == 0);
+
+    /* Pop cleans up the overlay and resumes the base state – no re-init */
+    fake_log_clear();
+    pop_state();
+    run_current_state();
+    CHECK(strcmp(fake_log, "PcGrGu") == 0);
+
+    /* The base state is never popped */
+    fake_log_clear();
+    pop_state();
+    CHECK(strcmp(fake_log, "") == 0);
+
+    /* switch_state unwinds overlays first, then the base state */
+    push_state(STATE_PAUSE);
+    fake_log_clear();
+    switch_state(STATE_GAME_OVER);
+    CHECK(strcmp(fake_log, "PcGcOi") == 0);
+
+    /* Stack depth is bounded */
+    switch_state(STATE_GAMEPLAY);
+    for (i = 0; i < STATE_STACK_MAX + 2U; i++) {
+        push_state(STATE_PAUSE);
+    }
+    fake_log_clear();
+    for (i = 0; i < STATE_STACK_MAX + 2U; i++) {
+        pop_state();
+    }
+    /* Only STATE_STACK_MAX - 1 overlays were pushed: "Pc" each, then "Gr" */
+    CHECK_EQ(strlen(fake_log), (STATE_STACK_MAX - 1U) * 2U + 2U);
+
+    /* Out-of-range IDs are ignored */
+    fake_log_clear();
+    switch_state((GameStateID)200);
+    push_state((GameStateID)200);
+    CHECK(strcmp(fake_log, "") == 0);
+
+    /* Callbacks run in the state's bank; the caller's bank is restored */
+    SWITCH_ROM(7U);
+    fake_bank_seen = 0U;
+    run_current_state();
+    CHECK_EQ(fake_bank_seen, BANK(state_gameplay));
+    CHECK_EQ(CURRENT_BANK, 7);
+
+    /* Switching from inside update() (nested dispatch) is safe */
+    fake_update_hook = switch_to_win;
+    fake_log_clear();
+    run_current_state();
+    CHECK(strcmp(fake_log, "GuGcWi") == 0);
+    CHECK_EQ(CURRENT_BANK, 7);
+
+    /* Popping from inside the overlay's own update() */
+    fake_update_hook = pop_overlay;
+    switch_state(STATE_GAMEPLAY);
+    push_state(STATE_PAUSE);
+    fake_log_clear();
+    run_current_state();
+    CHECK(strcmp(fake_log, "PuPcGr") == 0);
+    CHECK_EQ(CURRENT_BANK, 7);
+
+    fake_update_hook = NULL;
+}
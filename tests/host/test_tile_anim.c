@@ -0,0 +1,89 @@
+/* animated BG tiles: frame timing, uploads into the tile's slot in the
+ * right VRAM bank from the set's ROM bank, the per-commit byte budget
+ * with round-robin catch-up, and stopping */
+#include <string.h>
+#include "tile_anim.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define ROM_BANK     6U
+#define CALLER_BANK  2U
+#define TILE_BASE   10U
+#define MANY         6U
+
+static uint8_t frames[MANY * 2U * 16U];
+
+/* Byte 0 of VRAM bank vbank's BG tile t */
+#define TILE_BYTE(vbank, t)  shim_bkg_tile_data[vbank][(uint16_t)(t) * 16U]
+
+void test_tile_anim(void)
+{
+    static TileAnim    flag[1] = { { 3U, 1U, 3U, 2U } };   /* frames 1..3 */
+    static TileAnim    many[MANY];
+    static TileAnimSet flag_set = { frames, flag, 1U };
+    static TileAnimSet many_set = { frames, many, MANY };
+    uint32_t writes;
+    unsigned i;
+
+    /* Frame f starts with byte f */
+    for (i = 0; i < sizeof(frames); i++) frames[i] = (uint8_t)(i / 16U);
+    shim_reset();
+    CURRENT_BANK = CALLER_BANK;
+
+    /* Each frame shows for speed commits, then wraps to frame 0 */
+    tile_anim_start(ROM_BANK, &flag_set, TILE_BASE, 1U);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    shim_bank_switches = 0U;
+    writes = shim_vram_writes;
+    tile_anim_commit();
+    CHECK_EQ(shim_vram_writes, writes);
+    CHECK_EQ(shim_bank_switches, 0);
+    tile_anim_commit();
+    CHECK_EQ(shim_vram_writes, writes + 16U);
+    CHECK_EQ(TILE_BYTE(1, TILE_BASE + 3U), 2);
+    CHECK_EQ(TILE_BYTE(0, TILE_BASE + 3U), 0);     /* bank 0 untouched */
+    CHECK_EQ(shim_bank_switches, 2);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK_EQ(VBK_REG, 0);
+    CHECK_EQ(tile_anim_pending(), 0);
+    tile_anim_commit();
+    tile_anim_commit();
+    CHECK_EQ(TILE_BYTE(1, TILE_BASE + 3U), 3);
+    tile_anim_commit();
+    tile_anim_commit();
+    CHECK_EQ(TILE_BYTE(1, TILE_BASE + 3U), 1);
+    CHECK_EQ(shim_vram_writes, writes + 48U);
+
+    /* Six tiles step at once: four fit the budget, the other two go first
+     * next time */
+    for (i = 0; i < MANY; i++) {
+        many[i].tile        = (uint8_t)i;
+        many[i].first_frame = (uint8_t)(i * 2U);
+        many[i].frame_count = 2U;
+        many[i].speed       = 1U;
+    }
+    memset(shim_bkg_tile_data, 0xEE, sizeof(shim_bkg_tile_data));
+    tile_anim_start(0U, &many_set, TILE_BASE, 0U);
+    writes = shim_vram_writes;
+    tile_anim_commit();
+    CHECK_EQ(shim_vram_writes, writes + TILE_ANIM_BUDGET);
+    CHECK_EQ(tile_anim_pending(), 2);
+    for (i = 0; i < 4U; i++) CHECK_EQ(TILE_BYTE(0, TILE_BASE + i), i * 2U + 1U);
+    CHECK_EQ(TILE_BYTE(0, TILE_BASE + 4U), 0xEE);
+    tile_anim_commit();
+    CHECK_EQ(TILE_BYTE(0, TILE_BASE + 4U), 8);     /* back on frame 0 */
+    CHECK_EQ(TILE_BYTE(0, TILE_BASE + 5U), 10);
+    CHECK_EQ(TILE_BYTE(0, TILE_BASE + 0U), 0);
+    CHECK_EQ(TILE_BYTE(0, TILE_BASE + 2U), 5);     /* still waiting */
+    CHECK_EQ(tile_anim_pending(), 2);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+
+    /* Stopped, or started with no set: nothing is uploaded */
+    tile_anim_stop();
+    CHECK_EQ(tile_anim_pending(), 0);
+    writes = shim_vram_writes;
+    tile_anim_commit();
+    tile_anim_start(ROM_BANK, NULL, TILE_BASE, 0U);
+    tile_anim_commit();
+    CHECK_EQ(shim_vram_writes, writes);
+}
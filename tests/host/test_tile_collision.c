@@ -0,0 +1,91 @@
+/* Randomized differential test: sprite_manager_tile_collision() against a
+ * brute-force per-pixel reference on random maps, sprites and tile sets. */
+#include <string.h>
+#include "sprite.h"
+#include "sprite_manager.h"
+#include "test.h"
+
+#define ITERATIONS   200000U
+#define MAX_MAP_W    64U
+#define MAX_MAP_H    32U
+
+/* Reference: a sprite collides when any pixel of its hitbox lies on a map
+ * tile whose ID is in the collide list.  Pixels outside the map are empty. */
+static uint8_t reference(const Sprite *s, uint16_t world_x16,
+                         const uint8_t *map, uint8_t map_w, uint8_t map_h,
+                         const uint8_t *ids, uint8_t n_ids)
+{
+    uint16_t ax = (uint16_t)(world_x16 + s->hitbox_x);
+    unsigned ay = (uint8_t)(s->world_y + s->hitbox_y);
+    unsigned aw = s->hitbox_w ? s->hitbox_w : s->width;
+    unsigned ah = s->hitbox_h ? s->hitbox_h : s->height;
+    unsigned px, py;
+    uint8_t  i, tile;
+
+    for (py = ay; py < ay + ah; py++) {
+        for (px = ax; px < (unsigned)ax + aw; px++) {
+            if ((px >> 3) >= map_w || (py >> 3) >= map_h) continue;
+            tile = map[(py >> 3) * map_w + (px >> 3)];
+            for (i = 0; i < n_ids; i++) {
+                if (ids[i] == tile) return 1U;
+            }
+        }
+    }
+    return 0U;
+}
+
+void test_tile_collision(void)
+{
+    static uint8_t map[MAX_MAP_W * MAX_MAP_H];
+    uint8_t  ids[8];
+    Sprite   s;
+    unsigned iter, i, mismatches = 0U, hits = 0U;
+
+    for (iter = 0; iter < ITERATIONS; iter++) {
+        uint8_t  map_w = (uint8_t)(1U + test_rand() % MAX_MAP_W);
+        uint8_t  map_h = (uint8_t)(1U + test_rand() % MAX_MAP_H);
+        uint8_t  n_ids = (uint8_t)(1U + test_rand() % 4U);
+        uint16_t world_x16;
+        uint8_t  got, want;
+
+        /* Small tile alphabet so both outcomes are common */
+        for (i = 0; i < (unsigned)map_w * map_h; i++) {
+            map[i] = (uint8_t)(test_rand() % 8U);
+        }
+        for (i = 0; i < n_ids; i++) {
+            ids[i] = (uint8_t)(test_rand() % 8U);
+        }
+
+        memset(&s, 0, sizeof(s));
+        s.active   = 1U;
+        s.width    = (uint8_t)(1U + test_rand() % 24U);
+        s.height   = (uint8_t)(1U + test_rand() % 24U);
+        s.world_y  = (uint8_t)(test_rand() % (map_h * 8U + 16U));
+        if (test_rand() & 1U) {
+            s.hitbox_x = (uint8_t)(test_rand() % 8U);
+            s.hitbox_y = (uint8_t)(test_rand() % 8U);
+            s.hitbox_w = (uint8_t)(test_rand() % 16U);   /* 0 = full width */
+            s.hitbox_h = (uint8_t)(test_rand() % 16U);
+        }
+        world_x16 = (uint16_t)(test_rand() % (map_w * 8U + 16U));
+
+        got  = sprite_manager_tile_collision(&s, world_x16, map, map_w, map_h,
+                                             ids, n_ids);
+        want = reference(&s, world_x16, map, map_w, map_h, ids, n_ids);
+        hits += want;
+        if (got != want) {
+            if (mismatches < 5U) {
+                printf("  mismatch: map %ux%u x16=%u y=%u w=%u h=%u "
+                       "hb=(%u,%u,%u,%u) got %u want %u\n",
+                       map_w, map_h, world_x16, s.world_y, s.width, s.height,
+                       s.hitbox_x, s.hitbox_y, s.hitbox_w, s.hitbox_h,
+                       got, want);
+            }
+            mismatches++;
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+    /* Sanity: the generator exercises both outcomes */
+    CHECK(hits > ITERATIONS / 10U);
+    CHECK(hits < ITERATIONS - ITERATIONS / 10U);
+}
@@ -0,0 +1,143 @@
+/* vram: first fit over the OBJ / shared / BG blocks of both CGB banks,
+ * spilling into bank 1, sharing resident data by reference, arenas,
+ * release, maps written with the handle's tile base and bank bit, and
+ * even OBJ bases in 8x16 mode */
+#include <string.h>
+#include "vram.h"
+#include "pb16.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define ROM_BANK     5U
+#define CALLER_BANK  2U
+
+static uint8_t data[256 * 16];
+
+void test_vram(void)
+{
+    static const uint8_t map[2 * 4]  = { 0, 1, 2, 3,  4, 5, 6, 7 };
+    static const uint8_t attr[2 * 4] = { 1, 1, 0x20, 0,  2, 2, 2, 0x40 };
+    uint8_t  a, a2, b, c, d, e, r;
+    uint32_t writes;
+    unsigned i;
+
+    for (i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i * 7U + 3U);
+    shim_reset();
+    vram_init();
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 512);
+    CHECK_EQ(vram_free_tiles(VRAM_OBJ), 512);
+
+    /* OBJ tiles start in the OBJ-only block: BG space is untouched */
+    a = vram_load(VRAM_OBJ, data, 0U, 100U, TILE_CODEC_RAW);
+    CHECK(a != VRAM_NONE);
+    CHECK_EQ(vram_tile(a), 0);
+    CHECK_EQ(vram_bank(a), 0);
+    CHECK_EQ(vram_attr(a), 0);
+    CHECK(memcmp(shim_obj_tile_data[0], data, 100U * 16U) == 0);
+    CHECK_EQ(vram_free_tiles(VRAM_OBJ), 412);
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 512);
+
+    /* ... and run on into the shared block, which BG then loses */
+    b = vram_load(VRAM_OBJ, data + 16, 0U, 60U, TILE_CODEC_RAW);
+    CHECK_EQ(vram_tile(b), 100);
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 480);
+
+    /* 140 BG tiles: BG 0-127 + shared 160-255 is not one run, so they
+     * go to bank 1 and carry the bank bit */
+    CURRENT_BANK = CALLER_BANK;
+    shim_bank_switches = 0U;
+    c = vram_load(VRAM_BG, data + 32, ROM_BANK, 140U, TILE_CODEC_RAW);
+    CHECK(c != VRAM_NONE);
+    CHECK_EQ(vram_tile(c), 0);
+    CHECK_EQ(vram_bank(c), 1);
+    CHECK_EQ(vram_attr(c), VRAM_ATTR_BANK1);
+    CHECK(memcmp(shim_bkg_tile_data[1], data + 32, 140U * 16U) == 0);
+    CHECK_EQ(shim_bank_switches, 2);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK_EQ(VBK_REG, 0);
+
+    /* Resident data is shared: same handle, nothing written */
+    writes = shim_vram_writes;
+    a2 = vram_load(VRAM_OBJ, data, 0U, 100U, TILE_CODEC_RAW);
+    CHECK_EQ(a2, a);
+    CHECK_EQ(shim_vram_writes, writes);
+
+    /* Maps get the tile base and attributes the bank bit */
+    memset(shim_bkg_map, 0xEE, sizeof(shim_bkg_map));
+    shim_bank_switches = 0U;
+    d = vram_load(VRAM_BG, data + 48, ROM_BANK, 8U, TILE_CODEC_RAW);
+    CHECK_EQ(vram_bank(d), 0);
+    CHECK_EQ(vram_tile(d), 0);
+    vram_set_bkg_submap(c, 0U, 0U, 4U, 2U, map, attr, 4U);
+    CHECK_EQ(shim_bkg_map[0][0][0], 0);
+    CHECK_EQ(shim_bkg_map[0][1][3], 7);
+    CHECK_EQ(shim_bkg_map[1][0][0], 1 | VRAM_ATTR_BANK1);
+    CHECK_EQ(shim_bkg_map[1][0][2], 0x20 | VRAM_ATTR_BANK1);
+    CHECK_EQ(shim_bkg_map[1][1][3], 0x40 | VRAM_ATTR_BANK1);
+    vram_release(d);
+    e = vram_load(VRAM_BG, data + 64, ROM_BANK, 8U, TILE_CODEC_RAW);
+    CHECK_EQ(vram_tile(e), 0);
+    CHECK_EQ(vram_bank(e), 0);
+    vram_set_bkg_submap(e, 1U, 0U, 2U, 2U, map, NULL, 4U);
+    CHECK_EQ(shim_bkg_map[0][1][2], 6);
+    CHECK_EQ(shim_bkg_map[1][1][2], 2 | VRAM_ATTR_BANK1);   /* attrs untouched */
+    CHECK_EQ(shim_bank_switches, 8);
+    CHECK_EQ(CURRENT_BANK, CALLER_BANK);
+    CHECK_EQ(VBK_REG, 0);
+    vram_release(e);
+
+    /* An arena frees what was taken in it, shared references included */
+    vram_arena_push();
+    d = vram_load(VRAM_BG, data + 80, 0U, 20U, TILE_CODEC_RAW);
+    CHECK_EQ(vram_tile(d), 0);
+    r = vram_alloc(VRAM_BG, 16U);
+    CHECK_EQ(vram_tile(r), 20);
+    CHECK_EQ(vram_load(VRAM_OBJ, data, 0U, 100U, TILE_CODEC_RAW), a);
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 480 - 140 - 36);
+    vram_arena_pop();
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 480 - 140);
+
+    /* Releases outside the current arena are ignored */
+    vram_arena_push();
+    vram_release(c);
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 480 - 140);
+    vram_arena_pop();
+
+    /* a holds two references: the first release keeps it resident (OBJ
+     * also lost bank 1's shared tiles 128-139 to c) */
+    vram_release(a);
+    CHECK_EQ(vram_free_tiles(VRAM_OBJ), 512 - 160 - 12);
+    vram_release(a);
+    CHECK_EQ(vram_free_tiles(VRAM_OBJ), 512 - 60 - 12);
+    e = vram_alloc(VRAM_OBJ, 40U);
+    CHECK_EQ(vram_tile(e), 0);
+
+    /* Nothing fits: no handle, nothing taken */
+    CHECK_EQ(vram_alloc(VRAM_BG, 255U), VRAM_NONE);
+    CHECK_EQ(vram_alloc(VRAM_OBJ, 0U), VRAM_NONE);
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 480 - 140);
+
+    /* PB16 data goes through the unpacker */
+    vram_init();
+    a = vram_load(VRAM_BG, data, 0U, 1U, TILE_CODEC_PB16);
+    CHECK(a != VRAM_NONE);
+    CHECK_EQ(vram_free_tiles(VRAM_BG), 511);
+
+    /* 8x16 sprites: OBJ ranges start on an even tile, BG ranges anywhere */
+    vram_init();
+    SPRITES_8x16;
+    a = vram_alloc(VRAM_OBJ, 3U);
+    b = vram_alloc(VRAM_OBJ, 2U);
+    CHECK_EQ(vram_tile(a), 0);
+    CHECK_EQ(vram_tile(b), 4);
+    c = vram_alloc(VRAM_BG, 3U);
+    d = vram_alloc(VRAM_BG, 1U);
+    CHECK_EQ(vram_tile(d), vram_tile(c) + 3U);
+    vram_release(a);
+    a = vram_alloc(VRAM_OBJ, 1U);
+    e = vram_alloc(VRAM_OBJ, 1U);
+    CHECK_EQ(vram_tile(a), 0);
+    CHECK_EQ(vram_tile(e), 2);
+    CHECK_EQ(vram_free_tiles(VRAM_OBJ), 512 - 4);   /* tiles 1 and 3 stay free */
+    LCDC_REG = 0U;
+}
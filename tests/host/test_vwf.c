@@ -0,0 +1,160 @@
+/* vwf: proportional text composed from the generated font_vwf glyphs,
+ * checked pixel for pixel against a naive renderer */
+#include <string.h>
+#include "vwf.h"
+#include "font_vwf.h"
+#include "gbdk_shim.h"
+#include "test.h"
+
+#define FIRST_TILE  100U
+#define ROW         5U
+
+/* Glyph g unshifted: the pen-tile rows at pixel offset 0 */
+static const uint8_t *glyph_rows(uint8_t g)
+{
+    return font_vwf.glyphs + (uint16_t)g * 8U * FONT_VWF_HEIGHT * 2U;
+}
+
+/* Naive per-pixel rendering of str into an 8-row, 256-pixel strip */
+static uint16_t reference(const char *str, uint8_t strip[8][256])
+{
+    uint16_t pen = 0U;
+    uint8_t  g, r, c;
+
+    memset(strip, 0, 8U * 256U);
+    for (; *str; str++) {
+        g = (uint8_t)((uint8_t)*str - font_vwf.first_char);
+        if ((uint8_t)*str < font_vwf.first_char || g >= font_vwf.glyph_count) continue;
+        for (r = 0; r < FONT_VWF_HEIGHT; r++) {
+            for (c = 0; c < 8U; c++) {
+                if (glyph_rows(g)[r] & (0x80U >> c)) strip[r][(pen + c) & 0xFFU] = 1U;
+            }
+        }
+        pen += font_vwf.widths[g];
+    }
+    return pen;
+}
+
+/* Read back map row ROW from column x0 as the same kind of strip */
+static void screen(uint8_t x0, uint8_t cells, uint8_t strip[8][256])
+{
+    uint8_t i, r, c, t;
+    const uint8_t *d;
+
+    memset(strip, 0, 8U * 256U);
+    for (i = 0; i < cells; i++) {
+        t = shim_bkg_map[0][ROW][(uint8_t)(x0 + i) & 31U];
+        if (t < FIRST_TILE) continue;          /* never given a tile */
+        CHECK_EQ(shim_bkg_map[1][ROW][(uint8_t)(x0 + i) & 31U], VWF_ATTR);
+        d = &shim_bkg_tile_data[0][(uint16_t)t * 16U];
+        for (r = 0; r < 8U; r++) {
+            CHECK_EQ(d[r * 2U + 1U], 0);       /* text is colour 1 only */
+            for (c = 0; c < 8U; c++) {
+                if (d[r * 2U] & (0x80U >> c)) strip[r][i * 8U + c] = 1U;
+            }
+        }
+    }
+}
+
+static void flush(void)
+{
+    while (vwf_pending()) vwf_commit();
+}
+
+void test_vwf(void)
+{
+    static uint8_t want[8][256], got[8][256];
+    char     str[24];
+    unsigned i, n, len;
+    uint32_t writes;
+    uint16_t w;
+    uint8_t  ink;
+
+    vwf_init(&font_vwf, BANK(font_vwf), FIRST_TILE, VWF_MAX_TILES, 0U);
+
+    /* "Hi!" is 6 + 2 + 2 pixels: two tiles, nothing in VRAM before commit */
+    writes = shim_vram_writes;
+    vwf_print(2, ROW, "Hi!");
+    CHECK_EQ(shim_vram_writes, writes);
+    CHECK_EQ(vwf_pending(), 2);
+    CURRENT_BANK = 3U;                     /* a banked caller's strings */
+    CHECK_EQ(vwf_text_width("Hi!"), 10);
+    CHECK_EQ(CURRENT_BANK, 3);
+    CURRENT_BANK = 1U;
+    vwf_commit();
+    CHECK_EQ(vwf_pending(), 0);
+    CHECK_EQ(shim_bkg_map[0][ROW][2], FIRST_TILE);
+    CHECK_EQ(shim_bkg_map[0][ROW][3], FIRST_TILE + 1U);
+    CHECK_EQ(shim_bkg_map[0][ROW][4], 0);
+    CHECK_EQ(_current_bank, 1);
+
+    /* Far fewer tiles than one per character */
+    vwf_clear();
+    vwf_print(0, ROW, "Hello, world!");
+    CHECK_EQ(vwf_pending(), (vwf_text_width("Hello, world!") + 7U) / 8U);
+    CHECK(vwf_pending() < 13U);
+
+    /* At most VWF_COMMIT_TILES uploads per VBlank */
+    n = vwf_pending();
+    vwf_commit();
+    CHECK_EQ(vwf_pending(), n - VWF_COMMIT_TILES);
+    flush();
+
+    /* Codes outside the font draw nothing */
+    vwf_clear();
+    vwf_move_to(0, ROW);
+    CHECK_EQ(vwf_putc((char)200), 0);
+    CHECK_EQ(vwf_putc('\n'), 0);
+    CHECK_EQ(vwf_pending(), 0);
+
+    /* Random printable strings match the naive renderer exactly */
+    for (n = 0; n < 300U; n++) {
+        len = 1U + test_rand() % 20U;
+        for (i = 0; i < len; i++) str[i] = (char)(32U + test_rand() % 95U);
+        str[len] = '\0';
+
+        memset(shim_bkg_map, 0, sizeof(shim_bkg_map));
+        vwf_clear();
+        vwf_print(1, ROW, str);
+        flush();
+        w = reference(str, want);
+        CHECK_EQ(vwf_text_width(str), w);
+        screen(1, 31U, got);
+        CHECK(memcmp(want, got, sizeof(want)) == 0);
+    }
+
+    /* Typewriter: one character and one commit per frame, same result */
+    memset(shim_bkg_map, 0, sizeof(shim_bkg_map));
+    vwf_clear();
+    vwf_move_to(1, ROW);
+    for (i = 0; str[i]; i++) {
+        vwf_putc(str[i]);
+        vwf_commit();
+        CHECK(vwf_pending() <= 1U);
+    }
+    flush();
+    screen(1, 31U, got);
+    CHECK(memcmp(want, got, sizeof(want)) == 0);
+
+    /* A 4-tile ring wraps: the fifth tile reuses the first */
+    vwf_init(&font_vwf, BANK(font_vwf), FIRST_TILE, 4U, 0U);
+    memset(shim_bkg_map, 0, sizeof(shim_bkg_map));
+    vwf_print(0, ROW, "MMMMMM");           /* 36 pixels: 5 tiles */
+    flush();
+    CHECK_EQ(shim_bkg_map[0][ROW][3], FIRST_TILE + 3U);
+    CHECK_EQ(shim_bkg_map[0][ROW][4], FIRST_TILE);
+
+    /* A ring in VRAM bank 1: tiles land there, cells get the bank bit */
+    vwf_init(&font_vwf, BANK(font_vwf), FIRST_TILE, 4U, 1U);
+    memset(shim_bkg_tile_data, 0, sizeof(shim_bkg_tile_data));
+    vwf_print(0, ROW, "MM");
+    flush();
+    CHECK_EQ(shim_bkg_map[1][ROW][0], VWF_ATTR | 0x08U);
+    CHECK_EQ(VBK_REG, 0);
+    ink = 0U;
+    for (i = 0; i < 16U; i++) {
+        CHECK_EQ(shim_bkg_tile_data[0][FIRST_TILE * 16U + i], 0);
+        ink |= shim_bkg_tile_data[1][FIRST_TILE * 16U + i];
+    }
+    CHECK(ink);
+}
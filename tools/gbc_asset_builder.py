@@ -6,13 +6,17 @@ Reusable helper library for generating Game Boy Color (GBC) tile assets.
 Provides:
   - 2bpp conversion (pixels_to_2bpp, tiles_to_2bpp_bytes)
   - PNG I/O (make_indexed_png, png_to_tiles)
-  - .c/.h writers for backgrounds, fonts, and sprites
+  - write_if_changed: leaves identical output files (and timestamps) alone
+  - CGB palette packing for full-colour art (pack_palettes, image_to_background)
+  - PB16 tile compression with a per-asset codec report (encode_tile_data)
+  - .c/.h writers for backgrounds, fonts, sprites and sound effects
     (write_background_files, write_font_files,
-     write_sprite_files, write_sprite_files_animated)
+     write_sprite_files, write_sprite_files_animated, write_sfx_files)
 
 Requirements:  pip install pillow
 """
 
+import io
 import os
 
 try:
@@ -53,6 +57,155 @@ def tiles_to_2bpp_bytes(tiles):
     return out
 
 
+# ---------------------------------------------------------------------------
+# Tile compression (decoded by src/lib pb16)
+# ---------------------------------------------------------------------------
+
+TILE_CODECS = ('auto', 'raw', 'pb16')
+
+# Per-byte cost model of src/lib/src/pb16.c built with SDCC, in M-cycles
+# (1 frame = 17556), used to rank assets by bytes saved per frame of
+# decode.  The constants are uncalibrated estimates: no SM83 build or
+# emulator run has measured them yet.  To calibrate, build with DEBUG,
+# load an asset once raw and once pb16 (vram_load() logs "tiles raw
+# cycles:" / "tiles pb16 cycles:" in Emulicious) and fit the difference.
+# The VRAM copy itself is the same for both codecs and is left out.
+PB16_CYCLES_PACKET  = 20
+PB16_CYCLES_LITERAL = 30
+PB16_CYCLES_REPEAT  = 26
+PB16_CYCLES_CHUNK   = 150    # per 4-tile set_bkg_data() call
+FRAME_CYCLES        = 17556
+
+# 'auto' packs an asset only when it saves at least this many bytes per
+# frame of estimated decode.  The current assets fall either well above
+# (200+) or well below (75) it, so the choice stands even if the model
+# is off by a factor of 1.5 either way.
+PB16_MIN_SAVED_PER_FRAME = 128
+
+
+def pb16_compress(data):
+    """PB16-compress bytes (length a multiple of 8).
+
+    Each packet is a control byte, bit 7 first, for 8 output bytes: 1 =
+    repeat the byte two positions back (the same bit plane one pixel row
+    up; 0 before the start), 0 = a literal follows.
+    """
+    assert len(data) % 8 == 0, 'PB16 works on whole 8-byte packets'
+    out = []
+    back2 = back1 = 0
+    for i in range(0, len(data), 8):
+        ctrl, literals = 0, []
+        for v in data[i:i + 8]:
+            ctrl <<= 1
+            if v == back2:
+                ctrl |= 1
+            else:
+                literals.append(v)
+            back2, back1 = back1, v
+        out.append(ctrl)
+        out += literals
+    return out
+
+
+def pb16_decompress(blob, length):
+    """Inverse of pb16_compress (used to verify every generated blob)."""
+    out = []
+    back2 = back1 = 0
+    pos = 0
+    while len(out) < length:
+        ctrl = blob[pos]
+        pos += 1
+        for bit in range(8):
+            if ctrl & (0x80 >> bit):
+                v = back2
+            else:
+                v = blob[pos]
+                pos += 1
+            out.append(v)
+            back2, back1 = back1, v
+    return out
+
+
+def encode_tile_data(name, tile_bytes, codec='raw'):
+    """Return (data, codec): tile_bytes stored with codec.
+
+    codec is 'raw', 'pb16' or 'auto', which picks pb16 only when it saves
+    PB16_MIN_SAVED_PER_FRAME bytes per frame of estimated unpack time.
+    Prints the size of both codecs, the estimate and the choice.
+    """
+    if codec not in TILE_CODECS:
+        raise ValueError(f"{name}: TILE_CODEC must be one of {TILE_CODECS}, got {codec!r}")
+    packed = pb16_compress(tile_bytes)
+    assert pb16_decompress(packed, len(tile_bytes)) == list(tile_bytes)
+
+    literals = len(packed) - len(tile_bytes) // 8
+    repeats  = len(tile_bytes) - literals
+    cycles   = (len(tile_bytes) // 8 * PB16_CYCLES_PACKET +
+                literals * PB16_CYCLES_LITERAL + repeats * PB16_CYCLES_REPEAT +
+                -(-len(tile_bytes) // 64) * PB16_CYCLES_CHUNK)
+    saved     = len(tile_bytes) - len(packed)
+    per_frame = saved * FRAME_CYCLES // cycles
+    if codec == 'auto':
+        codec = 'pb16' if per_frame >= PB16_MIN_SAVED_PER_FRAME else 'raw'
+    print(f'{name}: tiles raw {len(tile_bytes)} B, pb16 {len(packed)} B '
+          f'({saved} B saved, ~{cycles} M-cycles = {cycles / FRAME_CYCLES:.2f} '
+          f'frames to unpack, {per_frame} B/frame) -> {codec}')
+    return (packed if codec == 'pb16' else list(tile_bytes)), codec
+
+
+def _codec_desc(codec):
+    return '16 bytes each' if codec == 'raw' else f'{codec}-compressed'
+
+
+def _tile_loader_h_lines(name, NAME, codec, size, target='bkg', banked=True):
+    """Header lines describing a tile blob, its <NAME>_SET_TILES(first) loader
+    and its <NAME>_VRAM_LOAD() allocator call (vram.h)."""
+    fn = {'bkg': 'set_bkg_data', 'sprite': 'set_sprite_data'}[target]
+    kind = {'bkg': 'VRAM_BG', 'sprite': 'VRAM_OBJ'}[target]
+    bank = f'BANK({name}_tiles)' if banked else '0U'
+    if codec == 'pb16':
+        fn = f'pb16_{fn}'
+    return [
+        f'#define {NAME}_TILE_CODEC    TILE_CODEC_{codec.upper()}',
+        f'#define {NAME}_TILES_SIZE    {size}U',
+        f'#define {NAME}_SET_TILES(first)  {fn}((first), {NAME}_TILE_COUNT, {name}_tiles)',
+        f'#define {NAME}_VRAM_LOAD()  vram_load({kind}, {name}_tiles, {bank}, '
+        f'{NAME}_TILE_COUNT, {NAME}_TILE_CODEC)',
+    ]
+
+
+# ---------------------------------------------------------------------------
+# Output helpers
+# ---------------------------------------------------------------------------
+
+# Paths passed to write_if_changed() since the last reset (written or not);
+# generate_assets.py uses this to know which files an asset produces.
+outputs = []
+
+
+def write_if_changed(path, data):
+    """Write text or bytes to path unless it already holds exactly that.
+
+    Leaving identical files untouched keeps their timestamps, so make does
+    not rebuild everything that depends on a regenerated header.
+    Returns True if the file was written.
+    """
+    if isinstance(data, str):
+        data = data.encode('utf-8')
+    outputs.append(path)
+    try:
+        with open(path, 'rb') as f:
+            if f.read() == data:
+                print(f'Unchanged {path}')
+                return False
+    except FileNotFoundError:
+        pass
+    with open(path, 'wb') as f:
+        f.write(data)
+    print(f'Written {path}')
+    return True
+
+
 # ---------------------------------------------------------------------------
 # PNG helpers
 # ---------------------------------------------------------------------------
@@ -76,7 +229,9 @@ def make_indexed_png(pixel_grid, palette_rgb, output_path):
     for y, row in enumerate(pixel_grid):
         for x, val in enumerate(row):
             pixels[x, y] = val
-    img.save(output_path)
+    buf = io.BytesIO()
+    img.save(buf, format='PNG')
+    write_if_changed(output_path, buf.getvalue())
 
 
 def png_to_tiles(png_path):
@@ -116,6 +271,16 @@ def _format_c_bytes(data, bytes_per_line=16):
     return '\n'.join(lines)
 
 
+def _format_c_words(data, words_per_line=8):
+    """Format ints as comma-separated C 16-bit decimal literals."""
+    lines = []
+    for i in range(0, len(data), words_per_line):
+        chunk = data[i:i + words_per_line]
+        comma = ',' if i + words_per_line < len(data) else ''
+        lines.append('    ' + ', '.join(f'{w}U' for w in chunk) + comma)
+    return '\n'.join(lines)
+
+
 def _rgb8_literal(r, g, b):
     return f'RGB8({r:3d},{g:3d},{b:3d})'
 
@@ -129,14 +294,292 @@ def _format_palette_array(palette_rows, colors_per_row=4):
     return '\n'.join(lines)
 
 
+# ---------------------------------------------------------------------------
+# Tile deduplication (CGB attribute flips)
+# ---------------------------------------------------------------------------
+
+ATTR_FLIP_X = 0x20   # CGB BG attribute bit 5: horizontal flip
+ATTR_FLIP_Y = 0x40   # CGB BG attribute bit 6: vertical flip
+ATTR_VRAM_BANK = 0x08  # CGB BG attribute bit 3: tiles in VRAM bank 1
+TILE_ANIM_MAX = 8      # animated tiles per set (src/lib/include/tile_anim.h)
+
+# Generated levels (src/lib/include/level.h)
+LEVEL_CHUNK_W        = 8
+LEVEL_GEN_ROWS       = 18
+LEVEL_GEN_MAX_CHUNKS = 16
+LEVEL_GEN_CODES      = {'#': 0x01, '.': 0x00, 'B': 0x03, '-': 0x04, '=': 0x05}
+LEVEL_KINDS          = ['SKY', 'GRASS', 'SOIL', 'DEEP', 'BLOCK', 'LEDGE']
+
+
+def _flip_tile(tile, flags):
+    """Return tile (8 rows of 8 ints) as a tuple, flipped per ATTR_FLIP_* flags."""
+    rows = [tuple(r[::-1]) if flags & ATTR_FLIP_X else tuple(r) for r in tile]
+    if flags & ATTR_FLIP_Y:
+        rows.reverse()
+    return tuple(rows)
+
+
+def dedupe_tiles(tiles, tilemap, attr_map=None, tile_classes=None):
+    """Merge tiles that are identical up to an X and/or Y flip.
+
+    Each tile is kept the first time it is seen; a later tile equal to a
+    kept tile, or to a flipped copy of one, is dropped and its map cells
+    point at the kept tile with the matching ATTR_FLIP_* bits XORed into
+    the attribute byte.  Tiles with different tile_classes entries (e.g.
+    collision classes, which the game looks up by tile ID) never merge.
+
+    Returns (new_tiles, new_tilemap, new_attr_map, remap) where remap[i]
+    is the new ID of input tile i.  new_attr_map is None when attr_map was
+    None and no cell needed a flip.
+    """
+    classes = tile_classes or [None] * len(tiles)
+    seen = {}              # (pixels, class) -> (new id, flip flags)
+    new_tiles = []
+    remap, remap_flip = [], []
+    for idx, tile in enumerate(tiles):
+        key = (_flip_tile(tile, 0), classes[idx])
+        if key in seen:
+            new_id, flags = seen[key]
+        else:
+            new_id, flags = len(new_tiles), 0
+            new_tiles.append(tile)
+            # Unflipped first so an exact duplicate never needs flip bits
+            for f in (0, ATTR_FLIP_X, ATTR_FLIP_Y, ATTR_FLIP_X | ATTR_FLIP_Y):
+                seen.setdefault((_flip_tile(tile, f), classes[idx]), (new_id, f))
+        remap.append(new_id)
+        remap_flip.append(flags)
+
+    new_tilemap = [remap[t] for t in tilemap]
+    flips = [remap_flip[t] for t in tilemap]
+    if attr_map is None and not any(flips):
+        new_attr_map = None
+    else:
+        base = attr_map if attr_map is not None else [0] * len(tilemap)
+        new_attr_map = [a ^ f for a, f in zip(base, flips)]
+    return new_tiles, new_tilemap, new_attr_map, remap
+
+
+# ---------------------------------------------------------------------------
+# CGB palette packing (full-colour source art)
+# ---------------------------------------------------------------------------
+
+CGB_MAX_PALETTES = 8
+CGB_PALETTE_SIZE = 4
+
+
+def _cgb_colour(rgb):
+    """Snap an (r,g,b) 8-bit colour to the 15-bit CGB colour it becomes.
+
+    RGB8() keeps the top 5 bits; the low bits are refilled so the preview
+    shows the colour the hardware displays.  Source colours that differ
+    only in the dropped bits therefore count as one colour.
+    """
+    return tuple((c & 0xF8) | (c >> 5) for c in rgb[:3])
+
+
+def pack_palettes(colour_sets, max_palettes=CGB_MAX_PALETTES):
+    """Group per-tile colour sets into as few 4-colour palettes as possible.
+
+    colour_sets : one set of colours per tile (each at most 4 colours).
+
+    Greedy bin packing: sets are placed largest first, each into the
+    existing palette it adds the fewest new colours to (a superset costs
+    nothing, which is how subset palettes are merged), or into a new one.
+    Palettes whose union still fits are then merged pairwise.  Within a
+    palette the colour used by the most tiles is index 0, so the backdrop
+    colour stays at the index BG-to-OBJ priority treats as transparent.
+
+    Returns (palettes, assignment): palettes is a list of colour lists and
+    assignment[i] the palette index for colour_sets[i].  Raises ValueError
+    if a tile has more than 4 colours or more than max_palettes are needed.
+    """
+    sets = [frozenset(s) for s in colour_sets]
+    for i, s in enumerate(sets):
+        if len(s) > CGB_PALETTE_SIZE:
+            raise ValueError(f'tile {i} uses {len(s)} colours '
+                             f'(max {CGB_PALETTE_SIZE} per CGB palette)')
+
+    uses = {}
+    for s in sets:
+        uses[s] = uses.get(s, 0) + 1
+    order = sorted(uses, key=lambda s: (-len(s), -uses[s], sorted(s)))
+
+    groups = []
+    for s in order:
+        best = None
+        for gi, g in enumerate(groups):
+            grown = len(g | s)
+            if grown <= CGB_PALETTE_SIZE and (best is None or grown - len(g) < best[0]):
+                best = (grown - len(g), gi)
+        if best is None:
+            groups.append(set(s))
+        else:
+            groups[best[1]] |= s
+
+    merged = True
+    while merged:
+        merged = False
+        for a in range(len(groups)):
+            for b in range(a + 1, len(groups)):
+                if len(groups[a] | groups[b]) <= CGB_PALETTE_SIZE:
+                    groups[a] |= groups.pop(b)
+                    merged = True
+                    break
+            if merged:
+                break
+
+    if len(groups) > max_palettes:
+        listing = '; '.join(', '.join(str(c) for c in sorted(g)) for g in groups)
+        raise ValueError(f'art needs {len(groups)} palettes, only {max_palettes} '
+                         f'available: {listing}')
+
+    assignment = [next(gi for gi, g in enumerate(groups) if s <= g) for s in sets]
+
+    palettes = []
+    for gi, g in enumerate(groups):
+        count = {c: 0 for c in g}
+        for s, pi in zip(sets, assignment):
+            if pi == gi:
+                for c in s:
+                    count[c] += 1
+        palettes.append(sorted(g, key=lambda c: (-count[c], c)))
+    return palettes, assignment
+
+
+def image_to_background(png_path, max_palettes=CGB_MAX_PALETTES):
+    """Cut full-colour art into 8x8 tiles and solve its CGB palettes.
+
+    Every map cell becomes its own tile, indexed against the palette
+    pack_palettes() chose for it, so tile i is map cell i (row-major).
+    Cells with the same pixels share a palette and therefore produce
+    identical tiles, which dedupe_tiles() then folds together.
+
+    Returns a dict with tiles, tilemap, attr_map (palette in bits 0-2),
+    palette_colors (flat, 4 per palette), map_w, map_h and a printable
+    usage report.
+    """
+    img = Image.open(png_path).convert('RGB')
+    w, h = img.size
+    if w % 8 or h % 8:
+        raise ValueError(f'{png_path}: {w}x{h} is not a multiple of 8')
+    pixels = img.load()
+    map_w, map_h = w // 8, h // 8
+
+    cells = []
+    for ty in range(map_h):
+        for tx in range(map_w):
+            cells.append([[_cgb_colour(pixels[tx * 8 + x, ty * 8 + y])
+                           for x in range(8)] for y in range(8)])
+    colour_sets = [{c for row in cell for c in row} for cell in cells]
+    try:
+        palettes, assignment = pack_palettes(colour_sets, max_palettes)
+    except ValueError as e:
+        raise ValueError(f'{png_path}: {e}') from None
+
+    tiles = []
+    for cell, pi in zip(cells, assignment):
+        index = {c: i for i, c in enumerate(palettes[pi])}
+        tiles.append([[index[c] for c in row] for row in cell])
+
+    palette_colors = []
+    for pal in palettes:
+        palette_colors += pal + [pal[-1]] * (CGB_PALETTE_SIZE - len(pal))
+
+    lines = [f'{len(palettes)}/{max_palettes} palettes used '
+             f'({max_palettes - len(palettes)} free)']
+    for pi, pal in enumerate(palettes):
+        n = assignment.count(pi)
+        lines.append(f'  palette {pi}: {len(pal)} colours, {n} cells  '
+                     + ' '.join('#%02X%02X%02X' % c for c in pal))
+    return {
+        'tiles': tiles,
+        'tilemap': list(range(len(cells))),
+        'attr_map': assignment,
+        'palette_colors': palette_colors,
+        'map_w': map_w,
+        'map_h': map_h,
+        'report': '\n'.join(lines),
+    }
+
+
 # ---------------------------------------------------------------------------
 # Background file writers
 # ---------------------------------------------------------------------------
 
+def _runner_c_lines(name, NAME, runner, map_height, anim_ptr, n_solid, n_down, spawns):
+    """C source for a generated level: patterns, LevelGen and
+    <name>_runner_level, which shares the level's tiles, palettes and
+    collision lists (so it must be emitted into the same file).  The level
+    has no end: width 0, no goal and no checkpoints of its own."""
+    chunks = runner['chunks']
+    if map_height > LEVEL_GEN_ROWS:
+        raise ValueError(f"{name}: runner levels are at most {LEVEL_GEN_ROWS} rows")
+    if not 1 <= len(chunks) <= LEVEL_GEN_MAX_CHUNKS:
+        raise ValueError(f"{name}: runner needs 1-{LEVEL_GEN_MAX_CHUNKS} chunk patterns")
+    codes = []
+    for i, c in enumerate(chunks):
+        if len(c) != LEVEL_CHUNK_W or any(ch not in LEVEL_GEN_CODES for ch in c):
+            raise ValueError(f"{name}: runner chunk {i} {c!r} must be {LEVEL_CHUNK_W} "
+                             f"of {''.join(LEVEL_GEN_CODES)}")
+        # Checkpoints and enemy respawns are put on chunk edges
+        if c[0] != '#' or c[-1] != '#':
+            raise ValueError(f"{name}: runner chunk {i} {c!r} must start and end on "
+                             f"plain ground")
+        codes += [LEVEL_GEN_CODES[ch] for ch in c]
+    if any(ch != '#' for ch in chunks[0]):
+        raise ValueError(f"{name}: runner chunk 0 must be flat ground")
+    if sorted(runner['tiles']) != sorted(LEVEL_KINDS):
+        raise ValueError(f"{name}: runner tiles must name {', '.join(LEVEL_KINDS)}")
+
+    tiles = ', '.join(f'{runner["tiles"][k][0]}U' for k in LEVEL_KINDS)
+    attrs = ', '.join(f'0x{runner["tiles"][k][1]:02X}U' for k in LEVEL_KINDS)
+    px, py, ex, ey, ebhv = spawns
+    lines = [
+        '',
+        f'/* Runner chunk patterns ({len(chunks)} x {LEVEL_CHUNK_W} column codes,',
+        f'   LEVEL_GEN_* in src/lib/include/level.h) */',
+        f'BANKREF({name}_runner_chunks)',
+        f'const uint8_t {name}_runner_chunks[{len(codes)}] = {{',
+        _format_c_bytes(codes),
+        '};',
+        '',
+        f'/* {{patterns, count, flat chunks, ground row, ledge row,',
+        f'    tiles and attributes per LEVEL_KIND_*}} */',
+        f'BANKREF({name}_runner_gen)',
+        f'const LevelGen {name}_runner_gen = {{',
+        f'    {name}_runner_chunks, {len(chunks)}U, {int(runner["flat_chunks"])}U,',
+        f'    {int(runner["ground_row"])}U, {int(runner["ledge_row"])}U,',
+        f'    {{ {tiles} }},',
+        f'    {{ {attrs} }}',
+        '};',
+    ]
+    lines += [
+        '',
+        '/* Generated level on the same tiles: no map and no end (width 0),',
+        '   columns come from level_set_seed() and the patterns above. */',
+        f'BANKREF({name}_runner_level)',
+        f'const Level {name}_runner_level = {{',
+        f'    {name}_tiles, {name}_palettes, NULL, NULL,',
+        f'    {name}_collision_tiles, {name}_collision_down_tiles, NULL,',
+        f'    {anim_ptr}, &{name}_runner_gen,',
+        f'    0U,',
+        f'    0U, {map_height}U,',
+        f'    {NAME}_TILE_COUNT, {NAME}_TILE_CODEC, {NAME}_PALETTE_COUNT,',
+        f'    {n_solid}U, {n_down}U, 0U,',
+        f'    {int(px)}U, {int(py)}U, {int(ex)}U, {int(ey)}U, {ebhv}',
+        '};',
+    ]
+    return lines
+
+
 def write_background_files(name, tiles, tilemap, palette_colors,
                             map_width, map_height, out_dir='.', attr_map=None,
                             collision_down_tile_ids=None,
                             collision_tile_ids=None,
+                            checkpoints=None, goal_x16=None,
+                            player_spawn=None, enemy_spawn=None,
+                            dedupe=True, tile_names=None, tile_codec='raw',
+                            animated_tiles=None, runner=None,
                             generator='gen_background.py'):
     """Write background .c and .h files.
 
@@ -151,6 +594,32 @@ def write_background_files(name, tiles, tilemap, palette_colors,
                          When provided, exported as <name>_collision_down_tiles[].
     collision_tile_ids : optional list of tile IDs that block from all directions.
                          When provided, exported as <name>_collision_tiles[].
+    checkpoints        : optional ascending list of world-X respawn positions (pixels).
+                         When provided, exported as <name>_checkpoints[].
+    goal_x16           : optional world-X (pixels) that ends the level.
+                         When provided, exported as <NAME>_GOAL_X16, and the
+                         background is a level: a Level descriptor
+                         <name>_level (src/lib/include/level.h) is emitted
+                         in the same bank as the data it points to.
+    player_spawn       : (x, y) world pixels where the player starts a level.
+    enemy_spawn        : (x, y) world pixels where the enemy starts a level, or
+                         (x, y, script) to run behaviour script BHV_<SCRIPT>
+                         (from BHV_HEADER) instead of script 0.
+    dedupe             : merge tiles identical up to X/Y flip (see dedupe_tiles);
+                         flips go into the attr_map and collision IDs are remapped.
+                         Tile IDs in the output therefore differ from the input.
+    tile_names         : optional {name: input tile ID} for tiles the game refers to;
+                         exported as <NAME>_TILE_<name> with the output tile ID.
+    tile_codec         : 'auto', 'raw' or 'pb16' storage for <name>_tiles (see encode_tile_data);
+                         load with <NAME>_SET_TILES(first) either way.
+    animated_tiles     : optional {tile_names key: (speed, [8x8 frame grids])}.
+                         Frame 0 is the tile's own art, the grids follow it;
+                         each frame shows for speed frames (1/60 s).  Exported
+                         as the TileAnimSet <name>_tile_anims (src/lib/include/
+                         tile_anim.h).  Animated tiles are never merged.
+    runner             : optional dict describing a generated level with this tile
+                         set and no map (see RUNNER in gen_background.py); emitted
+                         as <name>_runner_level, a second Level descriptor.
     generator          : name of the generator script (used in file header comment).
     """
     def _normalize_tile_ids(ids, param_name):
@@ -166,9 +635,71 @@ def write_background_files(name, tiles, tilemap, palette_colors,
 
     collision_down_tile_ids = _normalize_tile_ids(collision_down_tile_ids, 'collision_down_tile_ids')
     collision_tile_ids      = _normalize_tile_ids(collision_tile_ids,      'collision_tile_ids')
+    if checkpoints is not None:
+        checkpoints = [int(x) for x in checkpoints]
+        max_x = map_width * 8
+        for x in checkpoints:
+            if x < 0 or x >= max_x:
+                raise ValueError(
+                    f"checkpoint {x} is outside the map (0-{max_x - 1})")
+        if checkpoints != sorted(checkpoints):
+            raise ValueError("checkpoints must be in ascending world-X order")
+        checkpoints = checkpoints if checkpoints else None
+
+    # Animated tiles: {input tile ID: (speed, extra frames)}
+    anim_ids = {}
+    for tname, (speed, frames) in (animated_tiles or {}).items():
+        if not tile_names or tname not in tile_names:
+            raise ValueError(f"{name}: animated tile {tname!r} is not in tile_names")
+        if not 1 <= int(speed) <= 255:
+            raise ValueError(f"{name}: animated tile {tname!r} speed {speed} is outside 1-255")
+        for f in frames:
+            if len(f) != 8 or any(len(row) != 8 or any(not 0 <= p <= 3 for p in row) for row in f):
+                raise ValueError(f"{name}: animated tile {tname!r} frames must be 8x8 grids of 0-3")
+        anim_ids[tile_names[tname]] = (int(speed), list(frames))
+    if len(anim_ids) > TILE_ANIM_MAX:
+        raise ValueError(f"{name}: {len(anim_ids)} animated tiles, at most {TILE_ANIM_MAX}")
+
+    if dedupe:
+        # Collision is looked up by tile ID, so keep collision classes apart;
+        # an animated tile's data is swapped at run time, so it stays alone
+        solid = set(collision_tile_ids or [])
+        down  = set(collision_down_tile_ids or [])
+        classes = [(i in solid, i in down, i if i in anim_ids else None)
+                   for i in range(len(tiles))]
+        n_in = len(tiles)
+        in_tiles = tiles
+        tiles, tilemap, attr_map, remap = dedupe_tiles(tiles, tilemap, attr_map, classes)
+
+        def _remap_ids(ids):
+            if ids is None:
+                return None
+            return sorted({remap[t] for t in ids if t < n_in})
+        collision_tile_ids      = _remap_ids(collision_tile_ids)
+        collision_down_tile_ids = _remap_ids(collision_down_tile_ids)
+        if tile_names:
+            tile_names = {k: remap[v] for k, v in tile_names.items()}
+        anim_ids = {remap[t]: a for t, a in anim_ids.items()}
+        if runner:
+            # Generated columns carry no flip bits: the tiles must survive as drawn
+            for k, (t, _) in runner['tiles'].items():
+                if tiles[remap[t]] != in_tiles[t]:
+                    raise ValueError(f"{name}: runner tile {k} was merged into a flipped "
+                                     "tile; set DEDUPE_TILES = False or change the art")
+            runner = dict(runner, tiles={k: (remap[t], a)
+                                         for k, (t, a) in runner['tiles'].items()})
+        n_flipped = sum(1 for a in (attr_map or []) if a & (ATTR_FLIP_X | ATTR_FLIP_Y))
+        print(f'{name}: {n_in} tiles -> {len(tiles)} after flip dedupe '
+              f'({n_in - len(tiles)} saved, {(n_in - len(tiles)) * 16} bytes; '
+              f'{n_flipped} flipped map cells)')
+
+    if attr_map is not None and any(a & ATTR_VRAM_BANK for a in attr_map):
+        raise ValueError(f"{name}: attr_map must leave bit 3 (VRAM bank) clear; "
+                         "vram_set_bkg_submap() applies the bank of the tiles")
+
     tile_count      = len(tiles)
     palette_count   = len(palette_colors) // 4
-    tile_bytes      = tiles_to_2bpp_bytes(tiles)
+    tile_bytes, tile_codec = encode_tile_data(name, tiles_to_2bpp_bytes(tiles), tile_codec)
     total_tile_b    = len(tile_bytes)
     total_map_b     = len(tilemap)
     pal_count_total = len(palette_colors)
@@ -187,7 +718,7 @@ def write_background_files(name, tiles, tilemap, palette_colors,
         _format_palette_array(palette_colors),
         '};',
         '',
-        f'/* Background tile data ({tile_count} tiles, 16 bytes each) */',
+        f'/* Background tile data ({tile_count} tiles, {_codec_desc(tile_codec)}) */',
         f'BANKREF({name}_tiles)',
         f'const uint8_t {name}_tiles[{total_tile_b}] = {{',
         _format_c_bytes(tile_bytes),
@@ -203,8 +734,10 @@ def write_background_files(name, tiles, tilemap, palette_colors,
         n_attr = len(attr_map)
         c_lines += [
             '',
-            f'/* Per-tile palette attribute map ({map_width}x{map_height} = {n_attr} bytes).',
-            f'   Each byte is the GBC VRAM bank-1 attribute: 0x00=sky palette, 0x01=ground palette. */',
+            f'/* Per-tile attribute map ({map_width}x{map_height} = {n_attr} bytes).',
+            f'   Each byte is the GBC VRAM bank-1 attribute: bits 0-2 = palette,',
+            f'   0x20 = X flip, 0x40 = Y flip (set by tile deduplication).',
+            f'   Bit 3 (VRAM bank) is left to vram_set_bkg_submap(). */',
             f'BANKREF({name}_attr_map)',
             f'const uint8_t {name}_attr_map[{n_attr}] = {{',
             _format_c_bytes(attr_map),
@@ -232,11 +765,92 @@ def write_background_files(name, tiles, tilemap, palette_colors,
             _format_c_bytes(collision_tile_ids),
             '};',
         ]
+    if checkpoints is not None:
+        n_cp = len(checkpoints)
+        c_lines += [
+            '',
+            f'/* Checkpoint world-X positions ({n_cp} entries, ascending).',
+            f'   Passing one moves the respawn point there. */',
+            f'BANKREF({name}_checkpoints)',
+            f'const uint16_t {name}_checkpoints[{n_cp}] = {{',
+            _format_c_words(checkpoints),
+            '};',
+        ]
+
+    if anim_ids:
+        anim_frames = []
+        anim_rows   = []
+        for tid in sorted(anim_ids):
+            speed, frames = anim_ids[tid]
+            anim_rows.append(f'    {{ {tid}U, {len(anim_frames)}U, {1 + len(frames)}U, {speed}U }},')
+            anim_frames += [tiles[tid]] + frames
+        if len(anim_frames) > 256:
+            raise ValueError(f"{name}: {len(anim_frames)} animation frames, at most 256")
+        frame_bytes = tiles_to_2bpp_bytes(anim_frames)
+        c_lines += [
+            '',
+            f'/* Animated tile frames ({len(anim_frames)} frames, raw 2bpp; frame 0 of each',
+            f'   sequence repeats the tile\'s own art).  tile_anim_commit() copies',
+            f'   them over the tile in VRAM; the map is never touched. */',
+            f'BANKREF({name}_anim_frames)',
+            f'const uint8_t {name}_anim_frames[{len(frame_bytes)}] = {{',
+            _format_c_bytes(frame_bytes),
+            '};',
+            '',
+            f'/* {{tile, first frame, frame count, speed}} per animated tile */',
+            f'BANKREF({name}_anims)',
+            f'const TileAnim {name}_anims[{len(anim_rows)}] = {{',
+        ] + anim_rows + [
+            '};',
+            '',
+            f'BANKREF({name}_tile_anims)',
+            f'const TileAnimSet {name}_tile_anims = {{',
+            f'    {name}_anim_frames, {name}_anims, {len(anim_rows)}U',
+            '};',
+        ]
+
+    is_level = goal_x16 is not None
+    if is_level:
+        if attr_map is None or collision_tile_ids is None or collision_down_tile_ids is None:
+            raise ValueError(f"{name}: a level (goal_x16) needs attr_map and both collision lists")
+        px, py = player_spawn or (0, 0)
+        ex, ey = (enemy_spawn or (0, 0))[:2]
+        ebhv = '0U'
+        if enemy_spawn and len(enemy_spawn) > 2:
+            ebhv = f'BHV_{enemy_spawn[2].upper()}'
+            c_lines.insert(4, f'#include "{BHV_HEADER}"')
+        for v in (px, py, ex, ey):
+            if not 0 <= int(v) <= 255:
+                raise ValueError(f"{name}: spawn coordinate {v} is outside uint8_t range (0-255)")
+        cp_ptr = f'{name}_checkpoints' if checkpoints is not None else 'NULL'
+        anim_ptr = f'&{name}_tile_anims' if anim_ids else 'NULL'
+        n_cp   = len(checkpoints) if checkpoints is not None else 0
+        c_lines += [
+            '',
+            '/* Level descriptor, in the same bank as the data it points to.',
+            '   Read it through level_select() (src/lib/include/level.h). */',
+            f'BANKREF({name}_level)',
+            f'const Level {name}_level = {{',
+            f'    {name}_tiles, {name}_palettes, {name}_map, {name}_attr_map,',
+            f'    {name}_collision_tiles, {name}_collision_down_tiles, {cp_ptr},',
+            f'    {anim_ptr}, NULL,',
+            f'    {NAME}_GOAL_X16,',
+            f'    {NAME}_MAP_WIDTH, {NAME}_MAP_HEIGHT,',
+            f'    {NAME}_TILE_COUNT, {NAME}_TILE_CODEC, {NAME}_PALETTE_COUNT,',
+            f'    {len(collision_tile_ids)}U, {len(collision_down_tile_ids)}U, {n_cp}U,',
+            f'    {int(px)}U, {int(py)}U, {int(ex)}U, {int(ey)}U, {ebhv}',
+            '};',
+        ]
+
+    if runner:
+        if not is_level:
+            raise ValueError(f"{name}: a runner needs the background to be a level (goal_x16)")
+        c_lines += _runner_c_lines(name, NAME, runner, map_height, anim_ptr,
+                                   len(collision_tile_ids), len(collision_down_tile_ids),
+                                   (px, py, ex, ey, ebhv))
 
     c_path = os.path.join(out_dir, f'{name}.c')
-    with open(c_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(c_lines) + '\n')
-    print(f'Written {c_path}')
+    write_if_changed(c_path, '\n'.join(c_lines) + '\n')
 
     h_guard = f'{NAME}_H'
     h_lines = [
@@ -247,11 +861,21 @@ def write_background_files(name, tiles, tilemap, palette_colors,
         '#include <gbdk/platform.h>',
         '#include <gb/cgb.h>',
         '#include <stdint.h>',
+        '#include "pb16.h"',
+        '#include "vram.h"',
+    ] + (['#include "tile_anim.h"'] if anim_ids else []) + (
+        ['#include "level.h"'] if is_level else []) + [
         '',
         f'#define {NAME}_TILE_COUNT    {tile_count}U',
         f'#define {NAME}_PALETTE_COUNT {palette_count}U',
         f'#define {NAME}_MAP_WIDTH     {map_width}U',
         f'#define {NAME}_MAP_HEIGHT    {map_height}U',
+    ] + _tile_loader_h_lines(name, NAME, tile_codec, total_tile_b)
+    if goal_x16 is not None:
+        h_lines.append(f'#define {NAME}_GOAL_X16      {int(goal_x16)}U')
+    for tname, tid in (tile_names or {}).items():
+        h_lines.append(f'#define {NAME}_TILE_{tname.upper()}  {int(tid)}U')
+    h_lines += [
         '',
         f'BANKREF_EXTERN({name}_palettes)',
         f'BANKREF_EXTERN({name}_tiles)',
@@ -265,6 +889,18 @@ def write_background_files(name, tiles, tilemap, palette_colors,
         h_lines.append(f'BANKREF_EXTERN({name}_collision_down_tiles)')
     if collision_tile_ids is not None:
         h_lines.append(f'BANKREF_EXTERN({name}_collision_tiles)')
+    if checkpoints is not None:
+        h_lines.append(f'BANKREF_EXTERN({name}_checkpoints)')
+    if anim_ids:
+        h_lines += [
+            f'BANKREF_EXTERN({name}_anim_frames)',
+            f'BANKREF_EXTERN({name}_anims)',
+            f'BANKREF_EXTERN({name}_tile_anims)',
+        ]
+    if is_level:
+        h_lines.append(f'BANKREF_EXTERN({name}_level)')
+    if runner:
+        h_lines.append(f'BANKREF_EXTERN({name}_runner_level)')
     
     # Now add all extern declarations (grouped together)
     h_lines += [
@@ -291,13 +927,32 @@ def write_background_files(name, tiles, tilemap, palette_colors,
             f'#define {NAME}_COLLISION_TILE_COUNT {n_coll}U',
             f'extern const uint8_t {name}_collision_tiles[{n_coll}];',
         ]
+
+    if checkpoints is not None:
+        n_cp = len(checkpoints)
+        h_lines += [
+            f'#define {NAME}_CHECKPOINT_COUNT {n_cp}U',
+            f'extern const uint16_t {name}_checkpoints[{n_cp}];',
+        ]
+
+    if anim_ids:
+        n_frames = sum(1 + len(f) for _, f in anim_ids.values())
+        h_lines += [
+            f'#define {NAME}_ANIM_TILE_COUNT {len(anim_ids)}U',
+            f'extern const uint8_t {name}_anim_frames[{n_frames * 16}];',
+            f'extern const TileAnim {name}_anims[{len(anim_ids)}];',
+            f'extern const TileAnimSet {name}_tile_anims;',
+        ]
+
+    if is_level:
+        h_lines.append(f'extern const Level {name}_level;')
+    if runner:
+        h_lines.append(f'extern const Level {name}_runner_level;')
     
     h_lines += ['', '#endif']
 
     h_path = os.path.join(out_dir, f'{name}.h')
-    with open(h_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(h_lines) + '\n')
-    print(f'Written {h_path}')
+    write_if_changed(h_path, '\n'.join(h_lines) + '\n')
 
 
 # ---------------------------------------------------------------------------
@@ -305,15 +960,16 @@ def write_background_files(name, tiles, tilemap, palette_colors,
 # ---------------------------------------------------------------------------
 
 def write_font_files(name, tiles, palette_colors, extra_defines=None, out_dir='.',
-                     generator='gen_font.py'):
+                     tile_codec='raw', generator='gen_font.py'):
     """Write font .c and .h files.
 
     extra_defines : optional list of (define_name, value, comment) tuples
                     appended to the .h file after FONT_TILE_COUNT.
+    tile_codec    : 'auto', 'raw' or 'pb16' storage for <name>_tiles (see encode_tile_data).
     """
     tile_count      = len(tiles)
     palette_count   = len(palette_colors) // 4
-    tile_bytes      = tiles_to_2bpp_bytes(tiles)
+    tile_bytes, tile_codec = encode_tile_data(name, tiles_to_2bpp_bytes(tiles), tile_codec)
     total_tile_b    = len(tile_bytes)
     pal_count_total = len(palette_colors)
     NAME = name.upper()
@@ -333,16 +989,14 @@ def write_font_files(name, tiles, palette_colors, extra_defines=None, out_dir='.
         _format_palette_array(palette_colors),
         '};',
         '',
-        f'/* Font tile data ({tile_count} tiles, 16 bytes each) */',
+        f'/* Font tile data ({tile_count} tiles, {_codec_desc(tile_codec)}) */',
         f'BANKREF({name}_tiles)',
         f'const uint8_t {name}_tiles[{total_tile_b}] = {{',
         _format_c_bytes(tile_bytes),
         '};',
     ]
     c_path = os.path.join(out_dir, f'{name}.c')
-    with open(c_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(c_lines) + '\n')
-    print(f'Written {c_path}')
+    write_if_changed(c_path, '\n'.join(c_lines) + '\n')
 
     h_guard = f'{NAME}_H'
     h_lines = [
@@ -353,10 +1007,12 @@ def write_font_files(name, tiles, palette_colors, extra_defines=None, out_dir='.
         '#include <gbdk/platform.h>',
         '#include <gb/cgb.h>',
         '#include <stdint.h>',
+        '#include "pb16.h"',
+        '#include "vram.h"',
         '',
         f'#define {NAME}_TILE_COUNT    {tile_count}U',
         f'#define {NAME}_PALETTE_COUNT {palette_count}U',
-    ]
+    ] + _tile_loader_h_lines(name, NAME, tile_codec, total_tile_b)
     if extra_defines:
         h_lines.append('')
         for def_name, def_val, def_comment in extra_defines:
@@ -373,9 +1029,90 @@ def write_font_files(name, tiles, palette_colors, extra_defines=None, out_dir='.
         '#endif',
     ]
     h_path = os.path.join(out_dir, f'{name}.h')
-    with open(h_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(h_lines) + '\n')
-    print(f'Written {h_path}')
+    write_if_changed(h_path, '\n'.join(h_lines) + '\n')
+
+
+def write_vwf_font_files(name, bitmaps, first_char=32, space_width=3, out_dir='.',
+                         generator='gen_font.py'):
+    """Write a variable-width font (<name>_vwf.c / .h) for src/lib vwf.
+
+    bitmaps     : glyph bitmaps, 8 row bytes each, bit 7 = leftmost pixel
+                  (the same FONT_BITMAPS the fixed font is built from).
+    first_char  : character code of bitmaps[0].
+    space_width : advance of glyphs with no pixels set.
+
+    Each glyph is moved to its leftmost used column and advances by its
+    used width plus a 1-pixel gap.  Rows below the lowest pixel of the
+    whole font are dropped, then every glyph is stored pre-shifted for
+    pixel offsets 0-7: height bytes for the pen tile (row >> s) followed
+    by height bytes for the next tile (row << (8 - s)).
+    """
+    trimmed, widths = [], []
+    for bm in bitmaps:
+        used = 0
+        for row in bm:
+            used |= row
+        if not used:
+            trimmed.append([0] * 8)
+            widths.append(space_width)
+            continue
+        lead = next(c for c in range(8) if used & (0x80 >> c))
+        last = max(c for c in range(8) if used & (0x80 >> c))
+        trimmed.append([(row << lead) & 0xFF for row in bm])
+        widths.append(last - lead + 2)
+    height = max((r + 1 for bm in trimmed for r in range(8) if bm[r]), default=1)
+
+    glyph_bytes = []
+    for bm in trimmed:
+        for s in range(8):
+            glyph_bytes += [bm[r] >> s for r in range(height)]
+            glyph_bytes += [(bm[r] << (8 - s)) & 0xFF for r in range(height)]
+
+    vname = f'{name}_vwf'
+    VNAME = vname.upper()
+    n = len(trimmed)
+    c_lines = [
+        f'/* Auto-generated by tools/{generator} - edit that script to change. */',
+        '#pragma bank 255',
+        '',
+        '#include <gbdk/platform.h>',
+        f'#include "{vname}.h"',
+        '',
+        f'/* Advance per glyph in pixels, 1-pixel gap included */',
+        f'static const uint8_t {vname}_widths[{n}] = {{',
+        _format_c_bytes(widths),
+        '};',
+        '',
+        f'/* {n} glyphs x 8 pixel offsets x ({height} pen-tile rows + {height} spill rows) */',
+        f'static const uint8_t {vname}_glyphs[{len(glyph_bytes)}] = {{',
+        _format_c_bytes(glyph_bytes),
+        '};',
+        '',
+        f'BANKREF({vname})',
+        f'const vwf_font_t {vname} = {{',
+        f'    {vname}_widths, {vname}_glyphs, {first_char}U, {n}U, {height}U',
+        '};',
+    ]
+    write_if_changed(os.path.join(out_dir, f'{vname}.c'), '\n'.join(c_lines) + '\n')
+
+    h_lines = [
+        f'/* Auto-generated by tools/{generator} - edit that script to change. */',
+        f'#ifndef {VNAME}_H',
+        f'#define {VNAME}_H',
+        '',
+        '#include <gbdk/platform.h>',
+        '#include "vwf.h"',
+        '',
+        f'#define {VNAME}_GLYPH_COUNT {n}U',
+        f'#define {VNAME}_HEIGHT      {height}U',
+        '',
+        f'BANKREF_EXTERN({vname})',
+        f'extern const vwf_font_t {vname};',
+        '',
+        '#endif',
+    ]
+    write_if_changed(os.path.join(out_dir, f'{vname}.h'), '\n'.join(h_lines) + '\n')
+    print(f'{vname}: {n} glyphs, {height} rows, {len(glyph_bytes) + n} bytes')
 
 
 # ---------------------------------------------------------------------------
@@ -383,11 +1120,12 @@ def write_font_files(name, tiles, palette_colors, extra_defines=None, out_dir='.
 # ---------------------------------------------------------------------------
 
 def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir='.',
-                       generator='gen_sprite.py', use_autobank=True):
+                       generator='gen_sprite.py', use_autobank=True, tile_codec='raw'):
     """Write sprite .c and .h for a single walk-cycle in 8x16 sprite mode.
     
     use_autobank: If True, generates #pragma bank 255 and BANKREF() directives.
                   If False, keeps data in Bank 0 (no autobanking).
+    tile_codec  : 'auto', 'raw' or 'pb16' storage for <name>_tiles (see encode_tile_data).
     """
     assert len(frames_top) == len(frames_bottom)
     frame_count     = len(frames_top)
@@ -398,7 +1136,7 @@ def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir=
     for top, bot in zip(frames_top, frames_bottom):
         all_tiles.append(top)
         all_tiles.append(bot)
-    tile_bytes  = tiles_to_2bpp_bytes(all_tiles)
+    tile_bytes, tile_codec = encode_tile_data(name, tiles_to_2bpp_bytes(all_tiles), tile_codec)
     total_tile_b = len(tile_bytes)
     NAME = name.upper()
 
@@ -421,7 +1159,8 @@ def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir=
         _format_palette_array(palette_colors),
         '};',
         '',
-        f'/* Sprite tiles: {frame_count} frames x {tiles_per_frame} tiles = {tile_count} tiles */',
+        f'/* Sprite tiles: {frame_count} frames x {tiles_per_frame} tiles = {tile_count} tiles, '
+        f'{_codec_desc(tile_codec)} */',
     ]
     if use_autobank:
         c_lines.append(f'BANKREF({name}_tiles)')
@@ -431,9 +1170,7 @@ def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir=
         '};',
     ]
     c_path = os.path.join(out_dir, f'{name}.c')
-    with open(c_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(c_lines) + '\n')
-    print(f'Written {c_path}')
+    write_if_changed(c_path, '\n'.join(c_lines) + '\n')
 
     h_guard = f'{NAME}_H'
     h_lines = [
@@ -444,11 +1181,15 @@ def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir=
         '#include <gbdk/platform.h>',
         '#include <gb/cgb.h>',
         '#include <stdint.h>',
+        '#include "pb16.h"',
+        '#include "vram.h"',
         '',
         f'#define {NAME}_TILE_COUNT      {tile_count}U',
         f'#define {NAME}_PALETTE_COUNT    1U',
         f'#define {NAME}_FRAME_COUNT      {frame_count}U',
         f'#define {NAME}_TILES_PER_FRAME  {tiles_per_frame}U',
+    ] + _tile_loader_h_lines(name, NAME, tile_codec, total_tile_b, 'sprite',
+                           use_autobank) + [
         '',
     ]
     if use_autobank:
@@ -464,9 +1205,7 @@ def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir=
         '#endif',
     ]
     h_path = os.path.join(out_dir, f'{name}.h')
-    with open(h_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(h_lines) + '\n')
-    print(f'Written {h_path}')
+    write_if_changed(h_path, '\n'.join(h_lines) + '\n')
 
 
 # ---------------------------------------------------------------------------
@@ -475,7 +1214,8 @@ def write_sprite_files(name, frames_top, frames_bottom, palette_colors, out_dir=
 
 def write_sprite_files_animated(name, animations, palette_colors,
                                    pixel_chars, out_dir='.', size='8x16',
-                                   anim_speeds=None, use_autobank=True):
+                                   anim_speeds=None, use_autobank=True,
+                                   tile_codec='raw'):
     """Write .c and .h for a sprite with multiple named animations.
 
     name          : base symbol name, e.g. 'player'.
@@ -498,6 +1238,8 @@ def write_sprite_files_animated(name, animations, palette_colors,
                     <NAME>_ANIM_<ANIM>_SPEED defines in the .h file.
     use_autobank  : If True, generates #pragma bank 255 and BANKREF() directives.
                     If False, keeps data in Bank 0 (no autobanking).
+    tile_codec    : 'auto', 'raw' or 'pb16' storage for <name>_tiles (see encode_tile_data);
+                    load with <NAME>_SET_TILES(first) either way.
     """
     def _parse_tile_rows(string_rows):
         tile = []
@@ -559,7 +1301,7 @@ def write_sprite_files_animated(name, animations, palette_colors,
     tile_count      = len(all_tiles)
     n_frames_total  = tile_count // tiles_per_frame
     pal_count_total = len(palette_colors)
-    tile_bytes      = tiles_to_2bpp_bytes(all_tiles)
+    tile_bytes, tile_codec = encode_tile_data(name, tiles_to_2bpp_bytes(all_tiles), tile_codec)
     total_tile_b    = len(tile_bytes)
     NAME = name.upper()
 
@@ -583,7 +1325,8 @@ def write_sprite_files_animated(name, animations, palette_colors,
         _format_palette_array(palette_colors),
         '};',
         '',
-        f'/* Sprite tiles: {tile_count} tiles total ({n_frames_total} frames, {tiles_per_frame} tiles/frame) */',
+        f'/* Sprite tiles: {tile_count} tiles total ({n_frames_total} frames, {tiles_per_frame} tiles/frame), '
+        f'{_codec_desc(tile_codec)} */',
     ]
     if use_autobank:
         c_lines.append(f'BANKREF({name}_tiles)')
@@ -593,9 +1336,7 @@ def write_sprite_files_animated(name, animations, palette_colors,
         '};',
     ]
     c_path = os.path.join(out_dir, f'{name}.c')
-    with open(c_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(c_lines) + '\n')
-    print(f'Written {c_path}')
+    write_if_changed(c_path, '\n'.join(c_lines) + '\n')
 
     # .h file
     h_guard = f'{NAME}_H'
@@ -607,10 +1348,14 @@ def write_sprite_files_animated(name, animations, palette_colors,
         '#include <gbdk/platform.h>',
         '#include <gb/cgb.h>',
         '#include <stdint.h>',
+        '#include "pb16.h"',
+        '#include "vram.h"',
         '',
         f'#define {NAME}_TILE_COUNT      {tile_count}U',
         f'#define {NAME}_PALETTE_COUNT    1U',
         f'#define {NAME}_TILES_PER_FRAME  {tiles_per_frame}U',
+    ] + _tile_loader_h_lines(name, NAME, tile_codec, total_tile_b, 'sprite',
+                           use_autobank) + [
         '',
     ]
     for anim_name, start_tile, frame_count in anim_info:
@@ -635,6 +1380,270 @@ def write_sprite_files_animated(name, animations, palette_colors,
         '#endif',
     ]
     h_path = os.path.join(out_dir, f'{name}.h')
-    with open(h_path, 'w', encoding='utf-8') as f:
-        f.write('\n'.join(h_lines) + '\n')
-    print(f'Written {h_path}')
+    write_if_changed(h_path, '\n'.join(h_lines) + '\n')
+
+
+# ---------------------------------------------------------------------------
+# Sound effect file writer
+# ---------------------------------------------------------------------------
+
+# APU register low addresses (0xFF00 + value)
+SFX_REGISTERS = {
+    'NR10': 0x10, 'NR11': 0x11, 'NR12': 0x12, 'NR13': 0x13, 'NR14': 0x14,
+    'NR21': 0x16, 'NR22': 0x17, 'NR23': 0x18, 'NR24': 0x19,
+    'NR30': 0x1A, 'NR31': 0x1B, 'NR32': 0x1C, 'NR33': 0x1D, 'NR34': 0x1E,
+    'NR41': 0x20, 'NR42': 0x21, 'NR43': 0x22, 'NR44': 0x23,
+    'NR50': 0x24, 'NR51': 0x25,
+}
+SFX_TRIGGER_REGISTERS = ('NR14', 'NR24', 'NR34', 'NR44')
+SFX_CHANNEL_BITS = {'CH1': 0x01, 'CH2': 0x02, 'CH3': 0x04, 'CH4': 0x08}
+
+
+def write_sfx_files(name, effects, out_dir='.', generator='gen_sfx.py'):
+    """Write sound effect .c and .h files.
+
+    effects : list of dicts with keys
+                name     - effect name; the header gets SFX_<NAME> ids
+                channels - list of 'CH1'..'CH4' the effect may play on;
+                           register writes address the first of them
+                priority - default priority (SFX_PRIO_LOW..SFX_PRIO_HIGH = 1..3)
+                frames   - list of (vbls, [(register_name, value), ...])
+
+    The trigger bit (bit 7) is set on NRx4 writes in an effect's first
+    frame so every effect starts a fresh note.  The tables are placed in
+    bank 0: sfx_update() reads them every frame from the main loop.
+    """
+    NAME = name.upper()
+    c_lines = [
+        f'/* Auto-generated by tools/{generator} - edit that script to change. */',
+        '/* No #pragma bank: sfx_update() reads these tables every frame from bank 0. */',
+        '',
+        '#include <stddef.h>',
+        '#include <stdint.h>',
+        '#include "sfx.h"',
+        f'#include "{name}.h"',
+    ]
+    ids = []
+    for e_idx, effect in enumerate(effects):
+        ename  = effect['name'].lower()
+        frames = effect['frames']
+        if not frames:
+            raise ValueError(f'sfx {ename}: needs at least one frame')
+        mask = 0
+        for ch in effect['channels']:
+            mask |= SFX_CHANNEL_BITS[ch]
+        c_lines += ['', f'/* {effect["name"]} */']
+        frame_rows = []
+        for f_idx, (vbls, writes) in enumerate(frames):
+            if not 0 <= vbls <= 255:
+                raise ValueError(f'sfx {ename}: frame {f_idx} vbls out of range')
+            ops = []
+            for reg, val in writes:
+                if reg not in SFX_REGISTERS:
+                    raise ValueError(f'sfx {ename}: unknown register {reg}')
+                if f_idx == 0 and reg in SFX_TRIGGER_REGISTERS:
+                    val |= 0x80
+                ops.append(f'{{ 0x{SFX_REGISTERS[reg]:02X}U, 0x{val & 0xFF:02X}U }}')
+            if ops:
+                ops_name = f'{ename}_ops{f_idx}'
+                c_lines.append(f'static const sfx_write_t {ops_name}[{len(ops)}] = {{ '
+                               + ', '.join(ops) + ' };')
+            else:
+                ops_name = 'NULL'     # hold: channel stays busy, no writes
+            frame_rows.append(f'    {{ {vbls}U, {ops_name}, {len(ops)}U }}')
+        c_lines.append(f'static const sfx_frame_t {ename}_frames[{len(frames)}] = {{')
+        c_lines.append(',\n'.join(frame_rows))
+        c_lines.append('};')
+        ids.append((effect['name'].upper(), e_idx, mask,
+                    int(effect.get('priority', 2)), ename, len(frames)))
+
+    c_lines += ['', f'const sfx_def_t sfx_defs[{len(effects)}] = {{']
+    c_lines.append('\n'.join(
+        f'    {{ 0x{mask:02X}U, {prio}U, {ename}_frames, {count}U }}'
+        + (',' if e_idx < len(ids) - 1 else ' ')
+        + f'  /* SFX_{ename.upper()} */'
+        for _, e_idx, mask, prio, ename, count in ids))
+    c_lines += ['};', f'const uint8_t   sfx_defs_count = {len(effects)}U;']
+
+    c_path = os.path.join(out_dir, f'{name}.c')
+    write_if_changed(c_path, '\n'.join(c_lines) + '\n')
+
+    h_lines = [
+        f'/* Auto-generated by tools/{generator} - edit that script to change. */',
+        f'#ifndef {NAME}_H',
+        f'#define {NAME}_H',
+        '',
+        '/* Effect ids for sfx_play() */',
+    ]
+    width = max(len(ident) for ident, *_ in ids)
+    for ident, e_idx, _, _, _, _ in ids:
+        h_lines.append(f'#define SFX_{ident:<{width}}  {e_idx}U')
+    h_lines += [
+        '',
+        f'#define SFX_{"COUNT":<{width}}  {len(effects)}U',
+        '',
+        '#endif',
+    ]
+    h_path = os.path.join(out_dir, f'{name}.h')
+    write_if_changed(h_path, '\n'.join(h_lines) + '\n')
+
+
+# ---------------------------------------------------------------------------
+# Behaviour script assembler
+# ---------------------------------------------------------------------------
+
+# mnemonic: operand kinds ('b' byte, 'l' label); emitted as BHV_OP_<MNEMONIC>
+# (src/lib/include/behaviour.h)
+BHV_OPCODES = {
+    'end': '', 'walk': 'b', 'wait': 'b', 'turn': '', 'turn_at_edge': '',
+    'face': '', 'jump': 'b', 'fire': '', 'near': 'bl', 'far': 'bl',
+    'anim': 'bbb', 'goto': 'l',
+}
+BHV_MAX_LEN = 255
+BHV_HEADER = 'behaviours.h'   # the project's behaviour set (res/behaviours/enemy)
+BHV_RESERVED = ('BUDGET', 'FALL_MAX', 'MAX_LEN', 'COUNT')
+
+
+def _bhv_byte(where, text):
+    """A byte operand: a number, or a C constant emitted as is."""
+    try:
+        v = int(text, 0)
+    except ValueError:
+        if not text.replace('_', 'A').isalnum() or text[0].isdigit():
+            raise ValueError(f'{where}: bad operand {text!r}')
+        return text
+    if not 0 <= v <= 255:
+        raise ValueError(f'{where}: operand {v} is outside 0-255')
+    return f'{v}U'
+
+
+def assemble_behaviour(name, source):
+    """Assemble one behaviour script.
+
+    One instruction per line, 'label:' lines, ';' comments; operands are
+    separated by commas or spaces.  'anim NAME' is short for
+    'anim NAME_START, NAME_FRAMES, NAME_SPEED' (the animation constants a
+    generated sprite header defines).  Returns [(offset, [C byte
+    expressions], source line)], one entry per instruction.
+    """
+    parsed, labels, pc = [], {}, 0
+    for n, line in enumerate(source.splitlines(), 1):
+        where = f'behaviour {name} line {n}'
+        text = line.split(';', 1)[0].strip()
+        while ':' in text:
+            label, text = text.split(':', 1)
+            label, text = label.strip(), text.strip()
+            if not label.isidentifier() or label in labels:
+                raise ValueError(f'{where}: bad or duplicate label {label!r}')
+            labels[label] = pc
+        if not text:
+            continue
+        words = text.replace(',', ' ').split()
+        op, args = words[0].lower(), words[1:]
+        if op not in BHV_OPCODES:
+            raise ValueError(f'{where}: unknown instruction {words[0]!r}')
+        kinds = BHV_OPCODES[op]
+        if op == 'anim' and len(args) == 1 and not args[0][0].isdigit():
+            args = [f'{args[0]}_{part}' for part in ('START', 'FRAMES', 'SPEED')]
+        if len(args) != len(kinds):
+            raise ValueError(f'{where}: {op} takes {len(kinds)} operand(s)')
+        parsed.append((pc, op, kinds, args, where, text))
+        pc += 1 + len(kinds)
+    if pc > BHV_MAX_LEN:
+        raise ValueError(f'behaviour {name}: {pc} bytes, at most {BHV_MAX_LEN}')
+    if not parsed:
+        raise ValueError(f'behaviour {name}: empty script')
+
+    out = []
+    for pc, op, kinds, args, where, text in parsed:
+        data = [f'BHV_OP_{op.upper()}']
+        for kind, arg in zip(kinds, args):
+            if kind == 'l':
+                if arg not in labels:
+                    raise ValueError(f'{where}: unknown label {arg!r}')
+                data.append(f'{labels[arg]}U')
+            else:
+                data.append(_bhv_byte(where, arg))
+        out.append((pc, data, text))
+    return out
+
+
+def write_behaviour_files(name, scripts, includes=(), out_dir='.',
+                          generator='gen_behaviour.py'):
+    """Write behaviour script .c and .h files.
+
+    scripts  : {script name: assembly source} (see assemble_behaviour);
+               the header gets BHV_<NAME> ids in this order.
+    includes : headers the operands need (e.g. a sprite's animation
+               constants).
+
+    The scripts and the <name>[] table of script pointers are autobanked;
+    behaviour_start() switches to BANK(<name>) to read them.
+    """
+    NAME = name.upper()
+    ids = []
+    for sname in scripts:
+        ident = sname.upper()
+        if not ident.isidentifier() or ident in BHV_RESERVED or ident[:3] in ('OP_', 'EV_'):
+            raise ValueError(f'behaviour name {sname!r} is not usable as BHV_{ident}')
+        ids.append(ident)
+
+    c_lines = [
+        f'/* Auto-generated by tools/{generator} - edit that script to change. */',
+        '#pragma bank 255',
+        '',
+        '#include <gbdk/platform.h>',
+        '#include <stdint.h>',
+        '#include "behaviour.h"',
+    ] + [f'#include "{h}"' for h in includes] + [
+        f'#include "{name}.h"',
+    ]
+    total = 0
+    for sname, source in scripts.items():
+        code = assemble_behaviour(sname, source)
+        size = sum(len(data) for _, data, _ in code)
+        total += size
+        cname = f'{name}_{sname.lower()}'
+        rows = [f'    {", ".join(data)},' for _, data, _ in code]
+        width = max(len(r) for r in rows)
+        c_lines += ['', f'/* {sname} ({size} bytes) */',
+                    f'static const uint8_t {cname}[{size}] = {{']
+        c_lines += [f'{r:<{width}}  /* {pc:3}: {text} */'
+                    for r, (pc, _, text) in zip(rows, code)]
+        c_lines.append('};')
+
+    c_lines += [
+        '',
+        f'BANKREF({name})',
+        f'const uint8_t * const {name}[{len(scripts)}] = {{',
+        ',\n'.join(f'    {name}_{s.lower()}' for s in scripts),
+        '};',
+    ]
+    c_path = os.path.join(out_dir, f'{name}.c')
+    write_if_changed(c_path, '\n'.join(c_lines) + '\n')
+
+    h_lines = [
+        f'/* Auto-generated by tools/{generator} - edit that script to change. */',
+        f'#ifndef {NAME}_H',
+        f'#define {NAME}_H',
+        '',
+        '#include <gbdk/platform.h>',
+        '#include <stdint.h>',
+        '',
+        '/* Script ids for behaviour_start() */',
+    ]
+    width = max(len(ident) for ident in ids + ['COUNT'])
+    for i, ident in enumerate(ids):
+        h_lines.append(f'#define BHV_{ident:<{width}}  {i}U')
+    h_lines += [
+        '',
+        f'#define BHV_{"COUNT":<{width}}  {len(ids)}U',
+        '',
+        f'BANKREF_EXTERN({name})',
+        f'extern const uint8_t * const {name}[{len(ids)}];',
+        '',
+        '#endif',
+    ]
+    h_path = os.path.join(out_dir, f'{name}.h')
+    write_if_changed(h_path, '\n'.join(h_lines) + '\n')
+    print(f'  {len(ids)} behaviour script(s), {total} bytes')
@@ -20,6 +20,49 @@ Adding a new background
      PALETTE_COLORS– (r,g,b) tuples, length == n_palettes * 4
      MAP_W, MAP_H  – tilemap dimensions in tiles
      ATTR_MAP      – flat list of per-tile palette attribute bytes
+   Optional:
+     CHECKPOINTS   – ascending list of world-X respawn positions (pixels)
+     GOAL_X16      – world-X (pixels) that completes the level; makes the
+                     background a level with a <name>_level descriptor
+                     (needs ATTR_MAP and both COLLISION_* lists)
+     PLAYER_SPAWN  – (x, y) world pixels where the player starts the level
+     ENEMY_SPAWN   – (x, y) world pixels where the enemy starts, optionally
+                     followed by the name of its behaviour script (default
+                     the first script in res/behaviours/enemy)
+     TILE_NAMES    – {name: tile index} exported as <NAME>_TILE_<name>
+                     (tile indices change when duplicate tiles are merged)
+     DEDUPE_TILES  – False to keep tiles exactly as given (default True:
+                     tiles equal up to an X/Y flip are merged)
+     TILE_CODEC    – 'raw' (default), 'pb16' or 'auto' (pb16 when it pays
+                     for its unpack time); load the tiles with
+                     <NAME>_SET_TILES(first), which matches the codec
+     ANIMATED_TILES– {TILE_NAMES key: (speed, [8x8 frame grids])}: the
+                     tile's data is swapped for each frame in turn (its
+                     own art first), speed frames (1/60 s) apart, giving
+                     <name>_tile_anims for tile_anim_start()
+     RUNNER        – a generated level on this tile set (levels only):
+                     <name>_runner_level, with no map and no end.  Keys:
+                     'chunks' (8-character column patterns: '#' ground,
+                     '.' pit, 'B' block on ground, '-' ledge over a pit,
+                     '=' ledge over ground; chunk 0 all '#', every chunk
+                     starting and ending on '#'), 'flat_chunks',
+                     'ground_row', 'ledge_row' and 'tiles' ({kind: (tile
+                     index, attribute)} for SKY, GRASS, SOIL, DEEP, BLOCK,
+                     LEDGE).  It has no goal; the game places
+                     checkpoints on chunk edges (state_gameplay.c).
+                     See level.h.
+
+   Full-colour art instead of hand-packed palettes
+   -----------------------------------------------
+   Set SOURCE_IMAGE to an RGB PNG (path relative to definition.py, size a
+   multiple of 8) and leave out TILES, TILEMAP_FLAT, PALETTE_COLORS, MAP_W,
+   MAP_H and ATTR_MAP: the builder cuts the art into tiles, packs the
+   colours of every 8x8 cell into 4-colour CGB palettes (merging palettes
+   that are subsets of others), writes the attr map and prints a palette
+   usage report.  Any 4 colours per cell are fine; the art as a whole must
+   fit in MAX_PALETTES palettes (default 2 – slots 2-4 hold the font and
+   HUD palettes).  Tile IDs in COLLISION_* lists and TILE_NAMES are then
+   map cell indices (y * width + x), remapped like any other tile ID.
 3. Run  make generate  (or  python3 tools/gen_background.py)
 
 Output per background
@@ -39,7 +82,12 @@ TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
 REPO_ROOT = os.path.dirname(TOOLS_DIR)
 sys.path.insert(0, TOOLS_DIR)
 
-from gbc_asset_builder import make_indexed_png, write_background_files
+from gbc_asset_builder import (image_to_background, make_indexed_png,
+                               write_background_files)
+
+# Background palette slots a SOURCE_IMAGE may fill by default: the states
+# load the font palette into slot 2 and main.c the HUD palettes into 3-4.
+DEFAULT_MAX_PALETTES = 2
 
 
 def _load_definition(path):
@@ -55,36 +103,57 @@ def process_definition(defn_path):
     mod = _load_definition(defn_path)
 
     name               = mod.NAME
-    tiles              = mod.TILES
-    tilemap_flat       = mod.TILEMAP_FLAT
-    palette_colors     = mod.PALETTE_COLORS
-    map_w              = mod.MAP_W
-    map_h              = mod.MAP_H
-    attr_map           = mod.ATTR_MAP
     collision_down_tile_ids = getattr(mod, 'COLLISION_TILE_DOWN_IDS', None)
     collision_tile_ids      = getattr(mod, 'COLLISION_TILE_IDS',      None)
+    checkpoints             = getattr(mod, 'CHECKPOINTS',             None)
+    goal_x16                = getattr(mod, 'GOAL_X16',                None)
+    player_spawn            = getattr(mod, 'PLAYER_SPAWN',            None)
+    enemy_spawn             = getattr(mod, 'ENEMY_SPAWN',             None)
+    tile_names              = getattr(mod, 'TILE_NAMES',              None)
+    dedupe                  = getattr(mod, 'DEDUPE_TILES',            True)
+    tile_codec              = getattr(mod, 'TILE_CODEC',              'raw')
+    animated_tiles          = getattr(mod, 'ANIMATED_TILES',          None)
+    runner                  = getattr(mod, 'RUNNER',                  None)
+
+    source_image = getattr(mod, 'SOURCE_IMAGE', None)
+    if source_image is not None:
+        # Full-colour art: tiles, palettes and attr map are all solved here
+        src_path = os.path.join(os.path.dirname(defn_path), source_image)
+        packed = image_to_background(src_path,
+                                     getattr(mod, 'MAX_PALETTES', DEFAULT_MAX_PALETTES))
+        print(f'{name}: {packed["report"]}')
+        tiles          = packed['tiles']
+        tilemap_flat   = packed['tilemap']
+        palette_colors = packed['palette_colors']
+        map_w          = packed['map_w']
+        map_h          = packed['map_h']
+        attr_map       = packed['attr_map']
+    else:
+        tiles          = mod.TILES
+        tilemap_flat   = mod.TILEMAP_FLAT
+        palette_colors = mod.PALETTE_COLORS
+        map_w          = mod.MAP_W
+        map_h          = mod.MAP_H
+        attr_map       = mod.ATTR_MAP
 
     out_dir = os.path.join(REPO_ROOT, 'res')
     os.makedirs(out_dir, exist_ok=True)
 
     # Build preview PNG from tilemap + tiles, honouring per-tile palette via attr_map.
-    # The PNG palette is laid out as: indices 0-3 = palette 0, indices 4-7 = palette 1.
-    # Pixel values for palette-1 tiles are offset by 4 so they look up the right colours.
-    # PALETTE_COLORS must contain at least 8 entries (2 palettes × 4 colours).
-    n_palette0 = 4
-    combined_png_palette = list(palette_colors[:8])  # [pal0_col0..3, pal1_col0..3]
+    # The PNG palette is every CGB palette back to back (palette n = indices 4n..4n+3),
+    # so pixel values are offset by 4 x the tile's palette to look up the right colours.
+    combined_png_palette = list(palette_colors)
     pixel_grid = [[0] * (map_w * 8) for _ in range(map_h * 8)]
     for idx, tile_id in enumerate(tilemap_flat):
         row, col = divmod(idx, map_w)
         tile = tiles[tile_id]
-        palette_offset = n_palette0 if (attr_map and attr_map[idx] & 0x07) else 0
+        palette_offset = 4 * (attr_map[idx] & 0x07) if attr_map else 0
         for ty in range(8):
             for tx in range(8):
                 pixel_grid[row * 8 + ty][col * 8 + tx] = tile[ty][tx] + palette_offset
 
     png_path = os.path.join(out_dir, f'{name}.png')
     make_indexed_png(pixel_grid, combined_png_palette, png_path)
-    print(f'Written {png_path}  ({map_w * 8}x{map_h * 8})')
 
     write_background_files(
         name=name,
@@ -97,10 +166,32 @@ def process_definition(defn_path):
         attr_map=attr_map,
         collision_down_tile_ids=collision_down_tile_ids,
         collision_tile_ids=collision_tile_ids,
+        checkpoints=checkpoints,
+        goal_x16=goal_x16,
+        player_spawn=player_spawn,
+        enemy_spawn=enemy_spawn,
+        dedupe=dedupe,
+        tile_names=tile_names,
+        tile_codec=tile_codec,
+        animated_tiles=animated_tiles,
+        runner=runner,
         generator='gen_background.py',
     )
 
 
+def find_definitions():
+    """Return (entry name, definition.py path) for every res/backgrounds/*/definition.py."""
+    backgrounds_dir = os.path.join(REPO_ROOT, 'res', 'backgrounds')
+    if not os.path.isdir(backgrounds_dir):
+        return []
+    found = []
+    for entry in sorted(os.listdir(backgrounds_dir)):
+        defn_path = os.path.join(backgrounds_dir, entry, 'definition.py')
+        if os.path.isfile(defn_path):
+            found.append((entry, defn_path))
+    return found
+
+
 def main():
     # Allow overriding from command line: python3 gen_background.py path/to/def.py
     if len(sys.argv) > 1:
@@ -109,23 +200,15 @@ def main():
             process_definition(os.path.abspath(defn_path))
         return
 
-    backgrounds_dir = os.path.join(REPO_ROOT, 'res', 'backgrounds')
-    if not os.path.isdir(backgrounds_dir):
-        print(f'No backgrounds directory at {backgrounds_dir} – nothing to do.')
-        return
-
-    found = 0
-    for entry in sorted(os.listdir(backgrounds_dir)):
-        defn_path = os.path.join(backgrounds_dir, entry, 'definition.py')
-        if os.path.isfile(defn_path):
-            print(f'=== Processing background: {entry} ===')
-            process_definition(defn_path)
-            found += 1
+    found = find_definitions()
+    for entry, defn_path in found:
+        print(f'=== Processing background: {entry} ===')
+        process_definition(defn_path)
 
-    if found == 0:
+    if not found:
         print('No background definitions found in res/backgrounds/')
     else:
-        print(f'\nProcessed {found} background(s).')
+        print(f'\nProcessed {len(found)} background(s).')
 
 
 if __name__ == '__main__':
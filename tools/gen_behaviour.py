@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+gen_behaviour.py
+================
+Auto-discovers enemy behaviour definitions in res/behaviours/*/definition.py
+and assembles their scripts into the bytecode tables run by the behaviour
+library (src/lib/include/behaviour.h).
+
+Usage
+-----
+  python3 tools/gen_behaviour.py                                     # process all
+  python3 tools/gen_behaviour.py res/behaviours/enemy/definition.py  # one set
+
+Adding or changing behaviours
+-----------------------------
+Add a script to SCRIPTS in res/behaviours/<name>/definition.py (see the
+instruction list there), then run  make generate  (or  python3
+tools/gen_behaviour.py).  A new enemy type is a new script: ROM bytes in
+an autobanked table, no new code.  Ids are BHV_<SCRIPT>, so a project
+has one behaviour set.
+
+Output
+------
+  res/<name>.c   – one byte array per script and the <name>[] table (autobanked)
+  res/<name>.h   – BHV_<SCRIPT> ids, BHV_COUNT and BANKREF_EXTERN(<name>)
+"""
+
+import importlib.util
+import os
+import sys
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_ROOT = os.path.dirname(TOOLS_DIR)
+sys.path.insert(0, TOOLS_DIR)
+
+from gbc_asset_builder import write_behaviour_files
+
+
+def _load_definition(path):
+    """Import a definition.py file as a Python module."""
+    spec = importlib.util.spec_from_file_location('behaviour_definition', path)
+    mod  = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(mod)
+    return mod
+
+
+def process_definition(defn_path):
+    """Generate .c and .h for one behaviour definition file."""
+    mod = _load_definition(defn_path)
+
+    out_dir = os.path.join(REPO_ROOT, 'res')
+    os.makedirs(out_dir, exist_ok=True)
+
+    write_behaviour_files(
+        name=mod.NAME,
+        scripts=mod.SCRIPTS,
+        includes=getattr(mod, 'INCLUDES', ()),
+        out_dir=out_dir,
+        generator='gen_behaviour.py',
+    )
+
+
+def find_definitions():
+    """Return (entry name, definition.py path) for every res/behaviours/*/definition.py."""
+    bhv_dir = os.path.join(REPO_ROOT, 'res', 'behaviours')
+    if not os.path.isdir(bhv_dir):
+        return []
+    found = []
+    for entry in sorted(os.listdir(bhv_dir)):
+        defn_path = os.path.join(bhv_dir, entry, 'definition.py')
+        if os.path.isfile(defn_path):
+            found.append((entry, defn_path))
+    return found
+
+
+def main():
+    # Allow overriding from command line: python3 gen_behaviour.py path/to/def.py
+    if len(sys.argv) > 1:
+        for defn_path in sys.argv[1:]:
+            print(f'=== Processing {defn_path} ===')
+            process_definition(os.path.abspath(defn_path))
+        return
+
+    found = find_definitions()
+    for entry, defn_path in found:
+        print(f'=== Processing behaviours: {entry} ===')
+        process_definition(defn_path)
+
+    if not found:
+        print('No behaviour definitions found in res/behaviours/')
+    else:
+        print(f'\nProcessed {len(found)} behaviour set(s).')
+
+
+if __name__ == '__main__':
+    main()
@@ -19,6 +19,12 @@ Adding a new font
      PALETTE_COLORS– list of 4 (r,g,b) tuples
      PNG_PALETTE   – list of (r,g,b) tuples for the PNG preview
      EXTRA_DEFINES – optional list of (define_name, value, comment) tuples
+     TILE_CODEC    – optional, 'raw' (default), 'pb16' or 'auto' (pb16
+                     when it pays for its unpack time); load the tiles
+                     with <NAME>_SET_TILES(first)
+     VWF           – optional, True to also emit a variable-width version
+                     for src/lib vwf (res/<name>_vwf.c / .h); glyph i is
+                     character code 32 + i
 3. Run  make generate  (or  python3 tools/gen_font.py)
 
 Output per font
@@ -26,6 +32,8 @@ Output per font
   res/<name>.png   – preview PNG sheet
   res/<name>.c     – GBDK tile data and palette
   res/<name>.h     – header with tile count and extra defines
+  res/<name>_vwf.c – pre-shifted proportional glyphs (only with VWF = True)
+  res/<name>_vwf.h – vwf_font_t <name>_vwf
 
 Requirements:  pip install pillow
 """
@@ -38,7 +46,7 @@ TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
 REPO_ROOT = os.path.dirname(TOOLS_DIR)
 sys.path.insert(0, TOOLS_DIR)
 
-from gbc_asset_builder import make_indexed_png, write_font_files
+from gbc_asset_builder import make_indexed_png, write_font_files, write_vwf_font_files
 
 
 def _load_definition(path):
@@ -66,6 +74,7 @@ def process_definition(defn_path):
     palette_colors = mod.PALETTE_COLORS
     png_palette    = mod.PNG_PALETTE
     extra_defines  = getattr(mod, 'EXTRA_DEFINES', None)
+    tile_codec     = getattr(mod, 'TILE_CODEC', 'raw')
 
     out_dir = os.path.join(REPO_ROOT, 'res')
     os.makedirs(out_dir, exist_ok=True)
@@ -86,7 +95,6 @@ def process_definition(defn_path):
 
     png_path = os.path.join(out_dir, f'{name}.png')
     make_indexed_png(pixel_grid, png_palette, png_path)
-    print(f'Written {png_path}  ({sheet_w}x{sheet_h})')
 
     write_font_files(
         name=name,
@@ -94,9 +102,31 @@ def process_definition(defn_path):
         palette_colors=palette_colors,
         extra_defines=extra_defines,
         out_dir=out_dir,
+        tile_codec=tile_codec,
         generator='gen_font.py',
     )
 
+    if getattr(mod, 'VWF', False):
+        write_vwf_font_files(
+            name=name,
+            bitmaps=font_bitmaps,
+            out_dir=out_dir,
+            generator='gen_font.py',
+        )
+
+
+def find_definitions():
+    """Return (entry name, definition.py path) for every res/fonts/*/definition.py."""
+    fonts_dir = os.path.join(REPO_ROOT, 'res', 'fonts')
+    if not os.path.isdir(fonts_dir):
+        return []
+    found = []
+    for entry in sorted(os.listdir(fonts_dir)):
+        defn_path = os.path.join(fonts_dir, entry, 'definition.py')
+        if os.path.isfile(defn_path):
+            found.append((entry, defn_path))
+    return found
+
 
 def main():
     # Allow overriding from command line: python3 gen_font.py path/to/def.py
@@ -106,23 +136,15 @@ def main():
             process_definition(os.path.abspath(defn_path))
         return
 
-    fonts_dir = os.path.join(REPO_ROOT, 'res', 'fonts')
-    if not os.path.isdir(fonts_dir):
-        print(f'No fonts directory at {fonts_dir} – nothing to do.')
-        return
-
-    found = 0
-    for entry in sorted(os.listdir(fonts_dir)):
-        defn_path = os.path.join(fonts_dir, entry, 'definition.py')
-        if os.path.isfile(defn_path):
-            print(f'=== Processing font: {entry} ===')
-            process_definition(defn_path)
-            found += 1
+    found = find_definitions()
+    for entry, defn_path in found:
+        print(f'=== Processing font: {entry} ===')
+        process_definition(defn_path)
 
-    if found == 0:
+    if not found:
         print('No font definitions found in res/fonts/')
     else:
-        print(f'\nProcessed {found} font(s).')
+        print(f'\nProcessed {len(found)} font(s).')
 
 
 if __name__ == '__main__':
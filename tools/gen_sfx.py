@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+gen_sfx.py
+==========
+Auto-discovers sound effect definitions in res/sfx/*/definition.py and
+generates the const ROM script tables used by the sfx library.
+
+Usage
+-----
+  python3 tools/gen_sfx.py                                  # process all
+  python3 tools/gen_sfx.py res/sfx/default/definition.py    # one set
+
+Adding or changing effects
+--------------------------
+Edit the EFFECTS list in res/sfx/default/definition.py (see the format
+described there), then run  make generate  (or  python3 tools/gen_sfx.py).
+The sfx library links against a single sfx_defs[] table, so a project has
+exactly one effect set.
+
+Output
+------
+  res/<name>.c   – sfx_defs[] table, one frame list per effect (bank 0)
+  res/<name>.h   – SFX_<NAME> ids and SFX_COUNT
+"""
+
+import importlib.util
+import os
+import sys
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_ROOT = os.path.dirname(TOOLS_DIR)
+sys.path.insert(0, TOOLS_DIR)
+
+from gbc_asset_builder import write_sfx_files
+
+
+def _load_definition(path):
+    """Import a definition.py file as a Python module."""
+    spec = importlib.util.spec_from_file_location('sfx_definition', path)
+    mod  = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(mod)
+    return mod
+
+
+def process_definition(defn_path):
+    """Generate .c and .h for one sound effect definition file."""
+    mod = _load_definition(defn_path)
+
+    out_dir = os.path.join(REPO_ROOT, 'res')
+    os.makedirs(out_dir, exist_ok=True)
+
+    write_sfx_files(
+        name=mod.NAME,
+        effects=mod.EFFECTS,
+        out_dir=out_dir,
+        generator='gen_sfx.py',
+    )
+
+
+def find_definitions():
+    """Return (entry name, definition.py path) for every res/sfx/*/definition.py."""
+    sfx_dir = os.path.join(REPO_ROOT, 'res', 'sfx')
+    if not os.path.isdir(sfx_dir):
+        return []
+    found = []
+    for entry in sorted(os.listdir(sfx_dir)):
+        defn_path = os.path.join(sfx_dir, entry, 'definition.py')
+        if os.path.isfile(defn_path):
+            found.append((entry, defn_path))
+    return found
+
+
+def main():
+    # Allow overriding from command line: python3 gen_sfx.py path/to/def.py
+    if len(sys.argv) > 1:
+        for defn_path in sys.argv[1:]:
+            print(f'=== Processing {defn_path} ===')
+            process_definition(os.path.abspath(defn_path))
+        return
+
+    found = find_definitions()
+    for entry, defn_path in found:
+        print(f'=== Processing sfx: {entry} ===')
+        process_definition(defn_path)
+
+    if not found:
+        print('No sfx definitions found in res/sfx/')
+    else:
+        print(f'\nProcessed {len(found)} sfx set(s).')
+
+
+if __name__ == '__main__':
+    main()
@@ -19,6 +19,9 @@ Adding a new sprite
      PIXEL_CHARS  – dict mapping char -> colour index; '.' is always 0
      ANIMATIONS   – dict { anim_name: [(top_rows, bot_rows), ...] }
                     top_rows / bot_rows: list of 8 strings of 8 chars
+     TILE_CODEC   – optional, 'raw' (default), 'pb16' or 'auto' (pb16 when
+                    it pays for its unpack time); load the tiles with
+                    <NAME>_SET_TILES(first)
 3. Run  make generate  (or  python3 tools/gen_sprite.py)
 
 Output
@@ -76,6 +79,7 @@ def process_definition(defn_path):
     size        = getattr(mod, 'SIZE', '8x16')
     anim_speeds = getattr(mod, 'ANIM_SPEEDS', None)
     use_autobank = getattr(mod, 'USE_AUTOBANK', True)  # Default to True for autobanking
+    tile_codec  = getattr(mod, 'TILE_CODEC', 'raw')
 
     animations = mod.ANIMATIONS
 
@@ -107,7 +111,6 @@ def process_definition(defn_path):
 
     png_path = os.path.join(out_dir, f'{name}.png')
     make_indexed_png(pixel_grid, palette, png_path)
-    print(f'Written {png_path}  ({png_dims})')
 
     write_sprite_files_animated(
         name=name,
@@ -118,6 +121,7 @@ def process_definition(defn_path):
         size=size,
         anim_speeds=anim_speeds,
         use_autobank=use_autobank,
+        tile_codec=tile_codec,
     )
 
 
@@ -125,6 +129,19 @@ def process_definition(defn_path):
 # main
 # ---------------------------------------------------------------------------
 
+def find_definitions():
+    """Return (entry name, definition.py path) for every res/sprites/*/definition.py."""
+    sprites_dir = os.path.join(REPO_ROOT, 'res', 'sprites')
+    if not os.path.isdir(sprites_dir):
+        return []
+    found = []
+    for entry in sorted(os.listdir(sprites_dir)):
+        defn_path = os.path.join(sprites_dir, entry, 'definition.py')
+        if os.path.isfile(defn_path):
+            found.append((entry, defn_path))
+    return found
+
+
 def main():
     # Allow overriding from command line: python3 gen_sprite.py path/to/def.py
     if len(sys.argv) > 1:
@@ -133,23 +150,15 @@ def main():
             process_definition(os.path.abspath(defn_path))
         return
 
-    sprites_dir = os.path.join(REPO_ROOT, 'res', 'sprites')
-    if not os.path.isdir(sprites_dir):
-        print(f'No sprites directory at {sprites_dir} – nothing to do.')
-        return
-
-    found = 0
-    for entry in sorted(os.listdir(sprites_dir)):
-        defn_path = os.path.join(sprites_dir, entry, 'definition.py')
-        if os.path.isfile(defn_path):
-            print(f'=== Processing sprite: {entry} ===')
-            process_definition(defn_path)
-            found += 1
+    found = find_definitions()
+    for entry, defn_path in found:
+        print(f'=== Processing sprite: {entry} ===')
+        process_definition(defn_path)
 
-    if found == 0:
+    if not found:
         print('No sprite definitions found in res/sprites/')
     else:
-        print(f'\nProcessed {found} sprite(s).')
+        print(f'\nProcessed {len(found)} sprite(s).')
 
 
 if __name__ == '__main__':
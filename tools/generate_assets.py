@@ -6,38 +6,199 @@ Master script: regenerates all PNG and C/H assets.
 
 Usage
 -----
-    python3 tools/generate_assets.py
+    python3 tools/generate_assets.py            # only assets whose inputs changed
+    python3 tools/generate_assets.py --force    # regenerate everything
+    python3 tools/generate_assets.py -j 4       # limit the worker processes
     make generate
 
-Each generator can also be run individually:
+Each generator can also be run individually (always regenerates):
     python3 tools/gen_background.py   # processes all res/backgrounds/*/definition.py
     python3 tools/gen_font.py         # processes all res/fonts/*/definition.py
     python3 tools/gen_sprite.py       # processes all res/sprites/*/definition.py
+    python3 tools/gen_sfx.py          # processes all res/sfx/*/definition.py
+    python3 tools/gen_behaviour.py    # processes all res/behaviours/*/definition.py
+
+Incremental generation
+----------------------
+Every definition.py is one job.  Its cache key is a SHA-256 over every
+file in the definition's directory (so source art such as a background
+SOURCE_IMAGE counts), the generator script and gbc_asset_builder.py, so
+editing the builder regenerates everything it produces.  A definition
+that loads another one (level2 reuses the gameplay tiles) depends on that
+directory too: the definition files a job executes under res/ are
+recorded and their directories are hashed into its key from then on.
+Keys, dependencies and the output files of each job are kept in
+CACHE_FILE; a job is skipped when its key matches and all of its outputs
+still exist.  Jobs that do run are spread over a
+process pool, and output files whose content did not change are not
+rewritten (see write_if_changed), so their timestamps – and the objects
+make builds from them – stay untouched.
 
 Requirements:  pip install pillow
 """
 
-import os, sys
+import argparse
+import contextlib
+import hashlib
+import importlib
+import io
+import json
+import os
+import sys
+from concurrent.futures import ProcessPoolExecutor
 
 TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_ROOT = os.path.dirname(TOOLS_DIR)
 sys.path.insert(0, TOOLS_DIR)
 
-import gen_background
-import gen_font
-import gen_sprite
-
-
-def main():
-    print('=== Generating background assets (res/backgrounds/*) ===')
-    gen_background.main()
-    print()
-    print('=== Generating font assets (res/fonts/*) ===')
-    gen_font.main()
-    print()
-    print('=== Generating sprite assets (res/sprites/*) ===')
-    gen_sprite.main()
-    print()
-    print('All assets generated successfully.')
+CACHE_FILE = os.path.join(REPO_ROOT, 'obj', 'asset_cache.json')
+
+# (generator module, heading) in the order results are reported
+GENERATORS = [
+    ('gen_background', 'background assets (res/backgrounds/*)'),
+    ('gen_font',       'font assets (res/fonts/*)'),
+    ('gen_sprite',     'sprite assets (res/sprites/*)'),
+    ('gen_sfx',        'sound effects (res/sfx/*)'),
+    ('gen_behaviour',  'enemy behaviours (res/behaviours/*)'),
+]
+
+
+def _sha256_files(paths):
+    h = hashlib.sha256()
+    for path in paths:
+        with open(path, 'rb') as f:
+            h.update(f.read())
+        h.update(b'\0')
+    return h.hexdigest()
+
+
+def _job_key(gen_name, defn_path, deps=()):
+    """deps: other definition directories (relative to the repo root)."""
+    inputs = []
+    for d in [os.path.dirname(defn_path)] + [os.path.join(REPO_ROOT, d) for d in deps]:
+        if os.path.isdir(d):
+            inputs += [os.path.join(d, f) for f in sorted(os.listdir(d))]
+    return _sha256_files([p for p in inputs if os.path.isfile(p)] + [
+        os.path.join(TOOLS_DIR, f'{gen_name}.py'),
+        os.path.join(TOOLS_DIR, 'gbc_asset_builder.py'),
+    ])
+
+
+# Files of the code objects exec'd while a job runs (None: not recording).
+# Definitions are loaded with spec.loader.exec_module(), which raises an
+# 'exec' audit event for the module's code.
+_executed = None
+
+
+def _audit(event, args):
+    if event == 'exec' and _executed is not None:
+        _executed.add(getattr(args[0], 'co_filename', ''))
+
+
+def _run_job(gen_name, defn_path):
+    """Worker: run one generator on one definition.
+
+    Returns (log text, output paths relative to the repo root, other
+    definition directories it loaded, relative to the repo root)."""
+    global _executed
+    import gbc_asset_builder
+    gen = importlib.import_module(gen_name)
+    del gbc_asset_builder.outputs[:]
+    if not getattr(_audit, 'installed', False):
+        sys.addaudithook(_audit)
+        _audit.installed = True
+    _executed = set()
+    log = io.StringIO()
+    try:
+        with contextlib.redirect_stdout(log):
+            gen.process_definition(defn_path)
+    finally:
+        executed, _executed = _executed, None
+    outputs = sorted({os.path.relpath(p, REPO_ROOT)
+                      for p in gbc_asset_builder.outputs})
+    res_dir = os.path.join(REPO_ROOT, 'res') + os.sep
+    own_dir = os.path.dirname(os.path.abspath(defn_path))
+    deps = sorted({os.path.relpath(os.path.dirname(p), REPO_ROOT)
+                   for p in map(os.path.abspath, executed)
+                   if p.startswith(res_dir) and os.path.dirname(p) != own_dir})
+    return log.getvalue(), outputs, deps
+
+
+def _load_cache():
+    try:
+        with open(CACHE_FILE, 'r', encoding='utf-8') as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def _save_cache(cache):
+    os.makedirs(os.path.dirname(CACHE_FILE), exist_ok=True)
+    tmp = CACHE_FILE + '.tmp'
+    with open(tmp, 'w', encoding='utf-8') as f:
+        json.dump(cache, f, indent=1, sort_keys=True)
+    os.replace(tmp, CACHE_FILE)
+
+
+def _up_to_date(entry, key):
+    return (entry is not None and entry.get('key') == key and
+            all(os.path.isfile(os.path.join(REPO_ROOT, p))
+                for p in entry.get('outputs', [])))
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--force', action='store_true',
+                        help='ignore the cache and regenerate every asset')
+    parser.add_argument('-j', '--jobs', type=int, default=None,
+                        help='worker processes (default: one per CPU)')
+    args = parser.parse_args(argv)
+
+    cache = {} if args.force else _load_cache()
+    new_cache = {}
+    todo, skipped = [], 0
+
+    for gen_name, _ in GENERATORS:
+        gen = importlib.import_module(gen_name)
+        for entry, defn_path in gen.find_definitions():
+            rel = os.path.relpath(defn_path, REPO_ROOT)
+            deps = (cache.get(rel) or {}).get('deps', [])
+            key = _job_key(gen_name, defn_path, deps)
+            if _up_to_date(cache.get(rel), key):
+                new_cache[rel] = cache[rel]
+                skipped += 1
+            else:
+                todo.append((gen_name, entry, defn_path, rel, key))
+
+    results = {}
+    if todo:
+        workers = args.jobs or min(len(todo), os.cpu_count() or 1)
+        if workers <= 1:
+            for gen_name, _, defn_path, rel, _ in todo:
+                results[rel] = _run_job(gen_name, defn_path)
+        else:
+            with ProcessPoolExecutor(max_workers=workers) as pool:
+                futures = {rel: pool.submit(_run_job, gen_name, defn_path)
+                           for gen_name, _, defn_path, rel, _ in todo}
+                for rel, fut in futures.items():
+                    results[rel] = fut.result()
+
+    # Report per generator, in a stable order
+    for gen_name, heading in GENERATORS:
+        jobs = [t for t in todo if t[0] == gen_name]
+        if not jobs:
+            continue
+        print(f'=== Generating {heading} ===')
+        for _, entry, defn_path, rel, _ in jobs:
+            log, outputs, deps = results[rel]
+            print(f'--- {entry} ---')
+            sys.stdout.write(log)
+            key = _job_key(gen_name, defn_path, deps)
+            new_cache[rel] = {'key': key, 'outputs': outputs, 'deps': deps}
+        print()
+
+    _save_cache(new_cache)
+    print(f'{len(todo)} asset(s) generated, {skipped} up to date.')
 
 
 if __name__ == '__main__':